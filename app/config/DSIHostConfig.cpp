@@ -54,5 +54,6 @@ DSIHost::DSIHostConfig g_dsiHostConfig =
   .maxLTDCWriteMemoryCmdSize = 390u,
   .tearingEffectSource       = DSIHost::TearingEffectSource::DSI_LINK,
   .tearingEffectPolarity     = DSIHost::TearingEffectPolarity::FALLING_EDGE,
-  .enableAutoRefreshMode     = true,
+  // LTDC scans out only during refreshes started on demand, swap chains have to present with immediate reload
+  .enableAutoRefreshMode     = false,
 };
@@ -2,6 +2,13 @@
 #include "AppFrameBuffer.h"
 
 
+static constexpr LTDC::ColorFormat mapToLTDCColorFormat(IFrameBuffer::ColorFormat colorFormat)
+{
+  return (IFrameBuffer::ColorFormat::RGB565 == colorFormat)   ? LTDC::ColorFormat::RGB565 :
+         (IFrameBuffer::ColorFormat::ARGB8888 == colorFormat) ? LTDC::ColorFormat::ARGB8888 :
+                                                                LTDC::ColorFormat::RGB888;
+}
+
 LTDC::LTDCConfig g_ltdcConfig =
 {
   .hsyncWidth            = 1u,
@@ -39,7 +46,7 @@ LTDC::LTDCLayerConfig g_ltdcLayer1Config =
   .subjacentLayerBlendingFactor = LTDC::BlendingFactor::PIXEL_ALPHA_X_CONST_ALPHA,
   .frameBufferConfig            =
   {
-    .colorFormat     = LTDC::ColorFormat::RGB888,
+    .colorFormat     = mapToLTDCColorFormat(APP_FRAME_BUFFER_COLOR_FORMAT),
     .bufferDimension =
     {
       .width  = 390u,
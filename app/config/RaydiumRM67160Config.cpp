@@ -21,6 +21,7 @@ RaydiumRM67160::RaydiumRM67160Config g_rm67160Config =
   .startRowAddress               = 0u,
   .endRowAddress                 = 389u,
   .defaultBrightness             = 120u,
+  .enableTearingEffectLine       = true,
 };
 
 void enableDSI3V3Callback(void)
@@ -4,6 +4,11 @@
 #include "FrameBuffer.h"
 
 
-extern FrameBuffer<390u, 390u, IFrameBuffer::ColorFormat::RGB888> g_frameBuffer;
+//! RGB565 cuts frame buffer memory and DMA2D traffic by a third compared to RGB888, LTDC expands it to RGB888 for DSI
+constexpr IFrameBuffer::ColorFormat APP_FRAME_BUFFER_COLOR_FORMAT = IFrameBuffer::ColorFormat::RGB565;
+
+using AppFrameBuffer = FrameBuffer<390u, 390u, APP_FRAME_BUFFER_COLOR_FORMAT>;
+
+extern AppFrameBuffer g_frameBuffer;
 
 #endif // #ifndef APP_FRAME_BUFFER_H
\ No newline at end of file
@@ -15,6 +15,8 @@ void UART4_IRQHandler(void);
 void UART5_IRQHandler(void);
 void LPUART1_IRQHandler(void);
 void DMA2D_IRQHandler(void);
+void LTDC_IRQHandler(void);
+void DSI_IRQHandler(void);
 void I2C1_EV_IRQHandler(void);
 void EXTI0_IRQHandler(void);
 void EXTI1_IRQHandler(void);
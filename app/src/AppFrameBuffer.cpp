@@ -1,4 +1,4 @@
 #include "AppFrameBuffer.h"
 
 
-FrameBuffer<390u, 390u, IFrameBuffer::ColorFormat::RGB888> g_frameBuffer;
\ No newline at end of file
+AppFrameBuffer g_frameBuffer;
\ No newline at end of file
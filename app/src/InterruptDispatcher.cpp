@@ -58,6 +58,20 @@ void DMA2D_IRQHandler(void)
   dma2D.IRQHandler();
 }
 
+void LTDC_IRQHandler(void)
+{
+  static LTDC &ltdc = DriverManager::getInstance(DriverManager::LTDCInstance::GENERIC);
+
+  ltdc.IRQHandler();
+}
+
+void DSI_IRQHandler(void)
+{
+  static DSIHost &dsiHost = DriverManager::getInstance(DriverManager::DSIHostInstance::GENERIC);
+
+  dsiHost.IRQHandler();
+}
+
 void I2C1_EV_IRQHandler(void)
 {
   static I2C &i2c1 = DriverManager::getInstance(DriverManager::I2CInstance::I2C1);
@@ -16,6 +16,7 @@
 #include "GUIRectangle.h"
 #include "GUIImage.h"
 #include "GUIContainer.h"
+#include "GUIAnimator.h"
 #include "StringBuilder.h"
 #include "USARTLogger.h"
 #include "GUIScene.h"
@@ -44,6 +45,11 @@
 void initDriver(void);
 void initBSP(void);
 void initModules(void);
+void refreshDisplay(const GUI::Region &region);
+void startDisplayRefreshIfTearingEffectIsLate(void);
+
+//! Display signals tearing effect once per frame at 60 Hz, so an event missing for three frames is not coming
+constexpr uint64_t TEARING_EFFECT_TIMEOUT_IN_MS = 50u;
 
 MFXSTM32L152 g_mfx = MFXSTM32L152(
   &DriverManager::getInstance(DriverManager::I2CInstance::I2C1),
@@ -60,11 +66,19 @@ FT3267 g_ft3267 = FT3267(
 FT3267TouchDevice g_ft3267TouchDevice(g_ft3267);
 
 ArrayList<GUI::Container::ObjectInfo,5u> g_guiContainerObjectInfoList;
-GUI::Container g_guiContainer = GUI::Container(g_guiContainerObjectInfoList, g_frameBuffer);
+GUI::Container g_guiContainer = GUI::Container(
+  g_guiContainerObjectInfoList,
+  g_frameBuffer,
+  DriverManager::getInstance(DriverManager::DMA2DInstance::GENERIC));
+
+GUI::Animator g_animator = GUI::Animator(DriverManager::getInstance(DriverManager::SysTickInstance::GENERIC));
 
 bool g_isPlayStarted = true;
 GUI::IObject *g_objectToAnimatePtr = nullptr;
 uint8_t g_brightness = 140u;
+volatile bool g_isDisplayRefreshPending = false;
+volatile bool g_isDisplayRefreshOngoing = false;
+uint64_t g_displayRefreshRequestTimestamp = 0u;
 
 void panic(void)
 {
@@ -92,6 +106,56 @@ void ft3267InterruptHandler(void *argumentPtr)
   g_ft3267.runtimeTask();
 }
 
+void refreshDisplay(const GUI::Region &region)
+{
+  LTDC &ltdc       = DriverManager::getInstance(DriverManager::LTDCInstance::GENERIC);
+  DSIHost &dsiHost = DriverManager::getInstance(DriverManager::DSIHostInstance::GENERIC);
+
+  // display keeps its memory, so only the part of the frame buffer changed by the last draw is sent to it
+  g_displayRM67160.setDisplayWindow(region.x, region.y, region.width, region.height);
+  ltdc.setDisplayWindow({ .x = static_cast<uint16_t>(region.x), .y = static_cast<uint16_t>(region.y) },
+    { .width = region.width, .height = region.height });
+  dsiHost.setMaximumLTDCWriteMemoryCommandSize(region.width);
+
+  g_isDisplayRefreshOngoing = true;
+  g_displayRefreshRequestTimestamp =
+    DriverManager::getInstance(DriverManager::SysTickInstance::GENERIC).getTicks();
+  dsiHost.startTransferFromLTDCOnTearingEffect();
+}
+
+void startDisplayRefreshIfTearingEffectIsLate(void)
+{
+  SysTick &sysTick = DriverManager::getInstance(DriverManager::SysTickInstance::GENERIC);
+  DSIHost &dsiHost = DriverManager::getInstance(DriverManager::DSIHostInstance::GENERIC);
+  InterruptController &interruptController = DriverManager::getInstance(DriverManager::InterruptControllerInstance::GENERIC);
+
+  if ((not dsiHost.isWaitingForTearingEffect()) ||
+      (sysTick.getElapsedTimeInMs(g_displayRefreshRequestTimestamp) < TEARING_EFFECT_TIMEOUT_IN_MS))
+  {
+    return;
+  }
+
+  // DSI interrupt is masked, so the tearing effect can not start the transfer while the wait for it is cancelled
+  InterruptController::ErrorCode interruptControllerErrorCode = interruptController.disableInterrupt(DSI_IRQn);
+  if (InterruptController::ErrorCode::OK != interruptControllerErrorCode)
+  {
+    panic();
+  }
+
+  if (dsiHost.isWaitingForTearingEffect())
+  {
+    // refresh may tear, but the GUI keeps running even if the display never signals tearing effect
+    dsiHost.cancelWaitForTearingEffect();
+    dsiHost.startTransferFromLTDC();
+  }
+
+  interruptControllerErrorCode = interruptController.enableInterrupt(DSI_IRQn);
+  if (InterruptController::ErrorCode::OK != interruptControllerErrorCode)
+  {
+    panic();
+  }
+}
+
 
 void startup(void)
 {
@@ -102,8 +166,23 @@ void startup(void)
   initBSP();
   initModules();
 
-  int16_t x = g_objectToAnimatePtr->getPosition(GUI::Position::Tag::CENTER).x;
-  int16_t direction = 1;
+  // logo crosses the screen with the same speed as it had when it was moved by 3 px each 25 ms
+  constexpr uint32_t LOGO_SPEED_IN_PX_PER_S = 120u;
+  const GUI::Position logoCurrentPosition = g_objectToAnimatePtr->getPosition(GUI::Position::Tag::CENTER);
+  GUI::Position logoStartPosition = logoCurrentPosition;
+  GUI::Position logoEndPosition   = logoCurrentPosition;
+  logoStartPosition.x = 0;
+  logoEndPosition.x   = static_cast<int16_t>(g_frameBuffer.getWidth());
+
+  // tween starts where the logo already is, so its first leg runs from there to the right edge
+  g_animator.animatePosition(*g_objectToAnimatePtr, logoStartPosition, logoEndPosition,
+  {
+    .durationInMs    = 1000u * g_frameBuffer.getWidth() / LOGO_SPEED_IN_PX_PER_S,
+    .easing          = GUI::Animator::Easing::LINEAR,
+    .repeat          = GUI::Animator::Repeat::PING_PONG,
+    .startOffsetInMs = 1000u * static_cast<uint32_t>(logoCurrentPosition.x) / LOGO_SPEED_IN_PX_PER_S
+  });
+
   uint64_t timestamp = sysTick.getTicks();
 
   while (true)
@@ -114,28 +193,45 @@ void startup(void)
       panic();
     }
 
+    // draw call handed over by DMA2D interrupt is continued here, outside of interrupt
+    g_guiContainer.runtimeTask();
+
+    // frame buffer is read by the ongoing refresh, so it is neither reconfigured nor redrawn until it ends
+    if (g_isDisplayRefreshOngoing)
+    {
+      startDisplayRefreshIfTearingEffectIsLate();
+      continue;
+    }
+
+    // display is refreshed only on demand, after a draw has changed the frame buffer
+    if (g_isDisplayRefreshPending)
+    {
+      g_isDisplayRefreshPending = false;
+
+      const GUI::Region drawnRegion = g_guiContainer.getLastDrawnRegion();
+      if (not drawnRegion.isEmpty())
+      {
+        refreshDisplay(drawnRegion);
+      }
+
+      continue;
+    }
+
+    // late frame is not caught up, the next one is simply drawn with animated values of the moment it starts
     if ((sysTick.getElapsedTimeInMs(timestamp) >= 25u) && g_guiContainer.isDrawCompleted())
     {
       timestamp = sysTick.getTicks();
 
       if (g_isPlayStarted)
       {
-        if (x >= g_frameBuffer.getWidth())
-        {
-          direction = -1;
-        }
-        else if (0 >= x)
-        {
-          direction = 1;
-        }
-
-        x = x + direction * 3;
-
-        GUI::Position newPosition = g_objectToAnimatePtr->getPosition(GUI::Position::Tag::CENTER);
-        newPosition.x = x;
-        g_objectToAnimatePtr->moveToPosition(newPosition);
+        g_animator.resume();
+      }
+      else
+      {
+        g_animator.pause();
       }
 
+      g_animator.update();
       g_guiContainer.draw(GUI::DrawHardware::DMA2D);
     }
   }
@@ -322,6 +418,18 @@ void initDriver(void)
   {
     panic();
   }
+
+  interruptControllerErrorCode = interruptController.enableInterrupt(LTDC_IRQn);
+  if (InterruptController::ErrorCode::OK != interruptControllerErrorCode)
+  {
+    panic();
+  }
+
+  interruptControllerErrorCode = interruptController.enableInterrupt(DSI_IRQn);
+  if (InterruptController::ErrorCode::OK != interruptControllerErrorCode)
+  {
+    panic();
+  }
 }
 
 void initBSP(void)
@@ -556,12 +664,20 @@ void initModules(void)
 
   GUI::Container::CallbackDescription drawCompletedCallback =
   {
-    .functionPtr = [](void *argument) { reinterpret_cast<DSIHost*>(argument)->startTransferFromLTDC(); },
-    .argument = &(DriverManager::getInstance(DriverManager::DSIHostInstance::GENERIC))
+    .functionPtr = [](void *argument) { *reinterpret_cast<volatile bool*>(argument) = true; },
+    .argument = const_cast<bool*>(&g_isDisplayRefreshPending)
   };
 
   g_guiContainer.registerDrawCompletedCallback(drawCompletedCallback);
 
+  DSIHost::CallbackDescription endOfRefreshCallback =
+  {
+    .functionPtr = [](void *argument) { *reinterpret_cast<volatile bool*>(argument) = false; },
+    .argument = const_cast<bool*>(&g_isDisplayRefreshOngoing)
+  };
+
+  DriverManager::getInstance(DriverManager::DSIHostInstance::GENERIC).registerEndOfRefreshCallback(endOfRefreshCallback);
+
   static GUI::TouchController touchController;
   touchController.registerContainer(&g_guiContainer);
 
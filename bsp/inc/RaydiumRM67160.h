@@ -30,12 +30,18 @@ public:
     uint16_t startRowAddress;
     uint16_t endRowAddress;
     uint8_t defaultBrightness;
+    //! Display signals the start of its vertical blanking period, so frame transfers can be synchronized to it
+    bool enableTearingEffectLine;
   };
 
   ErrorCode init(const RaydiumRM67160Config &raydiumRM67160Config);
 
   ErrorCode setDisplayBrightness(uint8_t brightness);
 
+  //! Pixels written by the next frame transfer land only inside of the window, the rest of the display memory
+  //! is kept. Position is relative to the start column and row address given to init.
+  ErrorCode setDisplayWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+
 private:
 
   static constexpr uint32_t BITS_IN_BYTE = 8u;
@@ -57,6 +63,7 @@ private:
     SET_COLUMN_START_END_ADDRESS = 0x2A,
     SET_ROW_START_END_ADDRESS    = 0x2B,
     DISABLE_TEARING_EFFECT_LINE  = 0x34,
+    ENABLE_TEARING_EFFECT_LINE   = 0x35,
     SET_INTERFACE_COLOR_FORMAT   = 0x3A,
     SET_DISPLAY_BRIGHTNESS       = 0x51,
     SET_DSI_MODE                 = 0xC2,
@@ -95,6 +102,7 @@ private:
     DSIHost::VirtualChannelID virtualChannelId,
     DSIInterfaceColorFormat dsiInterfaceColorFormat);
   void disableTearingEffectLine(DSIHost::VirtualChannelID virtualChannelId);
+  void enableTearingEffectLine(DSIHost::VirtualChannelID virtualChannelId);
   void setDSIMode(DSIHost::VirtualChannelID virtualChannelId, DSIMode dsiMode);
   void setStartAndEndColumnAddress(
     DSIHost::VirtualChannelID virtualChannelId,
@@ -113,6 +121,12 @@ private:
 
   //! Pointer to SysTick
   SysTick *m_sysTickPtr;
+
+  //! Column address of the first visible pixel
+  uint16_t m_startColumnAddress;
+
+  //! Row address of the first visible line
+  uint16_t m_startRowAddress;
 };
 
 #endif // #ifndef RAYDIUM_RM67160_H
\ No newline at end of file
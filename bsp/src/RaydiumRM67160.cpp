@@ -36,13 +36,18 @@ const uint8_t RaydiumRM67160::s_dcsCommandsManufCmdSetPage4[][2] =
 
 RaydiumRM67160::RaydiumRM67160(DSIHost *dsiHostPtr, SysTick *sysTickPtr):
   m_dsiHostPtr(dsiHostPtr),
-  m_sysTickPtr(sysTickPtr)
+  m_sysTickPtr(sysTickPtr),
+  m_startColumnAddress(0u),
+  m_startRowAddress(0u)
 {}
 
 RaydiumRM67160::ErrorCode RaydiumRM67160::init(const RaydiumRM67160Config &raydiumRM67160Config)
 {
   constexpr uint64_t WAIT_AFTER_EXITING_SLEEP_MODE_PERIOD_MS = 120u;
 
+  m_startColumnAddress = raydiumRM67160Config.startColumnAddress;
+  m_startRowAddress    = raydiumRM67160Config.startRowAddress;
+
   powerOnDisplay(raydiumRM67160Config);
 
   setCommandSet(DSIHost::VirtualChannelID::CHANNEL_0, CommandSet::MANUFACTURE_CMD_SET_PAGE_0);
@@ -62,7 +67,14 @@ RaydiumRM67160::ErrorCode RaydiumRM67160::init(const RaydiumRM67160Config &raydi
 
   setCommandSet(DSIHost::VirtualChannelID::CHANNEL_0, CommandSet::USER_CMD_SET);
   setDsiInterfaceColorFormat(DSIHost::VirtualChannelID::CHANNEL_0, DSIInterfaceColorFormat::RGB888);
-  disableTearingEffectLine(DSIHost::VirtualChannelID::CHANNEL_0);
+  if (raydiumRM67160Config.enableTearingEffectLine)
+  {
+    enableTearingEffectLine(DSIHost::VirtualChannelID::CHANNEL_0);
+  }
+  else
+  {
+    disableTearingEffectLine(DSIHost::VirtualChannelID::CHANNEL_0);
+  }
   setDSIMode(DSIHost::VirtualChannelID::CHANNEL_0, DSIMode::INTERNAL_TIMING);
   setStartAndEndColumnAddress(
     DSIHost::VirtualChannelID::CHANNEL_0,
@@ -90,6 +102,18 @@ RaydiumRM67160::ErrorCode RaydiumRM67160::setDisplayBrightness(uint8_t brightnes
   return ErrorCode::OK;
 }
 
+RaydiumRM67160::ErrorCode RaydiumRM67160::setDisplayWindow(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+  const uint16_t startColumnAddress = m_startColumnAddress + x;
+  const uint16_t startRowAddress    = m_startRowAddress + y;
+
+  setCommandSet(DSIHost::VirtualChannelID::CHANNEL_0, CommandSet::USER_CMD_SET);
+  setStartAndEndColumnAddress(DSIHost::VirtualChannelID::CHANNEL_0, startColumnAddress, startColumnAddress + width - 1u);
+  setStartAndEndRowAddress(DSIHost::VirtualChannelID::CHANNEL_0, startRowAddress, startRowAddress + height - 1u);
+
+  return ErrorCode::OK;
+}
+
 void RaydiumRM67160::powerOnDisplay(const RaydiumRM67160Config &raydiumRM67160Config)
 {
   constexpr uint64_t WAIT_BEFORE_ENABLE_DSI_3V3_PERIOD_MS        = 5u;
@@ -153,6 +177,17 @@ void RaydiumRM67160::disableTearingEffectLine(DSIHost::VirtualChannelID virtualC
   m_dsiHostPtr->dcsShortWrite(virtualChannelId, static_cast<uint8_t>(UserCmdSetCommands::DISABLE_TEARING_EFFECT_LINE));
 }
 
+void RaydiumRM67160::enableTearingEffectLine(DSIHost::VirtualChannelID virtualChannelId)
+{
+  // TE is signaled only at the start of vertical blanking period, not at each horizontal one
+  constexpr uint8_t TEARING_EFFECT_MODE_VBLANK_ONLY = 0x00;
+
+  m_dsiHostPtr->dcsShortWrite(
+    virtualChannelId,
+    static_cast<uint8_t>(UserCmdSetCommands::ENABLE_TEARING_EFFECT_LINE),
+    TEARING_EFFECT_MODE_VBLANK_ONLY);
+}
+
 void RaydiumRM67160::setDSIMode(DSIHost::VirtualChannelID virtualChannelId, DSIMode dsiMode)
 {
   m_dsiHostPtr->dcsShortWrite(
@@ -90,6 +90,7 @@ void ARaydiumRM67160::SetUp()
   raydiumRM67160Config.enableDSI1V8Callback          = dummyCallback;
   raydiumRM67160Config.setDSIResetLineToLowCallback  = dummyCallback;
   raydiumRM67160Config.setDSIResetLineToHighCallback = dummyCallback;
+  raydiumRM67160Config.enableTearingEffectLine       = false;
 
   setupSysTickReadings();
 }
@@ -585,7 +586,7 @@ TEST_F(ARaydiumRM67160, InitSetsDSIInterfaceColorFormatToRGB888)
   assertThatExpectedDCSShortWriteIsIssued();
 }
 
-TEST_F(ARaydiumRM67160, InitDisablesTearingEffectLine)
+TEST_F(ARaydiumRM67160, InitDisablesTearingEffectLineIfItIsNotEnabledByConfigParam)
 {
   constexpr uint8_t USER_COMMAND_SET                = 0x0;
   constexpr uint8_t DISABLE_TEARING_EFFECT_LINE_CMD = 0x34;
@@ -597,6 +598,20 @@ TEST_F(ARaydiumRM67160, InitDisablesTearingEffectLine)
   assertThatExpectedDCSShortWriteIsIssued();
 }
 
+TEST_F(ARaydiumRM67160, InitEnablesTearingEffectLineInVBlankOnlyModeIfItIsEnabledByConfigParam)
+{
+  constexpr uint8_t USER_COMMAND_SET               = 0x0;
+  constexpr uint8_t ENABLE_TEARING_EFFECT_LINE_CMD = 0x35;
+  constexpr uint8_t TEARING_EFFECT_MODE_VBLANK_ONLY = 0x00;
+  raydiumRM67160Config.enableTearingEffectLine = true;
+  expectDCSShortWrite(USER_COMMAND_SET, ENABLE_TEARING_EFFECT_LINE_CMD, TEARING_EFFECT_MODE_VBLANK_ONLY);
+
+  const RaydiumRM67160::ErrorCode errorCode = virtualRaydiumRM67160.init(raydiumRM67160Config);
+
+  ASSERT_THAT(errorCode, Eq(RaydiumRM67160::ErrorCode::OK));
+  assertThatExpectedDCSShortWriteIsIssued();
+}
+
 TEST_F(ARaydiumRM67160, InitSetsDSIModeToInternalTiming)
 {
   constexpr uint8_t USER_COMMAND_SET  = 0x0;
@@ -728,4 +743,44 @@ TEST_F(ARaydiumRM67160, SetDisplayBrightnessSetsBrightnessAccordingToBrightnessF
 
   ASSERT_THAT(errorCode, Eq(RaydiumRM67160::ErrorCode::OK));
   assertThatExpectedDCSShortWriteIsIssued();
+}
+
+TEST_F(ARaydiumRM67160, SetDisplayWindowSetsStartAndEndColumnAddressOffsetByStartColumnAddressConfigParam)
+{
+  constexpr uint16_t COLUMN_START_ADDRESS = 4u;
+  constexpr uint8_t USER_COMMAND_SET      = 0x0u;
+  constexpr uint8_t SET_COLUMN_START_END_ADDRESS_CMD = 0x2A;
+  // window starts at column 4 + 300 = 0x130 and ends at column 4 + 300 + 50 - 1 = 0x161
+  const uint8_t EXPECTED_COLUMN_START_END_ADDRESS[4] = { 0x01, 0x30, 0x01, 0x61 };
+  raydiumRM67160Config.startColumnAddress = COLUMN_START_ADDRESS;
+  virtualRaydiumRM67160.init(raydiumRM67160Config);
+  expectDCSLongWrite(USER_COMMAND_SET,
+    SET_COLUMN_START_END_ADDRESS_CMD,
+    EXPECTED_COLUMN_START_END_ADDRESS,
+    4u);
+
+  const RaydiumRM67160::ErrorCode errorCode = virtualRaydiumRM67160.setDisplayWindow(300u, 10u, 50u, 20u);
+
+  ASSERT_THAT(errorCode, Eq(RaydiumRM67160::ErrorCode::OK));
+  assertThatExpectedDCSLongWriteIsIssued();
+}
+
+TEST_F(ARaydiumRM67160, SetDisplayWindowSetsStartAndEndRowAddressOffsetByStartRowAddressConfigParam)
+{
+  constexpr uint16_t ROW_START_ADDRESS = 2u;
+  constexpr uint8_t USER_COMMAND_SET   = 0x0u;
+  constexpr uint8_t SET_ROW_START_END_ADDRESS_CMD = 0x2B;
+  // window starts at row 2 + 10 = 0x0C and ends at row 2 + 10 + 20 - 1 = 0x1F
+  const uint8_t EXPECTED_ROW_START_END_ADDRESS[4] = { 0x00, 0x0C, 0x00, 0x1F };
+  raydiumRM67160Config.startRowAddress = ROW_START_ADDRESS;
+  virtualRaydiumRM67160.init(raydiumRM67160Config);
+  expectDCSLongWrite(USER_COMMAND_SET,
+    SET_ROW_START_END_ADDRESS_CMD,
+    EXPECTED_ROW_START_END_ADDRESS,
+    4u);
+
+  const RaydiumRM67160::ErrorCode errorCode = virtualRaydiumRM67160.setDisplayWindow(300u, 10u, 50u, 20u);
+
+  ASSERT_THAT(errorCode, Eq(RaydiumRM67160::ErrorCode::OK));
+  assertThatExpectedDCSLongWriteIsIssued();
 }
\ No newline at end of file
@@ -13,6 +13,9 @@ public:
 
   typedef void (*CallbackFunc)(void*);
 
+  //! Maximum number of commands which can be enqueued into the command queue
+  static constexpr uint32_t COMMAND_QUEUE_CAPACITY = 16u;
+
   DMA2D(DMA2D_TypeDef *DMA2DPeripheralPtr, ResetControl *resetControlPtr);
 
 #ifdef UNIT_TEST
@@ -26,7 +29,8 @@ public:
     OK                               = 0u,
     BUSY                             = 1u,
     COLOR_VALUE_OUT_OF_RANGE         = 2u,
-    CAN_NOT_TURN_ON_PERIPHERAL_CLOCK = 3u
+    CAN_NOT_TURN_ON_PERIPHERAL_CLOCK = 3u,
+    COMMAND_QUEUE_FULL               = 4u
   };
 
   enum class OutputColorFormat : uint8_t
@@ -83,11 +87,29 @@ public:
     uint16_t height;
   };
 
+  enum class CLUTColorFormat : uint8_t
+  {
+    ARGB8888 = 0u,
+    RGB888   = 1u
+  };
+
+  //! Color look-up table of indexed color formats (L8, L4, AL44 and AL88)
+  struct CLUTConfiguration
+  {
+    CLUTColorFormat colorFormat;
+    uint16_t size;
+    const void *clutPtr;
+  };
+
   struct InputBufferConfiguration
   {
     InputColorFormat colorFormat;
     Dimension bufferDimension;
     const void *bufferPtr;
+    //! Used only by indexed color formats of the foreground, CLUT is reloaded only if it differs from the loaded one
+    CLUTConfiguration clutConfig;
+    //! Used only by alpha only color formats (A8 and A4) of the foreground, RGB of all pixels is taken from it
+    Color color;
   };
 
   struct OutputBufferConfiguration
@@ -154,6 +176,33 @@ public:
 #endif // #ifdef UNIT_TEST
   ErrorCode blendBitmap(const BlendBitmapConfig &blendBitmapConfig);
 
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  ErrorCode enqueueFillRectangle(const FillRectangleConfig &fillRectangleConfig);
+
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  ErrorCode enqueueCopyBitmap(const CopyBitmapConfig &copyBitmapConfig);
+
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  ErrorCode enqueueBlendBitmap(const BlendBitmapConfig &blendBitmapConfig);
+
+  //! Executes all enqueued commands back to back, the callback is called once the last one is completed
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  ErrorCode executeCommandQueue(const CallbackDescription &queueCompletedCallback);
+
+  //! Returns number of commands enqueued and not yet started
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  uint32_t getNumberOfEnqueuedCommands(void) const;
+
 #ifdef UNIT_TEST
   virtual
 #endif // #ifdef UNIT_TEST
@@ -202,6 +251,25 @@ private:
     COUNT
   };
 
+  enum class CommandType : uint8_t
+  {
+    FILL_RECTANGLE = 0u,
+    COPY_BITMAP    = 1u,
+    BLEND_BITMAP   = 2u
+  };
+
+  struct Command
+  {
+    CommandType type;
+
+    union
+    {
+      FillRectangleConfig fillRectangleConfig;
+      CopyBitmapConfig copyBitmapConfig;
+      BlendBitmapConfig blendBitmapConfig;
+    };
+  };
+
   //! Constrol/status operation to register mapping
   struct CSRegisterMapping
   {
@@ -221,7 +289,13 @@ private:
     Dimension transactionRectangleDimension,
     Position position,
     Dimension bufferDimension,
-    const void *bufferPtr);
+    const void *bufferPtr,
+    const CLUTConfiguration &clutConfig,
+    Color color);
+
+  void loadForegroundCLUTIfNotLoaded(uint32_t &registerValueFGPFCCR, const CLUTConfiguration &clutConfig);
+  void setForegroundColor(Color color);
+  bool isForegroundCLUTLoaded(const CLUTConfiguration &clutConfig) const;
 
   void configureBackgroundInputStage(
     InputColorFormat colorFormat,
@@ -260,6 +334,13 @@ private:
   static uint8_t getPixelSize(OutputColorFormat outputColorFormat);
   static uint8_t getPixelSize(InputColorFormat inputColorFormat);
 
+  //! 4-bit input formats have two pixels per byte, so addresses are calculated in bits
+  static uint8_t getBitsPerPixel(OutputColorFormat outputColorFormat);
+  static uint8_t getBitsPerPixel(InputColorFormat inputColorFormat);
+
+  static bool isIndexedColorFormat(InputColorFormat inputColorFormat);
+  static bool isAlphaOnlyColorFormat(InputColorFormat inputColorFormat);
+
   static ErrorCode checkFillRectangleConfig(const FillRectangleConfig &fillRectangleConfig);
 
   static Color getMaximumColorValue(OutputColorFormat outputColorFormat);
@@ -269,8 +350,16 @@ private:
 
   void setOutputColor(OutputColorFormat outputColorFormat, Color color);
 
+  void startFillRectangle(const FillRectangleConfig &fillRectangleConfig);
+  void startCopyBitmap(const CopyBitmapConfig &copyBitmapConfig);
+  void startBlendBitmap(const BlendBitmapConfig &blendBitmapConfig);
+
   void startDMA2D(void);
 
+  ErrorCode checkIfCommandCanBeEnqueued(void) const;
+  Command& allocateCommandQueueEntry(void);
+  void startNextCommandFromQueue(void);
+
   bool startTransfer(void);
   void endTransfer(void);
 
@@ -303,6 +392,21 @@ private:
 
   //! Draw completed callback description
   CallbackDescription m_drawCompletedCallback;
+
+  //! Ring buffer of commands waiting to be executed
+  Command m_commandQueue[COMMAND_QUEUE_CAPACITY];
+
+  //! Index of the next command to be executed
+  uint32_t m_commandQueueHead;
+
+  //! Number of commands waiting to be executed
+  uint32_t m_commandQueueSize;
+
+  //! Is command queue being executed, the next command is then started directly from IRQ handler
+  bool m_isCommandQueueExecuting;
+
+  //! CLUT currently loaded into the foreground CLUT memory
+  CLUTConfiguration m_foregroundCLUTConfig;
 };
 
 #endif // #ifndef DMA2D_H
\ No newline at end of file
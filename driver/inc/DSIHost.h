@@ -11,6 +11,8 @@ class DSIHost
 {
 public:
 
+  typedef void (*CallbackFunc)(void*);
+
   DSIHost(DSI_TypeDef *DSIHostPeripheralPtr, ClockControl *clockControlPtr, ResetControl *resetControlPtr);
 
   //! This enum class represents errors which can happen during method calls
@@ -133,6 +135,12 @@ public:
     bool enableAutoRefreshMode;
   };
 
+  struct CallbackDescription
+  {
+    CallbackFunc functionPtr;
+    void *argument;
+  };
+
 #ifdef UNIT_TEST
   virtual
 #endif // #ifdef UNIT_TEST
@@ -176,16 +184,64 @@ public:
     const void *dataPtr,
     uint16_t dataSize);
 
+  //! End of refresh callback is called from IRQHandler once the whole frame is transferred
 #ifdef UNIT_TEST
   virtual
 #endif // #ifdef UNIT_TEST
   ErrorCode startTransferFromLTDC(void);
 
+  //! Transfer is started from IRQHandler at the next tearing effect event, so it never races the display scan
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  ErrorCode startTransferFromLTDCOnTearingEffect(void);
+
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  bool isWaitingForTearingEffect(void) const;
+
+  //! Transfer is no longer started by the tearing effect event, e.g. when the event does not come in time.
+  //! DSI interrupt has to be disabled during the call, as IRQHandler modifies the same registers.
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void cancelWaitForTearingEffect(void);
+
+  //! Transfer is ongoing also while it waits for the tearing effect event, hardware clears LTDCEN bit once
+  //! the whole frame is transferred from LTDC
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  bool isTransferFromLTDCOngoing(void) const;
+
+  //! Frame lines longer than command size are split into several write memory commands
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void setMaximumLTDCWriteMemoryCommandSize(uint16_t maximumLTDCWriteMemoryCommandSize);
+
 #ifdef UNIT_TEST
   virtual
 #endif // #ifdef UNIT_TEST
   ErrorCode getDSIPHYClockFrequency(uint32_t &dsiPhyClockFreq);
 
+  //! Frame buffer read by the transfer is safe to be reused from the moment the callback is called
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void registerEndOfRefreshCallback(const CallbackDescription &callbackDescription);
+
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void unregisterEndOfRefreshCallback(void);
+
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void IRQHandler(void);
+
   inline Peripheral getPeripheralTag(void) const
   {
     return static_cast<Peripheral>(reinterpret_cast<uintptr_t>(const_cast<DSI_TypeDef*>(m_DSIHostPeripheralPtr)));
@@ -193,6 +249,21 @@ public:
 
 private:
 
+  //! Wrapper interrupts, the value is the bit position of the interrupt in WIER, WISR and WIFCR registers
+  enum class WrapperInterrupt : uint8_t
+  {
+    TEARING_EFFECT = 0u,
+    END_OF_REFRESH = 1u
+  };
+
+  void enableWrapperInterrupt(WrapperInterrupt wrapperInterrupt);
+  void disableWrapperInterrupt(WrapperInterrupt wrapperInterrupt);
+  bool isWrapperInterruptEnabled(WrapperInterrupt wrapperInterrupt) const;
+  bool isWrapperInterruptFlagSet(WrapperInterrupt wrapperInterrupt) const;
+  void clearWrapperInterruptFlag(WrapperInterrupt wrapperInterrupt);
+
+  void callEndOfRefreshCallbackIfRegistered(void);
+
   static constexpr uint32_t FREQ_HZ_TO_MHZ_DIVIDER     = 1000000u;
   static constexpr uint32_t NANOSECONDS_IN_MICROSECOND = 1000u;
   static constexpr uint32_t NANOSECONDS_IN_SECOND      = 1000000000u;
@@ -301,8 +372,6 @@ private:
   void setDSIModeToAdaptedCommandMode(void);
   void setCommandModeToAdaptedCommandMode(void);
 
-  void setMaximumLTDCWriteMemoryCommandSize(uint16_t maximumLTDCWriteMemoryCommandSize);
-
   void setHSyncPolarity(uint32_t &registerValueLPCR, SignalPolarity hsyncPolarity);
   void setVSyncPolarity(uint32_t &registerValueLPCR, SignalPolarity vsyncPolarity);
   void setDataEnablePolarity(uint32_t &registerValueLPCR, SignalPolarity dataEnablePolarity);
@@ -335,6 +404,8 @@ private:
 
   //! TODO
   uint32_t m_dsiPhyClockFreq;
+
+  CallbackDescription m_endOfRefreshCallback;
 };
 
 #endif // #ifndef DSI_HOST_H
\ No newline at end of file
@@ -35,6 +35,12 @@ public:
 #endif // #ifdef UNIT_TEST
   ErrorCode enableInterrupt(int32_t irqNumber);
 
+  //! Interrupt request stays pending while the interrupt is disabled, so it is handled once it is enabled again
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  ErrorCode disableInterrupt(int32_t irqNumber);
+
 #ifdef UNIT_TEST
   /**
   * @brief Method gets raw pointer to underlaying NVIC core hardware instance.
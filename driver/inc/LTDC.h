@@ -11,8 +11,15 @@ class LTDC
 {
 public:
 
+  typedef void (*CallbackFunc)(void*);
+
   LTDC(LTDC_TypeDef *LTDCPeripheralPtr, ResetControl *resetControlPtr);
 
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  ~LTDC() = default;
+
   //! This enum class represents errors which can happen during method calls
   enum class ErrorCode : uint8_t
   {
@@ -47,6 +54,13 @@ public:
     AL88     = 0b111
   };
 
+  //! TODO
+  enum class Layer : uint8_t
+  {
+    LAYER1 = 0u,
+    LAYER2 = 1u
+  };
+
   enum class BlendingFactor : uint8_t
   {
     CONST_ALPHA               = 0b100,
@@ -89,6 +103,12 @@ public:
     void *bufferPtr;
   };
 
+  struct CallbackDescription
+  {
+    CallbackFunc functionPtr;
+    void *argument;
+  };
+
   struct LTDCLayerConfig
   {
     uint8_t alpha;
@@ -98,8 +118,101 @@ public:
     FrameBufferConfiguration frameBufferConfig;
   };
 
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
   ErrorCode init(const LTDCConfig &ltdcConfig, const LTDCLayerConfig &ltdcLayer1Config);
 
+  //! Change of the frame buffer address takes effect only after the next shadow registers reload
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void setFrameBufferAddress(Layer layer, void *frameBufferPtr);
+
+  //! Frame buffer of the layer is placed at the given position of the display, enable state of the layer is kept.
+  //! Same as the rest of layer setters, change takes effect only after the next shadow registers reload
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void configureLayer(Layer layer, const LTDCLayerConfig &ltdcLayerConfig, Position windowPosition);
+
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void enableLayer(Layer layer);
+
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void disableLayer(Layer layer);
+
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void setLayerWindowPosition(Layer layer, Position windowPosition);
+
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void setLayerConstantAlpha(Layer layer, uint8_t alpha);
+
+  //! Layer 2 is always blended on top of layer 1, which is blended on top of the background color
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void setLayerBlendingFactors(
+    Layer layer,
+    BlendingFactor currentLayerBlendingFactor,
+    BlendingFactor subjacentLayerBlendingFactor);
+
+  //! Only the window of frame buffers is scanned out, in adapted command mode it is the only part sent over DSI.
+  //! Shadow registers are reloaded immediately, so it must not be called while a frame transfer is ongoing.
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void setDisplayWindow(Position position, Dimension dimension);
+
+  //! Shadow registers are reloaded during the next vertical blanking period, so no tearing is visible
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void reloadOnVerticalBlank(void);
+
+  //! Callback is called from IRQHandler once the shadow registers are reloaded, so all layer changes written
+  //! before the call are applied together between two frames
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void reloadOnVerticalBlank(const CallbackDescription &reloadCompletedCallback);
+
+  //! Shadow registers are reloaded at once, so it must not be called while a frame is being scanned out
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void reloadImmediately(void);
+
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  bool isReloadOngoing(void) const;
+
+  //! Line is counted from the first line of the active area, callback is called from IRQHandler each time
+  //! the scan out reaches the line, until the line interrupt is disabled
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void enableLineInterrupt(uint16_t line, const CallbackDescription &lineCallback);
+
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void disableLineInterrupt(void);
+
+#ifdef UNIT_TEST
+  virtual
+#endif // #ifdef UNIT_TEST
+  void IRQHandler(void);
+
   inline Peripheral getPeripheralTag(void) const
   {
     return static_cast<Peripheral>(reinterpret_cast<uintptr_t>(const_cast<LTDC_TypeDef*>(m_LTDCPeripheralPtr)));
@@ -107,11 +220,31 @@ public:
 
 private:
 
+  //! Interrupts, the value is the bit position of the interrupt in IER, ISR and ICR registers
+  enum class Interrupt : uint8_t
+  {
+    LINE            = 0u,
+    REGISTER_RELOAD = 3u
+  };
+
+  void enableInterrupt(Interrupt interrupt);
+  void disableInterrupt(Interrupt interrupt);
+  bool isInterruptEnabled(Interrupt interrupt) const;
+  bool isInterruptFlagSet(Interrupt interrupt) const;
+  void clearInterruptFlag(Interrupt interrupt);
+
+  void setLineInterruptPosition(uint16_t line);
+
+  static void callCallbackIfRegistered(const CallbackDescription &callbackDescription);
+
   static constexpr uint32_t LAYER1_OFFSET = 0x84;
   static constexpr uint32_t LAYER2_OFFSET = 0x104;
+  static constexpr uint8_t  LAYER_COUNT   = 2u;
 
   ErrorCode enablePeripheralClock(void);
 
+  LTDC_Layer_TypeDef* getLayerPtr(Layer layer) const;
+
   void configureLTDC(const LTDCConfig &ltdcConfig);
 
   void configureLTDCLayer(
@@ -179,6 +312,14 @@ private:
 
   void setLayerFrameBufferAddress(LTDC_Layer_TypeDef *LTDCPeripheralLayerPtr, void *frameBufferPtr);
 
+  void setLayerDisplayWindow(Layer layer);
+
+  void getVisibleLayerWindow(Layer layer, Position &visiblePosition, Dimension &visibleDimension) const;
+
+  void* getLayerWindowAddress(Layer layer, Position visiblePosition) const;
+
+  void updateLayerEnableState(Layer layer);
+
   void setLayerFrameBufferWidth(
     LTDC_Layer_TypeDef *LTDCPeripheralLayerPtr,
     uint16_t frameBufferWidth,
@@ -214,6 +355,30 @@ private:
 
   //! Pointer to Reset Control module
   ResetControl *m_resetControlPtr;
+
+  //! Timing configuration given to init, display window is placed at the beginning of its active area
+  LTDCConfig m_ltdcConfig;
+
+  //! Frame buffer configuration of each layer, buffer address is kept without display window offset
+  FrameBufferConfiguration m_frameBufferConfig[LAYER_COUNT];
+
+  //! Position of the display window on the display
+  Position m_displayWindowPosition;
+
+  //! Dimension of the display window
+  Dimension m_displayWindowDimension;
+
+  //! Position of frame buffer of each layer on the display
+  Position m_layerWindowPosition[LAYER_COUNT];
+
+  //! Enabled layer is scanned out only while its window overlaps with the display window
+  bool m_isLayerEnabled[LAYER_COUNT];
+
+  //! Callback called once the shadow registers are reloaded on vertical blanking
+  CallbackDescription m_reloadCompletedCallback;
+
+  //! Callback called each time the scan out reaches the line interrupt position
+  CallbackDescription m_lineCallback;
 };
 
 #endif // #ifndef LTDC_H
\ No newline at end of file
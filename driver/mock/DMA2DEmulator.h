@@ -0,0 +1,884 @@
+#ifndef DMA2D_EMULATOR_H
+#define DMA2D_EMULATOR_H
+
+#include "DMA2D.h"
+#include <cstdint>
+
+
+//! Software DMA2D back-end which renders into host memory, used to verify and benchmark DMA2D drawing without
+//! a board. Like the real peripheral, a started transfer is completed only once IRQHandler is called.
+//! Every transfer also contributes to a cycle estimate derived from the DMA2D throughput: pixels are
+//! streamed at one pixel per clock through PFC and two through the blender, bounded by 32 bit AHB bursts.
+class DMA2DEmulator : public DMA2D
+{
+public:
+
+  //! Clock cycles spent by DMA2D on switching to the next line of the transfer rectangle
+  static constexpr uint32_t LINE_OVERHEAD_CYCLES = 2u;
+
+  //! Clock cycles spent by DMA2D on programming and starting a transfer
+  static constexpr uint32_t TRANSFER_SETUP_CYCLES = 8u;
+
+  DMA2DEmulator():
+    DMA2D(nullptr, nullptr),
+    m_ongoingCommand{},
+    m_isTransferOngoing(false),
+    m_isCommandQueueExecuting(false),
+    m_completedCallback{ .functionPtr = nullptr, .argument = nullptr },
+    m_commandQueue{},
+    m_commandQueueHead(0u),
+    m_commandQueueSize(0u),
+    m_loadedCLUTPtr(nullptr),
+    m_estimatedCycleCount(0u),
+    m_transferCount(0u)
+  {}
+
+  virtual ~DMA2DEmulator() = default;
+
+  ErrorCode init(void) override;
+
+  ErrorCode fillRectangle(const FillRectangleConfig &fillRectangleConfig) override;
+  ErrorCode copyBitmap(const CopyBitmapConfig &copyBitmapConfig) override;
+  ErrorCode blendBitmap(const BlendBitmapConfig &blendBitmapConfig) override;
+
+  ErrorCode enqueueFillRectangle(const FillRectangleConfig &fillRectangleConfig) override;
+  ErrorCode enqueueCopyBitmap(const CopyBitmapConfig &copyBitmapConfig) override;
+  ErrorCode enqueueBlendBitmap(const BlendBitmapConfig &blendBitmapConfig) override;
+
+  ErrorCode executeCommandQueue(const CallbackDescription &queueCompletedCallback) override;
+
+  uint32_t getNumberOfEnqueuedCommands(void) const override;
+
+  bool isTransferOngoing(void) const override;
+
+  //! Renders the ongoing transfer into the destination buffer and completes it as the transfer complete IRQ does
+  void IRQHandler(void) override;
+
+  //! Keeps calling IRQHandler until no transfer is ongoing, returns number of completed transfers
+  uint32_t completeAllTransfers(void);
+
+  //! Returns estimated number of DMA2D clock cycles spent on all transfers since the last reset
+  inline uint64_t getEstimatedCycleCount(void) const
+  {
+    return m_estimatedCycleCount;
+  }
+
+  //! Returns estimated time in microseconds spent on all transfers since the last reset, for given AHB clock
+  inline uint64_t getEstimatedTimeInUs(uint32_t clockFrequencyInHz) const
+  {
+    return (m_estimatedCycleCount * 1000000u) / clockFrequencyInHz;
+  }
+
+  //! Returns number of transfers rendered since the last reset
+  inline uint32_t getTransferCount(void) const
+  {
+    return m_transferCount;
+  }
+
+  inline void resetStatistics(void)
+  {
+    m_estimatedCycleCount = 0u;
+    m_transferCount       = 0u;
+  }
+
+  static uint32_t estimateFillRectangleCycleCount(const FillRectangleConfig &fillRectangleConfig);
+  static uint32_t estimateCopyBitmapCycleCount(const CopyBitmapConfig &copyBitmapConfig);
+  static uint32_t estimateBlendBitmapCycleCount(const BlendBitmapConfig &blendBitmapConfig);
+
+private:
+
+  enum class CommandType : uint8_t
+  {
+    FILL_RECTANGLE = 0u,
+    COPY_BITMAP    = 1u,
+    BLEND_BITMAP   = 2u
+  };
+
+  struct Command
+  {
+    CommandType type;
+
+    union
+    {
+      FillRectangleConfig fillRectangleConfig;
+      CopyBitmapConfig copyBitmapConfig;
+      BlendBitmapConfig blendBitmapConfig;
+    };
+  };
+
+  //! Color with all components expanded to 8 bits
+  struct ARGB8888Color
+  {
+    uint8_t alpha;
+    uint8_t red;
+    uint8_t green;
+    uint8_t blue;
+  };
+
+  ErrorCode startCommand(const Command &command, const CallbackDescription &callback);
+  ErrorCode enqueueCommand(const Command &command);
+  void startNextCommandFromQueue(void);
+
+  void render(const Command &command);
+  void renderFillRectangle(const FillRectangleConfig &fillRectangleConfig);
+  void renderCopyBitmap(const CopyBitmapConfig &copyBitmapConfig);
+  void renderBlendBitmap(const BlendBitmapConfig &blendBitmapConfig);
+
+  uint32_t estimateCycleCount(const Command &command) const;
+
+  static uint32_t estimateCycleCount(Dimension dimension, uint32_t bitsPerPixel, uint32_t cyclesPerPixel);
+
+  static ErrorCode checkFillRectangleConfig(const FillRectangleConfig &fillRectangleConfig);
+
+  static ARGB8888Color readPixel(const InputBufferConfiguration &bufferConfig, uint32_t pixelIdx);
+  static void writePixel(const OutputBufferConfiguration &bufferConfig, uint32_t pixelIdx, ARGB8888Color color);
+
+  static ARGB8888Color blend(ARGB8888Color foreground, ARGB8888Color background);
+
+  static uint32_t packColor(OutputColorFormat colorFormat, Color color);
+  static Color getMaximumColorValue(OutputColorFormat colorFormat);
+  static bool isRedBlueSwapped(OutputColorFormat colorFormat);
+  static bool isRedBlueSwapped(InputColorFormat colorFormat);
+
+  static uint8_t getBitsPerPixel(OutputColorFormat colorFormat);
+  static uint8_t getBitsPerPixel(InputColorFormat colorFormat);
+
+  static uint32_t loadValue(const uint8_t *bufferPtr, uint32_t pixelIdx, uint8_t bitsPerPixel);
+  static void storeValue(uint8_t *bufferPtr, uint32_t pixelIdx, uint8_t bitsPerPixel, uint32_t value);
+
+  static uint8_t expandComponent(uint32_t component, uint8_t componentSize);
+
+  static inline uint32_t getPixelIdx(Position position, Dimension bufferDimension, uint16_t column, uint16_t row)
+  {
+    return (static_cast<uint32_t>(position.y) + row) * bufferDimension.width + position.x + column;
+  }
+
+  //! Transfer being executed, rendered once IRQHandler is called
+  Command m_ongoingCommand;
+
+  bool m_isTransferOngoing;
+
+  bool m_isCommandQueueExecuting;
+
+  //! Callback called once the ongoing transfer or the whole command queue is completed
+  CallbackDescription m_completedCallback;
+
+  Command m_commandQueue[COMMAND_QUEUE_CAPACITY];
+
+  uint32_t m_commandQueueHead;
+
+  uint32_t m_commandQueueSize;
+
+  //! CLUT currently loaded into the foreground CLUT memory, loading a different one costs extra cycles
+  const void *m_loadedCLUTPtr;
+
+  uint64_t m_estimatedCycleCount;
+
+  uint32_t m_transferCount;
+};
+
+inline DMA2D::ErrorCode DMA2DEmulator::init(void)
+{
+  if (m_isTransferOngoing)
+  {
+    return ErrorCode::BUSY;
+  }
+
+  m_loadedCLUTPtr = nullptr;
+
+  return ErrorCode::OK;
+}
+
+inline DMA2D::ErrorCode DMA2DEmulator::fillRectangle(const FillRectangleConfig &fillRectangleConfig)
+{
+  ErrorCode errorCode = checkFillRectangleConfig(fillRectangleConfig);
+  if (ErrorCode::OK != errorCode)
+  {
+    return errorCode;
+  }
+
+  Command command;
+  command.type                = CommandType::FILL_RECTANGLE;
+  command.fillRectangleConfig = fillRectangleConfig;
+
+  return startCommand(command, fillRectangleConfig.drawCompletedCallback);
+}
+
+inline DMA2D::ErrorCode DMA2DEmulator::copyBitmap(const CopyBitmapConfig &copyBitmapConfig)
+{
+  Command command;
+  command.type             = CommandType::COPY_BITMAP;
+  command.copyBitmapConfig = copyBitmapConfig;
+
+  return startCommand(command, copyBitmapConfig.drawCompletedCallback);
+}
+
+inline DMA2D::ErrorCode DMA2DEmulator::blendBitmap(const BlendBitmapConfig &blendBitmapConfig)
+{
+  Command command;
+  command.type              = CommandType::BLEND_BITMAP;
+  command.blendBitmapConfig = blendBitmapConfig;
+
+  return startCommand(command, blendBitmapConfig.drawCompletedCallback);
+}
+
+inline DMA2D::ErrorCode DMA2DEmulator::enqueueFillRectangle(const FillRectangleConfig &fillRectangleConfig)
+{
+  ErrorCode errorCode = checkFillRectangleConfig(fillRectangleConfig);
+  if (ErrorCode::OK != errorCode)
+  {
+    return errorCode;
+  }
+
+  Command command;
+  command.type                = CommandType::FILL_RECTANGLE;
+  command.fillRectangleConfig = fillRectangleConfig;
+
+  return enqueueCommand(command);
+}
+
+inline DMA2D::ErrorCode DMA2DEmulator::enqueueCopyBitmap(const CopyBitmapConfig &copyBitmapConfig)
+{
+  Command command;
+  command.type             = CommandType::COPY_BITMAP;
+  command.copyBitmapConfig = copyBitmapConfig;
+
+  return enqueueCommand(command);
+}
+
+inline DMA2D::ErrorCode DMA2DEmulator::enqueueBlendBitmap(const BlendBitmapConfig &blendBitmapConfig)
+{
+  Command command;
+  command.type              = CommandType::BLEND_BITMAP;
+  command.blendBitmapConfig = blendBitmapConfig;
+
+  return enqueueCommand(command);
+}
+
+inline DMA2D::ErrorCode DMA2DEmulator::executeCommandQueue(const CallbackDescription &queueCompletedCallback)
+{
+  if (m_isTransferOngoing)
+  {
+    return ErrorCode::BUSY;
+  }
+
+  m_completedCallback = queueCompletedCallback;
+
+  if (0u == m_commandQueueSize)
+  {
+    if (nullptr != m_completedCallback.functionPtr)
+    {
+      m_completedCallback.functionPtr(m_completedCallback.argument);
+    }
+  }
+  else
+  {
+    m_isTransferOngoing       = true;
+    m_isCommandQueueExecuting = true;
+    startNextCommandFromQueue();
+  }
+
+  return ErrorCode::OK;
+}
+
+inline uint32_t DMA2DEmulator::getNumberOfEnqueuedCommands(void) const
+{
+  return m_commandQueueSize;
+}
+
+inline bool DMA2DEmulator::isTransferOngoing(void) const
+{
+  return m_isTransferOngoing;
+}
+
+inline void DMA2DEmulator::IRQHandler(void)
+{
+  if (not m_isTransferOngoing)
+  {
+    return;
+  }
+
+  render(m_ongoingCommand);
+
+  if (m_isCommandQueueExecuting && (0u != m_commandQueueSize))
+  {
+    startNextCommandFromQueue();
+  }
+  else
+  {
+    m_isTransferOngoing       = false;
+    m_isCommandQueueExecuting = false;
+
+    if (nullptr != m_completedCallback.functionPtr)
+    {
+      m_completedCallback.functionPtr(m_completedCallback.argument);
+    }
+  }
+}
+
+inline uint32_t DMA2DEmulator::completeAllTransfers(void)
+{
+  const uint32_t initialTransferCount = m_transferCount;
+
+  // a callback is allowed to start a new transfer, it is completed as well
+  while (m_isTransferOngoing)
+  {
+    IRQHandler();
+  }
+
+  return m_transferCount - initialTransferCount;
+}
+
+inline DMA2D::ErrorCode DMA2DEmulator::startCommand(const Command &command, const CallbackDescription &callback)
+{
+  if (m_isTransferOngoing)
+  {
+    return ErrorCode::BUSY;
+  }
+
+  m_ongoingCommand    = command;
+  m_completedCallback = callback;
+  m_isTransferOngoing = true;
+
+  return ErrorCode::OK;
+}
+
+inline DMA2D::ErrorCode DMA2DEmulator::enqueueCommand(const Command &command)
+{
+  if (m_isCommandQueueExecuting)
+  {
+    return ErrorCode::BUSY;
+  }
+
+  if (COMMAND_QUEUE_CAPACITY == m_commandQueueSize)
+  {
+    return ErrorCode::COMMAND_QUEUE_FULL;
+  }
+
+  m_commandQueue[(m_commandQueueHead + m_commandQueueSize) % COMMAND_QUEUE_CAPACITY] = command;
+  ++m_commandQueueSize;
+
+  return ErrorCode::OK;
+}
+
+inline void DMA2DEmulator::startNextCommandFromQueue(void)
+{
+  m_ongoingCommand = m_commandQueue[m_commandQueueHead];
+
+  m_commandQueueHead = (m_commandQueueHead + 1u) % COMMAND_QUEUE_CAPACITY;
+  --m_commandQueueSize;
+}
+
+inline void DMA2DEmulator::render(const Command &command)
+{
+  m_estimatedCycleCount += estimateCycleCount(command);
+  ++m_transferCount;
+
+  const CLUTConfiguration *clutConfigPtr = nullptr;
+  if (CommandType::COPY_BITMAP == command.type)
+  {
+    clutConfigPtr = &command.copyBitmapConfig.sourceBufferConfig.clutConfig;
+  }
+  else if (CommandType::BLEND_BITMAP == command.type)
+  {
+    clutConfigPtr = &command.blendBitmapConfig.foregroundBufferConfig.clutConfig;
+  }
+
+  if ((nullptr != clutConfigPtr) && (0u != clutConfigPtr->size))
+  {
+    m_loadedCLUTPtr = clutConfigPtr->clutPtr;
+  }
+
+  switch (command.type)
+  {
+    case CommandType::FILL_RECTANGLE:
+      renderFillRectangle(command.fillRectangleConfig);
+      break;
+
+    case CommandType::COPY_BITMAP:
+      renderCopyBitmap(command.copyBitmapConfig);
+      break;
+
+    case CommandType::BLEND_BITMAP:
+    default:
+      renderBlendBitmap(command.blendBitmapConfig);
+      break;
+  }
+}
+
+inline void DMA2DEmulator::renderFillRectangle(const FillRectangleConfig &fillRectangleConfig)
+{
+  const OutputBufferConfiguration &destination = fillRectangleConfig.destinationBufferConfig;
+  const uint8_t bitsPerPixel = getBitsPerPixel(destination.colorFormat);
+  const uint32_t value = packColor(destination.colorFormat, fillRectangleConfig.color);
+
+  for (uint16_t row = 0u; row < fillRectangleConfig.dimension.height; ++row)
+  {
+    for (uint16_t column = 0u; column < fillRectangleConfig.dimension.width; ++column)
+    {
+      const uint32_t pixelIdx = getPixelIdx(fillRectangleConfig.position, destination.bufferDimension, column, row);
+      storeValue(reinterpret_cast<uint8_t*>(destination.bufferPtr), pixelIdx, bitsPerPixel, value);
+    }
+  }
+}
+
+inline void DMA2DEmulator::renderCopyBitmap(const CopyBitmapConfig &copyBitmapConfig)
+{
+  for (uint16_t row = 0u; row < copyBitmapConfig.dimension.height; ++row)
+  {
+    for (uint16_t column = 0u; column < copyBitmapConfig.dimension.width; ++column)
+    {
+      const ARGB8888Color color = readPixel(copyBitmapConfig.sourceBufferConfig,
+        getPixelIdx(copyBitmapConfig.sourceRectanglePosition,
+          copyBitmapConfig.sourceBufferConfig.bufferDimension, column, row));
+
+      writePixel(copyBitmapConfig.destinationBufferConfig,
+        getPixelIdx(copyBitmapConfig.destinationRectanglePosition,
+          copyBitmapConfig.destinationBufferConfig.bufferDimension, column, row),
+        color);
+    }
+  }
+}
+
+inline void DMA2DEmulator::renderBlendBitmap(const BlendBitmapConfig &blendBitmapConfig)
+{
+  // background CLUT and BGCOLR are never loaded by the driver, so indexed background formats are read as
+  // transparent black and alpha only background formats as black
+  InputBufferConfiguration backgroundBufferConfig = blendBitmapConfig.backgroundBufferConfig;
+  backgroundBufferConfig.clutConfig = { .colorFormat = CLUTColorFormat::ARGB8888, .size = 0u, .clutPtr = nullptr };
+  backgroundBufferConfig.color      = { .alpha = 0u, .red = 0u, .green = 0u, .blue = 0u };
+
+  for (uint16_t row = 0u; row < blendBitmapConfig.dimension.height; ++row)
+  {
+    for (uint16_t column = 0u; column < blendBitmapConfig.dimension.width; ++column)
+    {
+      const ARGB8888Color foreground = readPixel(blendBitmapConfig.foregroundBufferConfig,
+        getPixelIdx(blendBitmapConfig.foregroundRectanglePosition,
+          blendBitmapConfig.foregroundBufferConfig.bufferDimension, column, row));
+
+      const ARGB8888Color background = readPixel(backgroundBufferConfig,
+        getPixelIdx(blendBitmapConfig.backgroundRectanglePosition,
+          backgroundBufferConfig.bufferDimension, column, row));
+
+      writePixel(blendBitmapConfig.destinationBufferConfig,
+        getPixelIdx(blendBitmapConfig.destinationRectanglePosition,
+          blendBitmapConfig.destinationBufferConfig.bufferDimension, column, row),
+        blend(foreground, background));
+    }
+  }
+}
+
+inline uint32_t DMA2DEmulator::estimateFillRectangleCycleCount(const FillRectangleConfig &fillRectangleConfig)
+{
+  // register to memory, only the output stage writes to the bus
+  return estimateCycleCount(fillRectangleConfig.dimension,
+    getBitsPerPixel(fillRectangleConfig.destinationBufferConfig.colorFormat), 0u);
+}
+
+inline uint32_t DMA2DEmulator::estimateCopyBitmapCycleCount(const CopyBitmapConfig &copyBitmapConfig)
+{
+  const uint32_t bitsPerPixel = getBitsPerPixel(copyBitmapConfig.sourceBufferConfig.colorFormat) +
+    getBitsPerPixel(copyBitmapConfig.destinationBufferConfig.colorFormat);
+
+  return estimateCycleCount(copyBitmapConfig.dimension, bitsPerPixel, 1u);
+}
+
+inline uint32_t DMA2DEmulator::estimateBlendBitmapCycleCount(const BlendBitmapConfig &blendBitmapConfig)
+{
+  const uint32_t bitsPerPixel = getBitsPerPixel(blendBitmapConfig.foregroundBufferConfig.colorFormat) +
+    getBitsPerPixel(blendBitmapConfig.backgroundBufferConfig.colorFormat) +
+    getBitsPerPixel(blendBitmapConfig.destinationBufferConfig.colorFormat);
+
+  return estimateCycleCount(blendBitmapConfig.dimension, bitsPerPixel, 2u);
+}
+
+inline uint32_t DMA2DEmulator::estimateCycleCount(const Command &command) const
+{
+  switch (command.type)
+  {
+    case CommandType::FILL_RECTANGLE:
+      return estimateFillRectangleCycleCount(command.fillRectangleConfig);
+
+    case CommandType::COPY_BITMAP:
+    {
+      const CLUTConfiguration &clutConfig = command.copyBitmapConfig.sourceBufferConfig.clutConfig;
+      const uint32_t clutLoadCycles = ((0u != clutConfig.size) && (clutConfig.clutPtr != m_loadedCLUTPtr)) ?
+        clutConfig.size : 0u;
+
+      return clutLoadCycles + estimateCopyBitmapCycleCount(command.copyBitmapConfig);
+    }
+
+    case CommandType::BLEND_BITMAP:
+    default:
+    {
+      const CLUTConfiguration &clutConfig = command.blendBitmapConfig.foregroundBufferConfig.clutConfig;
+      const uint32_t clutLoadCycles = ((0u != clutConfig.size) && (clutConfig.clutPtr != m_loadedCLUTPtr)) ?
+        clutConfig.size : 0u;
+
+      return clutLoadCycles + estimateBlendBitmapCycleCount(command.blendBitmapConfig);
+    }
+  }
+}
+
+inline uint32_t DMA2DEmulator::estimateCycleCount(Dimension dimension, uint32_t bitsPerPixel, uint32_t cyclesPerPixel)
+{
+  // each line is bounded either by the pixel pipeline or by the 32 bit bus accesses it needs
+  const uint32_t pipelineCycles = cyclesPerPixel * dimension.width;
+  const uint32_t busCycles      = (bitsPerPixel * dimension.width + 31u) / 32u;
+  const uint32_t lineCycles     = ((pipelineCycles > busCycles) ? pipelineCycles : busCycles) + LINE_OVERHEAD_CYCLES;
+
+  return TRANSFER_SETUP_CYCLES + lineCycles * dimension.height;
+}
+
+inline DMA2D::ErrorCode DMA2DEmulator::checkFillRectangleConfig(const FillRectangleConfig &fillRectangleConfig)
+{
+  const Color maximumColorValue = getMaximumColorValue(fillRectangleConfig.destinationBufferConfig.colorFormat);
+
+  if ((maximumColorValue.alpha < fillRectangleConfig.color.alpha) ||
+      (maximumColorValue.red   < fillRectangleConfig.color.red)   ||
+      (maximumColorValue.green < fillRectangleConfig.color.green) ||
+      (maximumColorValue.blue  < fillRectangleConfig.color.blue))
+  {
+    return ErrorCode::COLOR_VALUE_OUT_OF_RANGE;
+  }
+
+  return ErrorCode::OK;
+}
+
+inline DMA2DEmulator::ARGB8888Color DMA2DEmulator::readPixel(
+  const InputBufferConfiguration &bufferConfig,
+  uint32_t pixelIdx)
+{
+  const uint32_t value =
+    loadValue(reinterpret_cast<const uint8_t*>(bufferConfig.bufferPtr), pixelIdx, getBitsPerPixel(bufferConfig.colorFormat));
+
+  ARGB8888Color color = { .alpha = 255u, .red = 0u, .green = 0u, .blue = 0u };
+  uint32_t colorIdx = 0u;
+  bool isIndexed = false;
+
+  switch (bufferConfig.colorFormat)
+  {
+    case InputColorFormat::ARGB8888:
+    case InputColorFormat::ABGR8888:
+      color.alpha = static_cast<uint8_t>(value >> 24u);
+      // fall through
+    case InputColorFormat::RGB888:
+    case InputColorFormat::BGR888:
+    {
+      color.red   = static_cast<uint8_t>(value >> 16u);
+      color.green = static_cast<uint8_t>(value >> 8u);
+      color.blue  = static_cast<uint8_t>(value);
+    }
+    break;
+
+    case InputColorFormat::RGB565:
+    case InputColorFormat::BGR565:
+    {
+      color.red   = expandComponent(value >> 11u, 5u);
+      color.green = expandComponent(value >> 5u, 6u);
+      color.blue  = expandComponent(value, 5u);
+    }
+    break;
+
+    case InputColorFormat::ARGB1555:
+    case InputColorFormat::ABGR1555:
+    {
+      color.alpha = expandComponent(value >> 15u, 1u);
+      color.red   = expandComponent(value >> 10u, 5u);
+      color.green = expandComponent(value >> 5u, 5u);
+      color.blue  = expandComponent(value, 5u);
+    }
+    break;
+
+    case InputColorFormat::ARGB4444:
+    case InputColorFormat::ABGR4444:
+    {
+      color.alpha = expandComponent(value >> 12u, 4u);
+      color.red   = expandComponent(value >> 8u, 4u);
+      color.green = expandComponent(value >> 4u, 4u);
+      color.blue  = expandComponent(value, 4u);
+    }
+    break;
+
+    case InputColorFormat::L8:
+    case InputColorFormat::L4:
+    {
+      colorIdx  = value;
+      isIndexed = true;
+    }
+    break;
+
+    case InputColorFormat::AL44:
+    {
+      color.alpha = expandComponent(value >> 4u, 4u);
+      colorIdx    = value & 0x0Fu;
+      isIndexed   = true;
+    }
+    break;
+
+    case InputColorFormat::AL88:
+    {
+      color.alpha = static_cast<uint8_t>(value >> 8u);
+      colorIdx    = value & 0xFFu;
+      isIndexed   = true;
+    }
+    break;
+
+    // alpha only formats take their color from FGCOLR, which the driver sets to color of the buffer configuration
+    case InputColorFormat::A8:
+    case InputColorFormat::A4:
+    {
+      color.alpha = (InputColorFormat::A8 == bufferConfig.colorFormat) ?
+        static_cast<uint8_t>(value) : expandComponent(value, 4u);
+      color.red   = bufferConfig.color.red;
+      color.green = bufferConfig.color.green;
+      color.blue  = bufferConfig.color.blue;
+    }
+    break;
+
+    default:
+      // do nothing
+      break;
+  }
+
+  if (isIndexed)
+  {
+    const CLUTConfiguration &clutConfig = bufferConfig.clutConfig;
+
+    if ((nullptr == clutConfig.clutPtr) || (colorIdx >= clutConfig.size))
+    {
+      return { .alpha = 0u, .red = 0u, .green = 0u, .blue = 0u };
+    }
+
+    const uint32_t clutColor = (CLUTColorFormat::ARGB8888 == clutConfig.colorFormat) ?
+      reinterpret_cast<const uint32_t*>(clutConfig.clutPtr)[colorIdx] :
+      (0xFF000000u | loadValue(reinterpret_cast<const uint8_t*>(clutConfig.clutPtr), colorIdx, 24u));
+
+    // alpha of AL44 and AL88 pixels replaces alpha of the CLUT entry
+    if ((InputColorFormat::L8 == bufferConfig.colorFormat) || (InputColorFormat::L4 == bufferConfig.colorFormat))
+    {
+      color.alpha = static_cast<uint8_t>(clutColor >> 24u);
+    }
+    color.red   = static_cast<uint8_t>(clutColor >> 16u);
+    color.green = static_cast<uint8_t>(clutColor >> 8u);
+    color.blue  = static_cast<uint8_t>(clutColor);
+  }
+
+  if (isRedBlueSwapped(bufferConfig.colorFormat))
+  {
+    const uint8_t red = color.red;
+    color.red  = color.blue;
+    color.blue = red;
+  }
+
+  return color;
+}
+
+inline void DMA2DEmulator::writePixel(
+  const OutputBufferConfiguration &bufferConfig,
+  uint32_t pixelIdx,
+  ARGB8888Color color)
+{
+  const Color maximumColorValue = getMaximumColorValue(bufferConfig.colorFormat);
+
+  // output PFC truncates components to the size of the output format
+  const Color outputColor =
+  {
+    .alpha = static_cast<uint8_t>((0u == maximumColorValue.alpha) ? 0u : (color.alpha >> (8u - __builtin_popcount(maximumColorValue.alpha)))),
+    .red   = static_cast<uint8_t>(color.red   >> (8u - __builtin_popcount(maximumColorValue.red))),
+    .green = static_cast<uint8_t>(color.green >> (8u - __builtin_popcount(maximumColorValue.green))),
+    .blue  = static_cast<uint8_t>(color.blue  >> (8u - __builtin_popcount(maximumColorValue.blue)))
+  };
+
+  storeValue(reinterpret_cast<uint8_t*>(bufferConfig.bufferPtr),
+    pixelIdx,
+    getBitsPerPixel(bufferConfig.colorFormat),
+    packColor(bufferConfig.colorFormat, outputColor));
+}
+
+inline DMA2DEmulator::ARGB8888Color DMA2DEmulator::blend(ARGB8888Color foreground, ARGB8888Color background)
+{
+  // blending equations from the reference manual, without any alpha modification
+  const uint32_t alphaMult = (foreground.alpha * background.alpha) / 255u;
+  const uint32_t alphaOut  = foreground.alpha + background.alpha - alphaMult;
+
+  if (0u == alphaOut)
+  {
+    return { .alpha = 0u, .red = 0u, .green = 0u, .blue = 0u };
+  }
+
+  auto blendComponent = [&](uint8_t foregroundComponent, uint8_t backgroundComponent) -> uint8_t
+  {
+    return static_cast<uint8_t>((foregroundComponent * foreground.alpha + backgroundComponent * background.alpha -
+      backgroundComponent * alphaMult) / alphaOut);
+  };
+
+  return
+  {
+    .alpha = static_cast<uint8_t>(alphaOut),
+    .red   = blendComponent(foreground.red, background.red),
+    .green = blendComponent(foreground.green, background.green),
+    .blue  = blendComponent(foreground.blue, background.blue)
+  };
+}
+
+inline uint32_t DMA2DEmulator::packColor(OutputColorFormat colorFormat, Color color)
+{
+  if (isRedBlueSwapped(colorFormat))
+  {
+    const uint8_t red = color.red;
+    color.red  = color.blue;
+    color.blue = red;
+  }
+
+  switch (colorFormat)
+  {
+    case OutputColorFormat::ARGB8888:
+    case OutputColorFormat::ABGR8888:
+    case OutputColorFormat::RGB888:
+    case OutputColorFormat::BGR888:
+      return (static_cast<uint32_t>(color.alpha) << 24u) | (color.red << 16u) | (color.green << 8u) | color.blue;
+
+    case OutputColorFormat::RGB565:
+    case OutputColorFormat::BGR565:
+      return (color.red << 11u) | (color.green << 5u) | color.blue;
+
+    case OutputColorFormat::ARGB1555:
+    case OutputColorFormat::ABGR1555:
+      return (color.alpha << 15u) | (color.red << 10u) | (color.green << 5u) | color.blue;
+
+    case OutputColorFormat::ARGB4444:
+    case OutputColorFormat::ABGR4444:
+    default:
+      return (color.alpha << 12u) | (color.red << 8u) | (color.green << 4u) | color.blue;
+  }
+}
+
+inline DMA2D::Color DMA2DEmulator::getMaximumColorValue(OutputColorFormat colorFormat)
+{
+  switch (colorFormat)
+  {
+    case OutputColorFormat::ARGB8888:
+    case OutputColorFormat::ABGR8888:
+      return { .alpha = 255u, .red = 255u, .green = 255u, .blue = 255u };
+
+    case OutputColorFormat::RGB888:
+    case OutputColorFormat::BGR888:
+      return { .alpha = 0u, .red = 255u, .green = 255u, .blue = 255u };
+
+    case OutputColorFormat::RGB565:
+    case OutputColorFormat::BGR565:
+      return { .alpha = 0u, .red = 31u, .green = 63u, .blue = 31u };
+
+    case OutputColorFormat::ARGB1555:
+    case OutputColorFormat::ABGR1555:
+      return { .alpha = 1u, .red = 31u, .green = 31u, .blue = 31u };
+
+    case OutputColorFormat::ARGB4444:
+    case OutputColorFormat::ABGR4444:
+    default:
+      return { .alpha = 15u, .red = 15u, .green = 15u, .blue = 15u };
+  }
+}
+
+inline bool DMA2DEmulator::isRedBlueSwapped(OutputColorFormat colorFormat)
+{
+  return 0u != (static_cast<uint8_t>(colorFormat) & 0b1000u);
+}
+
+inline bool DMA2DEmulator::isRedBlueSwapped(InputColorFormat colorFormat)
+{
+  return 0u != (static_cast<uint8_t>(colorFormat) & 0b10000u);
+}
+
+inline uint8_t DMA2DEmulator::getBitsPerPixel(OutputColorFormat colorFormat)
+{
+  switch (colorFormat)
+  {
+    case OutputColorFormat::ARGB8888:
+    case OutputColorFormat::ABGR8888:
+      return 32u;
+
+    case OutputColorFormat::RGB888:
+    case OutputColorFormat::BGR888:
+      return 24u;
+
+    default:
+      return 16u;
+  }
+}
+
+inline uint8_t DMA2DEmulator::getBitsPerPixel(InputColorFormat colorFormat)
+{
+  switch (colorFormat)
+  {
+    case InputColorFormat::ARGB8888:
+    case InputColorFormat::ABGR8888:
+      return 32u;
+
+    case InputColorFormat::RGB888:
+    case InputColorFormat::BGR888:
+      return 24u;
+
+    case InputColorFormat::L8:
+    case InputColorFormat::AL44:
+    case InputColorFormat::A8:
+      return 8u;
+
+    case InputColorFormat::L4:
+    case InputColorFormat::A4:
+      return 4u;
+
+    default:
+      return 16u;
+  }
+}
+
+inline uint32_t DMA2DEmulator::loadValue(const uint8_t *bufferPtr, uint32_t pixelIdx, uint8_t bitsPerPixel)
+{
+  if (4u == bitsPerPixel)
+  {
+    // the first pixel of a byte is stored in its lower nibble
+    const uint8_t value = bufferPtr[pixelIdx / 2u];
+    return (0u == (pixelIdx % 2u)) ? (value & 0x0Fu) : (value >> 4u);
+  }
+
+  const uint32_t bytesPerPixel = bitsPerPixel / 8u;
+  const uint8_t *pixelPtr = bufferPtr + pixelIdx * bytesPerPixel;
+
+  uint32_t value = 0u;
+  for (uint32_t byteIdx = 0u; byteIdx < bytesPerPixel; ++byteIdx)
+  {
+    value |= static_cast<uint32_t>(pixelPtr[byteIdx]) << (8u * byteIdx);
+  }
+
+  return value;
+}
+
+inline void DMA2DEmulator::storeValue(uint8_t *bufferPtr, uint32_t pixelIdx, uint8_t bitsPerPixel, uint32_t value)
+{
+  const uint32_t bytesPerPixel = bitsPerPixel / 8u;
+  uint8_t *pixelPtr = bufferPtr + pixelIdx * bytesPerPixel;
+
+  for (uint32_t byteIdx = 0u; byteIdx < bytesPerPixel; ++byteIdx)
+  {
+    pixelPtr[byteIdx] = static_cast<uint8_t>(value >> (8u * byteIdx));
+  }
+}
+
+inline uint8_t DMA2DEmulator::expandComponent(uint32_t component, uint8_t componentSize)
+{
+  const uint32_t mask = (1u << componentSize) - 1u;
+  component &= mask;
+
+  // upper bits are replicated into the lower ones, so the maximum value stays the maximum value
+  uint32_t expandedComponent = 0u;
+  for (int32_t shift = 8 - componentSize; shift > -static_cast<int32_t>(componentSize); shift -= componentSize)
+  {
+    expandedComponent |= (shift >= 0) ? (component << shift) : (component >> -shift);
+  }
+
+  return static_cast<uint8_t>(expandedComponent);
+}
+
+#endif // #ifndef DMA2D_EMULATOR_H
\ No newline at end of file
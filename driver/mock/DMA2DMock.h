@@ -30,6 +30,11 @@ public:
   MOCK_METHOD(ErrorCode, fillRectangle, (const FillRectangleConfig &), (override));
   MOCK_METHOD(ErrorCode, copyBitmap, (const CopyBitmapConfig &), (override));
   MOCK_METHOD(ErrorCode, blendBitmap, (const BlendBitmapConfig &), (override));
+  MOCK_METHOD(ErrorCode, enqueueFillRectangle, (const FillRectangleConfig &), (override));
+  MOCK_METHOD(ErrorCode, enqueueCopyBitmap, (const CopyBitmapConfig &), (override));
+  MOCK_METHOD(ErrorCode, enqueueBlendBitmap, (const BlendBitmapConfig &), (override));
+  MOCK_METHOD(ErrorCode, executeCommandQueue, (const CallbackDescription &), (override));
+  MOCK_METHOD(uint32_t, getNumberOfEnqueuedCommands, (), (override, const));
   MOCK_METHOD(bool, isTransferOngoing, (), (override, const));
   MOCK_METHOD(void, IRQHandler, (), (override));
 
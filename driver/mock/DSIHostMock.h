@@ -29,7 +29,16 @@ public:
   MOCK_METHOD(ErrorCode, dcsShortWrite, (VirtualChannelID, uint8_t, uint8_t), (override));
   MOCK_METHOD(ErrorCode, genericLongWrite, (VirtualChannelID, const void *, uint16_t), (override));
   MOCK_METHOD(ErrorCode, dcsLongWrite, (VirtualChannelID, uint8_t, const void *, uint16_t), (override));
+  MOCK_METHOD(ErrorCode, startTransferFromLTDC, (), (override));
+  MOCK_METHOD(ErrorCode, startTransferFromLTDCOnTearingEffect, (), (override));
+  MOCK_METHOD(bool, isWaitingForTearingEffect, (), (const, override));
+  MOCK_METHOD(void, cancelWaitForTearingEffect, (), (override));
+  MOCK_METHOD(bool, isTransferFromLTDCOngoing, (), (const, override));
+  MOCK_METHOD(void, setMaximumLTDCWriteMemoryCommandSize, (uint16_t), (override));
   MOCK_METHOD(ErrorCode, getDSIPHYClockFrequency, (uint32_t &), (override));
+  MOCK_METHOD(void, registerEndOfRefreshCallback, (const CallbackDescription &), (override));
+  MOCK_METHOD(void, unregisterEndOfRefreshCallback, (), (override));
+  MOCK_METHOD(void, IRQHandler, (), (override));
 };
 
 #endif // #ifndef DSI_HOST_MOCK_H
\ No newline at end of file
@@ -0,0 +1,42 @@
+#ifndef LTDC_MOCK_H
+#define LTDC_MOCK_H
+
+#include "LTDC.h"
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <cstdint>
+
+
+using namespace ::testing;
+
+
+class LTDCMock : public LTDC
+{
+public:
+
+  LTDCMock():
+    LTDC(nullptr, nullptr)
+  {}
+
+  virtual ~LTDCMock() = default;
+
+  // mock methods
+  MOCK_METHOD(ErrorCode, init, (const LTDCConfig &, const LTDCLayerConfig &), (override));
+  MOCK_METHOD(void, setFrameBufferAddress, (Layer, void *), (override));
+  MOCK_METHOD(void, configureLayer, (Layer, const LTDCLayerConfig &, Position), (override));
+  MOCK_METHOD(void, enableLayer, (Layer), (override));
+  MOCK_METHOD(void, disableLayer, (Layer), (override));
+  MOCK_METHOD(void, setLayerWindowPosition, (Layer, Position), (override));
+  MOCK_METHOD(void, setLayerConstantAlpha, (Layer, uint8_t), (override));
+  MOCK_METHOD(void, setLayerBlendingFactors, (Layer, BlendingFactor, BlendingFactor), (override));
+  MOCK_METHOD(void, setDisplayWindow, (Position, Dimension), (override));
+  MOCK_METHOD(void, reloadOnVerticalBlank, (), (override));
+  MOCK_METHOD(void, reloadOnVerticalBlank, (const CallbackDescription &), (override));
+  MOCK_METHOD(void, reloadImmediately, (), (override));
+  MOCK_METHOD(bool, isReloadOngoing, (), (const, override));
+  MOCK_METHOD(void, enableLineInterrupt, (uint16_t, const CallbackDescription &), (override));
+  MOCK_METHOD(void, disableLineInterrupt, (), (override));
+  MOCK_METHOD(void, IRQHandler, (), (override));
+};
+
+#endif // #ifndef LTDC_MOCK_H
\ No newline at end of file
@@ -30,6 +30,14 @@ DMA2D::DMA2D(DMA2D_TypeDef *DMA2DPeripheralPtr, ResetControl *resetControlPtr):
   m_drawCompletedCallback{
     .functionPtr = nullptr,
     .argument    = nullptr
+  },
+  m_commandQueueHead(0u),
+  m_commandQueueSize(0u),
+  m_isCommandQueueExecuting(false),
+  m_foregroundCLUTConfig{
+    .colorFormat = CLUTColorFormat::ARGB8888,
+    .size        = 0u,
+    .clutPtr     = nullptr
   }
 {}
 
@@ -50,6 +58,9 @@ DMA2D::ErrorCode DMA2D::init(void)
   setLineOffsetModeToBytes(registerValueCR);
   MemoryAccess::setRegisterValue(&(m_DMA2DPeripheralPtr->CR), registerValueCR);
 
+  // content of the CLUT memory is unknown after initialization
+  m_foregroundCLUTConfig.clutPtr = nullptr;
+
   return ErrorCode::OK;
 }
 
@@ -68,7 +79,141 @@ DMA2D::ErrorCode DMA2D::fillRectangle(const FillRectangleConfig &fillRectangleCo
   }
 
   setDrawCompletedCallback(fillRectangleConfig.drawCompletedCallback);
+  startFillRectangle(fillRectangleConfig);
+
+  return ErrorCode::OK;
+}
+
+DMA2D::ErrorCode DMA2D::copyBitmap(const CopyBitmapConfig &copyBitmapConfig)
+{
+  bool isTransferStarted = startTransfer();
+  if (not isTransferStarted)
+  {
+    return ErrorCode::BUSY;
+  }
+
+  setDrawCompletedCallback(copyBitmapConfig.drawCompletedCallback);
+  startCopyBitmap(copyBitmapConfig);
+
+  return ErrorCode::OK;
+}
+
+DMA2D::ErrorCode DMA2D::blendBitmap(const BlendBitmapConfig &blendBitmapConfig)
+{
+  bool isTransferStarted = startTransfer();
+  if (not isTransferStarted)
+  {
+    return ErrorCode::BUSY;
+  }
+
+  setDrawCompletedCallback(blendBitmapConfig.drawCompletedCallback);
+  startBlendBitmap(blendBitmapConfig);
+
+  return ErrorCode::OK;
+}
+
+DMA2D::ErrorCode DMA2D::enqueueFillRectangle(const FillRectangleConfig &fillRectangleConfig)
+{
+  ErrorCode errorCode = checkFillRectangleConfig(fillRectangleConfig);
+  if (ErrorCode::OK != errorCode)
+  {
+    return errorCode;
+  }
+
+  errorCode = checkIfCommandCanBeEnqueued();
+  if (ErrorCode::OK != errorCode)
+  {
+    return errorCode;
+  }
+
+  Command &command            = allocateCommandQueueEntry();
+  command.type                = CommandType::FILL_RECTANGLE;
+  command.fillRectangleConfig = fillRectangleConfig;
+
+  return ErrorCode::OK;
+}
+
+DMA2D::ErrorCode DMA2D::enqueueCopyBitmap(const CopyBitmapConfig &copyBitmapConfig)
+{
+  ErrorCode errorCode = checkIfCommandCanBeEnqueued();
+  if (ErrorCode::OK != errorCode)
+  {
+    return errorCode;
+  }
 
+  Command &command         = allocateCommandQueueEntry();
+  command.type             = CommandType::COPY_BITMAP;
+  command.copyBitmapConfig = copyBitmapConfig;
+
+  return ErrorCode::OK;
+}
+
+DMA2D::ErrorCode DMA2D::enqueueBlendBitmap(const BlendBitmapConfig &blendBitmapConfig)
+{
+  ErrorCode errorCode = checkIfCommandCanBeEnqueued();
+  if (ErrorCode::OK != errorCode)
+  {
+    return errorCode;
+  }
+
+  Command &command          = allocateCommandQueueEntry();
+  command.type              = CommandType::BLEND_BITMAP;
+  command.blendBitmapConfig = blendBitmapConfig;
+
+  return ErrorCode::OK;
+}
+
+DMA2D::ErrorCode DMA2D::executeCommandQueue(const CallbackDescription &queueCompletedCallback)
+{
+  bool isTransferStarted = startTransfer();
+  if (not isTransferStarted)
+  {
+    return ErrorCode::BUSY;
+  }
+
+  setDrawCompletedCallback(queueCompletedCallback);
+
+  if (0u == m_commandQueueSize)
+  {
+    endTransfer();
+    callDrawCompletedCallbackIfSpecified();
+  }
+  else
+  {
+    m_isCommandQueueExecuting = true;
+    startNextCommandFromQueue();
+  }
+
+  return ErrorCode::OK;
+}
+
+uint32_t DMA2D::getNumberOfEnqueuedCommands(void) const
+{
+  return m_commandQueueSize;
+}
+
+void DMA2D::IRQHandler(void)
+{
+  if (isInterruptEnabled(Interrupt::TRANSFER_COMPLETE) && isFlagSet(Flag::IS_TRANSFER_COMPLETED))
+  {
+    disableInterrupt(Interrupt::TRANSFER_COMPLETE);
+    clearFlag(Flag::IS_TRANSFER_COMPLETED);
+
+    if (m_isCommandQueueExecuting && (0u != m_commandQueueSize))
+    {
+      // chain the next transfer directly, without a round trip through the callback
+      startNextCommandFromQueue();
+    }
+    else
+    {
+      endTransfer();
+      callDrawCompletedCallbackIfSpecified();
+    }
+  }
+}
+
+void DMA2D::startFillRectangle(const FillRectangleConfig &fillRectangleConfig)
+{
   setMode(Mode::REGISTER_TO_MEMORY);
 
   configureOutputStage(fillRectangleConfig.destinationBufferConfig.colorFormat,
@@ -83,27 +228,19 @@ DMA2D::ErrorCode DMA2D::fillRectangle(const FillRectangleConfig &fillRectangleCo
 
   enableInterrupt(Interrupt::TRANSFER_COMPLETE);
   startDMA2D();
-
-  return ErrorCode::OK;
 }
 
-DMA2D::ErrorCode DMA2D::copyBitmap(const CopyBitmapConfig &copyBitmapConfig)
+void DMA2D::startCopyBitmap(const CopyBitmapConfig &copyBitmapConfig)
 {
-  bool isTransferStarted = startTransfer();
-  if (not isTransferStarted)
-  {
-    return ErrorCode::BUSY;
-  }
-
-  setDrawCompletedCallback(copyBitmapConfig.drawCompletedCallback);
-
   setMode(Mode::MEMORY_TO_MEMORY_PFC);
 
   configureForegroundInputStage(copyBitmapConfig.sourceBufferConfig.colorFormat,
     copyBitmapConfig.dimension,
     copyBitmapConfig.sourceRectanglePosition,
     copyBitmapConfig.sourceBufferConfig.bufferDimension,
-    copyBitmapConfig.sourceBufferConfig.bufferPtr);
+    copyBitmapConfig.sourceBufferConfig.bufferPtr,
+    copyBitmapConfig.sourceBufferConfig.clutConfig,
+    copyBitmapConfig.sourceBufferConfig.color);
 
   configureOutputStage(copyBitmapConfig.destinationBufferConfig.colorFormat,
     copyBitmapConfig.dimension,
@@ -115,27 +252,19 @@ DMA2D::ErrorCode DMA2D::copyBitmap(const CopyBitmapConfig &copyBitmapConfig)
 
   enableInterrupt(Interrupt::TRANSFER_COMPLETE);
   startDMA2D();
-
-  return ErrorCode::OK;
 }
 
-DMA2D::ErrorCode DMA2D::blendBitmap(const BlendBitmapConfig &blendBitmapConfig)
+void DMA2D::startBlendBitmap(const BlendBitmapConfig &blendBitmapConfig)
 {
-  bool isTransferStarted = startTransfer();
-  if (not isTransferStarted)
-  {
-    return ErrorCode::BUSY;
-  }
-
-  setDrawCompletedCallback(blendBitmapConfig.drawCompletedCallback);
-
   setMode(Mode::MEMORY_TO_MEMORY_WITH_BLENDING);
 
   configureForegroundInputStage(blendBitmapConfig.foregroundBufferConfig.colorFormat,
     blendBitmapConfig.dimension,
     blendBitmapConfig.foregroundRectanglePosition,
     blendBitmapConfig.foregroundBufferConfig.bufferDimension,
-    blendBitmapConfig.foregroundBufferConfig.bufferPtr);
+    blendBitmapConfig.foregroundBufferConfig.bufferPtr,
+    blendBitmapConfig.foregroundBufferConfig.clutConfig,
+    blendBitmapConfig.foregroundBufferConfig.color);
 
   configureBackgroundInputStage(blendBitmapConfig.backgroundBufferConfig.colorFormat,
     blendBitmapConfig.dimension,
@@ -153,18 +282,58 @@ DMA2D::ErrorCode DMA2D::blendBitmap(const BlendBitmapConfig &blendBitmapConfig)
 
   enableInterrupt(Interrupt::TRANSFER_COMPLETE);
   startDMA2D();
+}
+
+inline DMA2D::ErrorCode DMA2D::checkIfCommandCanBeEnqueued(void) const
+{
+  if (m_isCommandQueueExecuting)
+  {
+    return ErrorCode::BUSY;
+  }
+
+  if (COMMAND_QUEUE_CAPACITY == m_commandQueueSize)
+  {
+    return ErrorCode::COMMAND_QUEUE_FULL;
+  }
 
   return ErrorCode::OK;
 }
 
-void DMA2D::IRQHandler(void)
+inline DMA2D::Command& DMA2D::allocateCommandQueueEntry(void)
 {
-  if (isInterruptEnabled(Interrupt::TRANSFER_COMPLETE) && isFlagSet(Flag::IS_TRANSFER_COMPLETED))
+  const uint32_t commandIdx = (m_commandQueueHead + m_commandQueueSize) % COMMAND_QUEUE_CAPACITY;
+  ++m_commandQueueSize;
+
+  return m_commandQueue[commandIdx];
+}
+
+void DMA2D::startNextCommandFromQueue(void)
+{
+  const Command &command = m_commandQueue[m_commandQueueHead];
+
+  m_commandQueueHead = (m_commandQueueHead + 1u) % COMMAND_QUEUE_CAPACITY;
+  --m_commandQueueSize;
+
+  switch (command.type)
   {
-    disableInterrupt(Interrupt::TRANSFER_COMPLETE);
-    clearFlag(Flag::IS_TRANSFER_COMPLETED);
-    endTransfer();
-    callDrawCompletedCallbackIfSpecified();
+    case CommandType::FILL_RECTANGLE:
+    {
+      startFillRectangle(command.fillRectangleConfig);
+    }
+    break;
+
+    case CommandType::COPY_BITMAP:
+    {
+      startCopyBitmap(command.copyBitmapConfig);
+    }
+    break;
+
+    case CommandType::BLEND_BITMAP:
+    default:
+    {
+      startBlendBitmap(command.blendBitmapConfig);
+    }
+    break;
   }
 }
 
@@ -189,13 +358,24 @@ inline void DMA2D::configureForegroundInputStage(
   Dimension transactionRectangleDimension,
   Position position,
   Dimension bufferDimension,
-  const void *bufferPtr)
+  const void *bufferPtr,
+  const CLUTConfiguration &clutConfig,
+  Color color)
 {
   uint32_t registerValueFGPFCCR = MemoryAccess::getRegisterValue(&(m_DMA2DPeripheralPtr->FGPFCCR));
   setColorFormat<InputColorFormat, 4u>(registerValueFGPFCCR, colorFormat);
   setColorRedBlueSwap<InputColorFormat, 4u>(registerValueFGPFCCR, colorFormat);
+  if (isIndexedColorFormat(colorFormat))
+  {
+    loadForegroundCLUTIfNotLoaded(registerValueFGPFCCR, clutConfig);
+  }
   MemoryAccess::setRegisterValue(&(m_DMA2DPeripheralPtr->FGPFCCR), registerValueFGPFCCR);
 
+  if (isAlphaOnlyColorFormat(colorFormat))
+  {
+    setForegroundColor(color);
+  }
+
   setMemoryAddress(&DMA2D_TypeDef::FGMAR, const_cast<void*>(bufferPtr), bufferDimension, position, colorFormat);
   setLineOffset(&DMA2D_TypeDef::FGOR, bufferDimension, transactionRectangleDimension, colorFormat);
 }
@@ -216,6 +396,61 @@ inline void DMA2D::configureBackgroundInputStage(
   setLineOffset(&DMA2D_TypeDef::BGOR, bufferDimension, transactionRectangleDimension, colorFormat);
 }
 
+void DMA2D::loadForegroundCLUTIfNotLoaded(uint32_t &registerValueFGPFCCR, const CLUTConfiguration &clutConfig)
+{
+  constexpr uint32_t DMA2D_FGPFCCR_CCM_POSITION   = 4u;
+  constexpr uint32_t DMA2D_FGPFCCR_START_POSITION = 5u;
+  constexpr uint32_t DMA2D_FGPFCCR_CS_POSITION    = 8u;
+  constexpr uint32_t DMA2D_FGPFCCR_CS_SIZE        = 8u;
+
+  // START bit is cleared by hardware once the CLUT is loaded
+  registerValueFGPFCCR = MemoryUtility<uint32_t>::resetBit(registerValueFGPFCCR, DMA2D_FGPFCCR_START_POSITION);
+
+  if ((not isForegroundCLUTLoaded(clutConfig)) && (0u != clutConfig.size))
+  {
+    MemoryAccess::setRegisterValue(&(m_DMA2DPeripheralPtr->FGCMAR),
+      static_cast<uint32_t>(reinterpret_cast<uintptr_t>(clutConfig.clutPtr)));
+
+    registerValueFGPFCCR = MemoryUtility<uint32_t>::setBits(
+      registerValueFGPFCCR,
+      DMA2D_FGPFCCR_CCM_POSITION,
+      1u,
+      static_cast<uint32_t>(clutConfig.colorFormat));
+
+    registerValueFGPFCCR = MemoryUtility<uint32_t>::setBits(
+      registerValueFGPFCCR,
+      DMA2D_FGPFCCR_CS_POSITION,
+      DMA2D_FGPFCCR_CS_SIZE,
+      static_cast<uint32_t>(clutConfig.size - 1u));
+
+    // automatic CLUT loading, transfer started afterwards waits until the CLUT is loaded
+    registerValueFGPFCCR = MemoryUtility<uint32_t>::setBit(registerValueFGPFCCR, DMA2D_FGPFCCR_START_POSITION);
+
+    m_foregroundCLUTConfig = clutConfig;
+  }
+}
+
+void DMA2D::setForegroundColor(Color color)
+{
+  constexpr uint32_t DMA2D_FGCOLR_BLUE_POSITION  = 0u;
+  constexpr uint32_t DMA2D_FGCOLR_GREEN_POSITION = 8u;
+  constexpr uint32_t DMA2D_FGCOLR_RED_POSITION   = 16u;
+
+  const uint32_t registerValueFGCOLR =
+    (static_cast<uint32_t>(color.red)   << DMA2D_FGCOLR_RED_POSITION)   |
+    (static_cast<uint32_t>(color.green) << DMA2D_FGCOLR_GREEN_POSITION) |
+    (static_cast<uint32_t>(color.blue)  << DMA2D_FGCOLR_BLUE_POSITION);
+
+  MemoryAccess::setRegisterValue(&(m_DMA2DPeripheralPtr->FGCOLR), registerValueFGCOLR);
+}
+
+bool DMA2D::isForegroundCLUTLoaded(const CLUTConfiguration &clutConfig) const
+{
+  return (clutConfig.clutPtr == m_foregroundCLUTConfig.clutPtr) &&
+         (clutConfig.size == m_foregroundCLUTConfig.size) &&
+         (clutConfig.colorFormat == m_foregroundCLUTConfig.colorFormat);
+}
+
 bool DMA2D::startTransfer(void)
 {
   bool isTransacationStarted = false;
@@ -231,7 +466,8 @@ bool DMA2D::startTransfer(void)
 
 inline void DMA2D::endTransfer(void)
 {
-  m_isTransferCompleted = true;
+  m_isTransferCompleted     = true;
+  m_isCommandQueueExecuting = false;
 }
 
 inline void DMA2D::setLineOffsetModeToBytes(uint32_t &registerValueCR)
@@ -295,8 +531,9 @@ inline void DMA2D::setMemoryAddress(
   Position position,
   ColorFormat colorFormat)
 {
+  // 4 bits per pixel rectangle has to start at a byte boundary, callers do not pass odd x position or line offset
   uint32_t registerValueMAR = reinterpret_cast<uintptr_t>(bufferPtr) +
-    getPixelSize(colorFormat) * (position.x + position.y * bufferDimension.width);
+    getBitsPerPixel(colorFormat) * (position.x + position.y * bufferDimension.width) / 8u;
   MemoryAccess::setRegisterValue(&(m_DMA2DPeripheralPtr->*memoryAddressRegister), registerValueMAR);
 }
 
@@ -308,7 +545,7 @@ inline void DMA2D::setLineOffset(
   ColorFormat colorFormat)
 {
   uint32_t registerValueOR =
-    getPixelSize(colorFormat) * (bufferDimension.width - rectangleDimension.width);
+    getBitsPerPixel(colorFormat) * (bufferDimension.width - rectangleDimension.width) / 8u;
   MemoryAccess::setRegisterValue(&(m_DMA2DPeripheralPtr->*lineOffsetRegister), registerValueOR);
 }
 
@@ -570,11 +807,20 @@ uint8_t DMA2D::getPixelSize(InputColorFormat inputColorFormat)
     case InputColorFormat::ABGR1555:
     case InputColorFormat::ARGB4444:
     case InputColorFormat::ABGR4444:
+    case InputColorFormat::AL88:
     {
       pixelSize = 2u;
     }
     break;
 
+    case InputColorFormat::L8:
+    case InputColorFormat::AL44:
+    case InputColorFormat::A8:
+    {
+      pixelSize = 1u;
+    }
+    break;
+
     default:
     {
       pixelSize = 0u;
@@ -585,6 +831,47 @@ uint8_t DMA2D::getPixelSize(InputColorFormat inputColorFormat)
   return pixelSize;
 }
 
+uint8_t DMA2D::getBitsPerPixel(OutputColorFormat outputColorFormat)
+{
+  return 8u * getPixelSize(outputColorFormat);
+}
+
+uint8_t DMA2D::getBitsPerPixel(InputColorFormat inputColorFormat)
+{
+  uint8_t bitsPerPixel;
+
+  switch (inputColorFormat)
+  {
+    case InputColorFormat::L4:
+    case InputColorFormat::A4:
+    {
+      bitsPerPixel = 4u;
+    }
+    break;
+
+    default:
+    {
+      bitsPerPixel = 8u * getPixelSize(inputColorFormat);
+    }
+    break;
+  }
+
+  return bitsPerPixel;
+}
+
+bool DMA2D::isIndexedColorFormat(InputColorFormat inputColorFormat)
+{
+  return (InputColorFormat::L8   == inputColorFormat) ||
+         (InputColorFormat::L4   == inputColorFormat) ||
+         (InputColorFormat::AL44 == inputColorFormat) ||
+         (InputColorFormat::AL88 == inputColorFormat);
+}
+
+bool DMA2D::isAlphaOnlyColorFormat(InputColorFormat inputColorFormat)
+{
+  return (InputColorFormat::A8 == inputColorFormat) || (InputColorFormat::A4 == inputColorFormat);
+}
+
 void DMA2D::setOutputColor(OutputColorFormat outputColorFormat, Color color)
 {
   switch (outputColorFormat)
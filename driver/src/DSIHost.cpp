@@ -7,7 +7,8 @@
 DSIHost::DSIHost(DSI_TypeDef *DSIHostPeripheralPtr, ClockControl *clockControlPtr, ResetControl *resetControlPtr):
   m_DSIHostPeripheralPtr(DSIHostPeripheralPtr),
   m_clockControlPtr(clockControlPtr),
-  m_resetControlPtr(resetControlPtr)
+  m_resetControlPtr(resetControlPtr),
+  m_endOfRefreshCallback{}
 {}
 
 DSIHost::ErrorCode DSIHost::init(const DSIHostConfig &dsiHostConfig)
@@ -191,11 +192,74 @@ DSIHost::ErrorCode DSIHost::dcsLongWrite(VirtualChannelID virtualChannelId,
 DSIHost::ErrorCode DSIHost::startTransferFromLTDC(void)
 {
   constexpr uint32_t DSIHOST_WCR_LTDCEN_POSITION = 2u;
+
+  clearWrapperInterruptFlag(WrapperInterrupt::END_OF_REFRESH);
+  enableWrapperInterrupt(WrapperInterrupt::END_OF_REFRESH);
+
   RegisterUtility<uint32_t>::setBitInRegister(&(m_DSIHostPeripheralPtr->WCR), DSIHOST_WCR_LTDCEN_POSITION);
 
   return ErrorCode::OK;
 }
 
+DSIHost::ErrorCode DSIHost::startTransferFromLTDCOnTearingEffect(void)
+{
+  // event which happened before the request may be already old, only the next one is waited for
+  clearWrapperInterruptFlag(WrapperInterrupt::TEARING_EFFECT);
+  enableWrapperInterrupt(WrapperInterrupt::TEARING_EFFECT);
+
+  return ErrorCode::OK;
+}
+
+bool DSIHost::isWaitingForTearingEffect(void) const
+{
+  return isWrapperInterruptEnabled(WrapperInterrupt::TEARING_EFFECT);
+}
+
+void DSIHost::cancelWaitForTearingEffect(void)
+{
+  disableWrapperInterrupt(WrapperInterrupt::TEARING_EFFECT);
+  clearWrapperInterruptFlag(WrapperInterrupt::TEARING_EFFECT);
+}
+
+bool DSIHost::isTransferFromLTDCOngoing(void) const
+{
+  constexpr uint32_t DSIHOST_WCR_LTDCEN_POSITION = 2u;
+  return isWrapperInterruptEnabled(WrapperInterrupt::TEARING_EFFECT) ||
+    RegisterUtility<uint32_t>::isBitSetInRegister(&(m_DSIHostPeripheralPtr->WCR), DSIHOST_WCR_LTDCEN_POSITION);
+}
+
+void DSIHost::IRQHandler(void)
+{
+  if (isWrapperInterruptEnabled(WrapperInterrupt::TEARING_EFFECT) &&
+      isWrapperInterruptFlagSet(WrapperInterrupt::TEARING_EFFECT))
+  {
+    clearWrapperInterruptFlag(WrapperInterrupt::TEARING_EFFECT);
+
+    // LTDCEN is set before the wait for the event ends, so the transfer is never seen as not ongoing in between
+    startTransferFromLTDC();
+    disableWrapperInterrupt(WrapperInterrupt::TEARING_EFFECT);
+  }
+
+  if (isWrapperInterruptEnabled(WrapperInterrupt::END_OF_REFRESH) &&
+      isWrapperInterruptFlagSet(WrapperInterrupt::END_OF_REFRESH))
+  {
+    disableWrapperInterrupt(WrapperInterrupt::END_OF_REFRESH);
+    clearWrapperInterruptFlag(WrapperInterrupt::END_OF_REFRESH);
+
+    callEndOfRefreshCallbackIfRegistered();
+  }
+}
+
+void DSIHost::registerEndOfRefreshCallback(const CallbackDescription &callbackDescription)
+{
+  m_endOfRefreshCallback = callbackDescription;
+}
+
+void DSIHost::unregisterEndOfRefreshCallback(void)
+{
+  m_endOfRefreshCallback = {};
+}
+
 DSIHost::ErrorCode DSIHost::configureDPHYPLL(const PLLConfig &pllConfig)
 {
   ErrorCode errorCode = calculateDSIPHYClockFrequency(pllConfig, m_dsiPhyClockFreq);
@@ -1307,4 +1371,42 @@ void DSIHost::writeDCSCommandAndDataToTransmitInFIFO(uint8_t dcsCommand, const u
 
     writeDataToTransmitInFIFO(remainOfData[0], remainOfData[1], remainOfData[2], remainOfData[3]);
   }
+}
+
+inline void DSIHost::enableWrapperInterrupt(WrapperInterrupt wrapperInterrupt)
+{
+  RegisterUtility<uint32_t>::setBitInRegister(&(m_DSIHostPeripheralPtr->WIER),
+    static_cast<uint32_t>(wrapperInterrupt));
+}
+
+inline void DSIHost::disableWrapperInterrupt(WrapperInterrupt wrapperInterrupt)
+{
+  RegisterUtility<uint32_t>::resetBitInRegister(&(m_DSIHostPeripheralPtr->WIER),
+    static_cast<uint32_t>(wrapperInterrupt));
+}
+
+inline bool DSIHost::isWrapperInterruptEnabled(WrapperInterrupt wrapperInterrupt) const
+{
+  return RegisterUtility<uint32_t>::isBitSetInRegister(&(m_DSIHostPeripheralPtr->WIER),
+    static_cast<uint32_t>(wrapperInterrupt));
+}
+
+inline bool DSIHost::isWrapperInterruptFlagSet(WrapperInterrupt wrapperInterrupt) const
+{
+  return RegisterUtility<uint32_t>::isBitSetInRegister(&(m_DSIHostPeripheralPtr->WISR),
+    static_cast<uint32_t>(wrapperInterrupt));
+}
+
+inline void DSIHost::clearWrapperInterruptFlag(WrapperInterrupt wrapperInterrupt)
+{
+  // write only register, so other flags are not cleared by read-modify-write
+  MemoryAccess::setRegisterValue(&(m_DSIHostPeripheralPtr->WIFCR), 1u << static_cast<uint32_t>(wrapperInterrupt));
+}
+
+inline void DSIHost::callEndOfRefreshCallbackIfRegistered(void)
+{
+  if (nullptr != m_endOfRefreshCallback.functionPtr)
+  {
+    m_endOfRefreshCallback.functionPtr(m_endOfRefreshCallback.argument);
+  }
 }
\ No newline at end of file
@@ -55,6 +55,25 @@ InterruptController::ErrorCode InterruptController::enableInterrupt(int32_t irqN
   return ErrorCode::OK;
 }
 
+InterruptController::ErrorCode InterruptController::disableInterrupt(int32_t irqNumber)
+{
+  if (not isIRQNumberInValidRangeOfValues(irqNumber))
+  {
+    return ErrorCode::IRQ_NUMBER_OUT_OF_RANGE;
+  }
+
+  if (not isIRQProcessorException(irqNumber))
+  {
+    const uint32_t index       = irqNumber / NUMBER_OF_BITS_IN_UINT32_T;
+    const uint32_t bitPosition = irqNumber % NUMBER_OF_BITS_IN_UINT32_T;
+
+    // reading ICER returns enabled interrupts, so it is written directly instead of read-modify-written
+    MemoryAccess::setRegisterValue(&(m_NVICPtr->ICER[index]), MemoryUtility<uint32_t>::setBit(0u, bitPosition));
+  }
+
+  return ErrorCode::OK;
+}
+
 inline bool InterruptController::isIRQNumberInValidRangeOfValues(int32_t irqNumber)
 {
   constexpr int32_t IRQ_NUMBER_MIN_VALUE = MemoryManagement_IRQn;
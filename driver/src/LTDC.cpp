@@ -8,7 +8,15 @@ LTDC::LTDC(LTDC_TypeDef *LTDCPeripheralPtr, ResetControl *resetControlPtr):
   m_LTDCPeripheralPtr(LTDCPeripheralPtr),
   m_LTDCPeripheralLayer1Ptr(reinterpret_cast<LTDC_Layer_TypeDef*>(reinterpret_cast<uintptr_t>(LTDCPeripheralPtr) + LAYER1_OFFSET)),
   m_LTDCPeripheralLayer2Ptr(reinterpret_cast<LTDC_Layer_TypeDef*>(reinterpret_cast<uintptr_t>(LTDCPeripheralPtr) + LAYER2_OFFSET)),
-  m_resetControlPtr(resetControlPtr)
+  m_resetControlPtr(resetControlPtr),
+  m_ltdcConfig{},
+  m_frameBufferConfig{},
+  m_displayWindowPosition{},
+  m_displayWindowDimension{},
+  m_layerWindowPosition{},
+  m_isLayerEnabled{},
+  m_reloadCompletedCallback{},
+  m_lineCallback{}
 {}
 
 LTDC::ErrorCode LTDC::init(const LTDCConfig &ltdcConfig, const LTDCLayerConfig &ltdcLayer1Config)
@@ -19,6 +27,16 @@ LTDC::ErrorCode LTDC::init(const LTDCConfig &ltdcConfig, const LTDCLayerConfig &
     return errorCode;
   }
 
+  m_ltdcConfig = ltdcConfig;
+  m_frameBufferConfig[static_cast<uint8_t>(Layer::LAYER1)] = ltdcLayer1Config.frameBufferConfig;
+  m_frameBufferConfig[static_cast<uint8_t>(Layer::LAYER2)] = {};
+  m_displayWindowPosition  = {};
+  m_displayWindowDimension = { .width = ltdcConfig.displayWidth, .height = ltdcConfig.displayHeight };
+  m_layerWindowPosition[static_cast<uint8_t>(Layer::LAYER1)] = {};
+  m_layerWindowPosition[static_cast<uint8_t>(Layer::LAYER2)] = {};
+  m_isLayerEnabled[static_cast<uint8_t>(Layer::LAYER1)] = true;
+  m_isLayerEnabled[static_cast<uint8_t>(Layer::LAYER2)] = false;
+
   configureLTDC(ltdcConfig);
   enableLTDC();
 
@@ -32,6 +50,165 @@ LTDC::ErrorCode LTDC::init(const LTDCConfig &ltdcConfig, const LTDCLayerConfig &
   return ErrorCode::OK;
 }
 
+void LTDC::setFrameBufferAddress(Layer layer, void *frameBufferPtr)
+{
+  Position visiblePosition;
+  Dimension visibleDimension;
+
+  m_frameBufferConfig[static_cast<uint8_t>(layer)].bufferPtr = frameBufferPtr;
+
+  getVisibleLayerWindow(layer, visiblePosition, visibleDimension);
+  setLayerFrameBufferAddress(getLayerPtr(layer), getLayerWindowAddress(layer, visiblePosition));
+}
+
+void LTDC::configureLayer(Layer layer, const LTDCLayerConfig &ltdcLayerConfig, Position windowPosition)
+{
+  LTDC_Layer_TypeDef *LTDCPeripheralLayerPtr = getLayerPtr(layer);
+
+  m_frameBufferConfig[static_cast<uint8_t>(layer)]   = ltdcLayerConfig.frameBufferConfig;
+  m_layerWindowPosition[static_cast<uint8_t>(layer)] = windowPosition;
+
+  setLayerFrameBufferColorFormat(LTDCPeripheralLayerPtr, ltdcLayerConfig.frameBufferConfig.colorFormat);
+  setLayerConstantAlpha(LTDCPeripheralLayerPtr, ltdcLayerConfig.alpha);
+  setLayerDefaultColor(LTDCPeripheralLayerPtr, ltdcLayerConfig.defaultColor);
+  setLayerBlendingFactors(LTDCPeripheralLayerPtr,
+    ltdcLayerConfig.currentLayerBlendingFactor,
+    ltdcLayerConfig.subjacentLayerBlendingFactor);
+  setLayerDisplayWindow(layer);
+}
+
+void LTDC::enableLayer(Layer layer)
+{
+  m_isLayerEnabled[static_cast<uint8_t>(layer)] = true;
+
+  updateLayerEnableState(layer);
+}
+
+void LTDC::disableLayer(Layer layer)
+{
+  m_isLayerEnabled[static_cast<uint8_t>(layer)] = false;
+
+  updateLayerEnableState(layer);
+}
+
+void LTDC::setLayerWindowPosition(Layer layer, Position windowPosition)
+{
+  m_layerWindowPosition[static_cast<uint8_t>(layer)] = windowPosition;
+
+  setLayerDisplayWindow(layer);
+}
+
+void LTDC::setLayerConstantAlpha(Layer layer, uint8_t alpha)
+{
+  setLayerConstantAlpha(getLayerPtr(layer), alpha);
+}
+
+void LTDC::setLayerBlendingFactors(
+  Layer layer,
+  BlendingFactor currentLayerBlendingFactor,
+  BlendingFactor subjacentLayerBlendingFactor)
+{
+  setLayerBlendingFactors(getLayerPtr(layer), currentLayerBlendingFactor, subjacentLayerBlendingFactor);
+}
+
+void LTDC::setDisplayWindow(Position position, Dimension dimension)
+{
+  const uint16_t accumulatedHorizontalBackPorch = m_ltdcConfig.horizontalBackPorch + m_ltdcConfig.hsyncWidth;
+  const uint16_t accumulatedVerticalBackPorch   = m_ltdcConfig.verticalBackPorch   + m_ltdcConfig.vsyncWidth;
+  const uint16_t accumulatedActiveWidth  = dimension.width  + accumulatedHorizontalBackPorch;
+  const uint16_t accumulatedActiveHeight = dimension.height + accumulatedVerticalBackPorch;
+  const uint16_t accumulatedTotalWidth   = m_ltdcConfig.horizontalFrontPorch + accumulatedActiveWidth;
+  const uint16_t accumulatedTotalHeight  = m_ltdcConfig.verticalFrontPorch   + accumulatedActiveHeight;
+
+  m_displayWindowPosition  = position;
+  m_displayWindowDimension = dimension;
+
+  // active area is shrunk to the window, so scan out of a frame takes only as many pixels as the window has
+  setAccumulatedActiveWidthAndHeight(accumulatedActiveWidth, accumulatedActiveHeight);
+  setAccumulatedTotalWidthAndHeight(accumulatedTotalWidth, accumulatedTotalHeight);
+
+  setLayerDisplayWindow(Layer::LAYER1);
+
+  if (nullptr != m_frameBufferConfig[static_cast<uint8_t>(Layer::LAYER2)].bufferPtr)
+  {
+    setLayerDisplayWindow(Layer::LAYER2);
+  }
+
+  forceReloadOfShadowRegisters();
+}
+
+void LTDC::reloadOnVerticalBlank(void)
+{
+  constexpr uint32_t LTDC_SRCR_VBR_POSITION = 1u;
+
+  RegisterUtility<uint32_t>::setBitInRegister(&(m_LTDCPeripheralPtr->SRCR), LTDC_SRCR_VBR_POSITION);
+}
+
+void LTDC::reloadOnVerticalBlank(const CallbackDescription &reloadCompletedCallback)
+{
+  m_reloadCompletedCallback = reloadCompletedCallback;
+
+  clearInterruptFlag(Interrupt::REGISTER_RELOAD);
+  enableInterrupt(Interrupt::REGISTER_RELOAD);
+
+  reloadOnVerticalBlank();
+}
+
+void LTDC::reloadImmediately(void)
+{
+  forceReloadOfShadowRegisters();
+}
+
+bool LTDC::isReloadOngoing(void) const
+{
+  constexpr uint32_t LTDC_SRCR_IMR_POSITION = 0u;
+  constexpr uint32_t LTDC_SRCR_VBR_POSITION = 1u;
+  const uint32_t registerValueSRCR = MemoryAccess::getRegisterValue(&(m_LTDCPeripheralPtr->SRCR));
+
+  // both bits are cleared by hardware once the shadow registers are reloaded
+  return MemoryUtility<uint32_t>::isBitSet(registerValueSRCR, LTDC_SRCR_IMR_POSITION) ||
+         MemoryUtility<uint32_t>::isBitSet(registerValueSRCR, LTDC_SRCR_VBR_POSITION);
+}
+
+void LTDC::enableLineInterrupt(uint16_t line, const CallbackDescription &lineCallback)
+{
+  m_lineCallback = lineCallback;
+
+  setLineInterruptPosition(line);
+  clearInterruptFlag(Interrupt::LINE);
+  enableInterrupt(Interrupt::LINE);
+}
+
+void LTDC::disableLineInterrupt(void)
+{
+  disableInterrupt(Interrupt::LINE);
+
+  m_lineCallback = {};
+}
+
+void LTDC::IRQHandler(void)
+{
+  if (isInterruptEnabled(Interrupt::LINE) && isInterruptFlagSet(Interrupt::LINE))
+  {
+    clearInterruptFlag(Interrupt::LINE);
+
+    callCallbackIfRegistered(m_lineCallback);
+  }
+
+  if (isInterruptEnabled(Interrupt::REGISTER_RELOAD) && isInterruptFlagSet(Interrupt::REGISTER_RELOAD))
+  {
+    disableInterrupt(Interrupt::REGISTER_RELOAD);
+    clearInterruptFlag(Interrupt::REGISTER_RELOAD);
+
+    callCallbackIfRegistered(m_reloadCompletedCallback);
+  }
+}
+
+LTDC_Layer_TypeDef* LTDC::getLayerPtr(Layer layer) const
+{
+  return (Layer::LAYER2 == layer) ? m_LTDCPeripheralLayer2Ptr : m_LTDCPeripheralLayer1Ptr;
+}
+
 void LTDC::configureLTDC(const LTDCConfig &ltdcConfig)
 {
   const uint16_t accumulatedHorizontalBackPorch = ltdcConfig.horizontalBackPorch + ltdcConfig.hsyncWidth;
@@ -222,6 +399,103 @@ inline void LTDC::setLayerFrameBufferAddress(LTDC_Layer_TypeDef *LTDCPeripheralL
     static_cast<uint32_t>(reinterpret_cast<uintptr_t>(frameBufferPtr)));
 }
 
+void LTDC::setLayerDisplayWindow(Layer layer)
+{
+  LTDC_Layer_TypeDef *LTDCPeripheralLayerPtr = getLayerPtr(layer);
+  const FrameBufferConfiguration &frameBufferConfig = m_frameBufferConfig[static_cast<uint8_t>(layer)];
+  Position visiblePosition;
+  Dimension visibleDimension;
+
+  getVisibleLayerWindow(layer, visiblePosition, visibleDimension);
+
+  const uint16_t windowHorizontalStartPosition = m_ltdcConfig.horizontalBackPorch + m_ltdcConfig.hsyncWidth +
+    (visiblePosition.x - m_displayWindowPosition.x);
+  const uint16_t windowVerticalStartPosition   = m_ltdcConfig.verticalBackPorch + m_ltdcConfig.vsyncWidth +
+    (visiblePosition.y - m_displayWindowPosition.y);
+
+  setLayerWindowHorizontalPosition(LTDCPeripheralLayerPtr,
+    windowHorizontalStartPosition,
+    windowHorizontalStartPosition + visibleDimension.width);
+  setLayerWindowVerticalPosition(LTDCPeripheralLayerPtr,
+    windowVerticalStartPosition,
+    windowVerticalStartPosition + visibleDimension.height);
+
+  setLayerFrameBufferAddress(LTDCPeripheralLayerPtr, getLayerWindowAddress(layer, visiblePosition));
+
+  // only window width is read from each line, but lines are still a whole frame buffer width apart
+  uint32_t registerValueCFBLR = 0u;
+
+  setFrameBufferLineLength(registerValueCFBLR, visibleDimension.width, frameBufferConfig.colorFormat);
+  setFrameBufferLinePitch(registerValueCFBLR, frameBufferConfig.bufferDimension.width, frameBufferConfig.colorFormat);
+
+  MemoryAccess::setRegisterValue(&(LTDCPeripheralLayerPtr->CFBLR), registerValueCFBLR);
+
+  setLayerFrameBufferHeight(LTDCPeripheralLayerPtr, visibleDimension.height);
+
+  updateLayerEnableState(layer);
+}
+
+void LTDC::getVisibleLayerWindow(Layer layer, Position &visiblePosition, Dimension &visibleDimension) const
+{
+  const Dimension &bufferDimension    = m_frameBufferConfig[static_cast<uint8_t>(layer)].bufferDimension;
+  const Position &layerWindowPosition = m_layerWindowPosition[static_cast<uint8_t>(layer)];
+  const uint32_t displayWindowEndX = m_displayWindowPosition.x + m_displayWindowDimension.width;
+  const uint32_t displayWindowEndY = m_displayWindowPosition.y + m_displayWindowDimension.height;
+  const uint32_t layerWindowEndX   = layerWindowPosition.x + bufferDimension.width;
+  const uint32_t layerWindowEndY   = layerWindowPosition.y + bufferDimension.height;
+
+  const uint32_t startX = (m_displayWindowPosition.x > layerWindowPosition.x) ?
+    m_displayWindowPosition.x : layerWindowPosition.x;
+  const uint32_t startY = (m_displayWindowPosition.y > layerWindowPosition.y) ?
+    m_displayWindowPosition.y : layerWindowPosition.y;
+  const uint32_t endX = (displayWindowEndX < layerWindowEndX) ? displayWindowEndX : layerWindowEndX;
+  const uint32_t endY = (displayWindowEndY < layerWindowEndY) ? displayWindowEndY : layerWindowEndY;
+
+  visiblePosition =
+  {
+    .x = static_cast<uint16_t>(startX),
+    .y = static_cast<uint16_t>(startY)
+  };
+
+  visibleDimension =
+  {
+    .width  = static_cast<uint16_t>((endX > startX) ? (endX - startX) : 0u),
+    .height = static_cast<uint16_t>((endY > startY) ? (endY - startY) : 0u)
+  };
+}
+
+void* LTDC::getLayerWindowAddress(Layer layer, Position visiblePosition) const
+{
+  const FrameBufferConfiguration &frameBufferConfig = m_frameBufferConfig[static_cast<uint8_t>(layer)];
+  const Position &layerWindowPosition = m_layerWindowPosition[static_cast<uint8_t>(layer)];
+  const uint32_t pixelOffset =
+    static_cast<uint32_t>(visiblePosition.y - layerWindowPosition.y) * frameBufferConfig.bufferDimension.width +
+    (visiblePosition.x - layerWindowPosition.x);
+
+  return reinterpret_cast<uint8_t*>(frameBufferConfig.bufferPtr) +
+    pixelOffset * getPixelSize(frameBufferConfig.colorFormat);
+}
+
+void LTDC::updateLayerEnableState(Layer layer)
+{
+  Position visiblePosition;
+  Dimension visibleDimension;
+
+  getVisibleLayerWindow(layer, visiblePosition, visibleDimension);
+
+  // window registers can not describe a window without pixels, so such layer is switched off instead
+  const bool isLayerVisible = (0u != visibleDimension.width) && (0u != visibleDimension.height);
+
+  if (m_isLayerEnabled[static_cast<uint8_t>(layer)] && isLayerVisible)
+  {
+    enableLayer(getLayerPtr(layer));
+  }
+  else
+  {
+    disableLayer(getLayerPtr(layer));
+  }
+}
+
 void LTDC::setLayerFrameBufferWidth(
   LTDC_Layer_TypeDef *LTDCPeripheralLayerPtr,
   uint16_t frameBufferWidth,
@@ -606,6 +880,54 @@ void LTDC::setFrameBufferLinePitch(
     static_cast<uint32_t>(frameBufferWidth * getPixelSize(frameBufferColorFormat)));
 }
 
+inline void LTDC::enableInterrupt(Interrupt interrupt)
+{
+  RegisterUtility<uint32_t>::setBitInRegister(&(m_LTDCPeripheralPtr->IER), static_cast<uint32_t>(interrupt));
+}
+
+inline void LTDC::disableInterrupt(Interrupt interrupt)
+{
+  RegisterUtility<uint32_t>::resetBitInRegister(&(m_LTDCPeripheralPtr->IER), static_cast<uint32_t>(interrupt));
+}
+
+inline bool LTDC::isInterruptEnabled(Interrupt interrupt) const
+{
+  return RegisterUtility<uint32_t>::isBitSetInRegister(&(m_LTDCPeripheralPtr->IER), static_cast<uint32_t>(interrupt));
+}
+
+inline bool LTDC::isInterruptFlagSet(Interrupt interrupt) const
+{
+  return RegisterUtility<uint32_t>::isBitSetInRegister(&(m_LTDCPeripheralPtr->ISR), static_cast<uint32_t>(interrupt));
+}
+
+inline void LTDC::clearInterruptFlag(Interrupt interrupt)
+{
+  // write only register, so other flags are not cleared by read-modify-write
+  MemoryAccess::setRegisterValue(&(m_LTDCPeripheralPtr->ICR), 1u << static_cast<uint32_t>(interrupt));
+}
+
+void LTDC::setLineInterruptPosition(uint16_t line)
+{
+  constexpr uint32_t LTDC_LIPCR_LIPOS_POSITION = 0u;
+  constexpr uint32_t LTDC_LIPCR_LIPOS_SIZE     = 11u;
+  const uint16_t accumulatedVerticalBackPorch = m_ltdcConfig.verticalBackPorch + m_ltdcConfig.vsyncWidth;
+
+  // line counter of LTDC starts at the beginning of vertical synchronization
+  RegisterUtility<uint32_t>::setBitsInRegister(
+    &(m_LTDCPeripheralPtr->LIPCR),
+    LTDC_LIPCR_LIPOS_POSITION,
+    LTDC_LIPCR_LIPOS_SIZE,
+    static_cast<uint32_t>(accumulatedVerticalBackPorch + line));
+}
+
+void LTDC::callCallbackIfRegistered(const CallbackDescription &callbackDescription)
+{
+  if (nullptr != callbackDescription.functionPtr)
+  {
+    callbackDescription.functionPtr(callbackDescription.argument);
+  }
+}
+
 inline LTDC::ErrorCode LTDC::enablePeripheralClock(void)
 {
   ResetControl::ErrorCode errorCode = m_resetControlPtr->enablePeripheralClock(getPeripheralTag());
@@ -0,0 +1,265 @@
+#include "DMA2DEmulator.h"
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <cstdint>
+#include <cstring>
+
+
+using namespace ::testing;
+
+
+class ADMA2DEmulator : public Test
+{
+public:
+
+  static constexpr uint16_t BUFFER_WIDTH  = 8u;
+  static constexpr uint16_t BUFFER_HEIGHT = 6u;
+
+  uint8_t rgb888Buffer[BUFFER_WIDTH * BUFFER_HEIGHT * 3u];
+  uint8_t rgb565Buffer[BUFFER_WIDTH * BUFFER_HEIGHT * 2u];
+  uint8_t argb8888Bitmap[BUFFER_WIDTH * BUFFER_HEIGHT * 4u];
+  uint8_t l4Bitmap[BUFFER_WIDTH * BUFFER_HEIGHT / 2u];
+  uint32_t clut[2];
+
+  DMA2DEmulator dma2dEmulator;
+
+  uint32_t callbackCallCount = 0u;
+  DMA2D::CallbackDescription callbackDescription;
+
+  DMA2D::FillRectangleConfig fillRectangleConfig;
+  DMA2D::CopyBitmapConfig copyBitmapConfig;
+  DMA2D::BlendBitmapConfig blendBitmapConfig;
+
+  static void callback(void *argument);
+
+  static uint32_t getRGB888Pixel(const uint8_t *bufferPtr, uint16_t x, uint16_t y);
+
+  void SetUp() override;
+};
+
+void ADMA2DEmulator::callback(void *argument)
+{
+  ++(*reinterpret_cast<uint32_t*>(argument));
+}
+
+uint32_t ADMA2DEmulator::getRGB888Pixel(const uint8_t *bufferPtr, uint16_t x, uint16_t y)
+{
+  const uint8_t *pixelPtr = bufferPtr + 3u * (x + y * BUFFER_WIDTH);
+  return (pixelPtr[2] << 16u) | (pixelPtr[1] << 8u) | pixelPtr[0];
+}
+
+void ADMA2DEmulator::SetUp()
+{
+  memset(rgb888Buffer, 0x11, sizeof(rgb888Buffer));
+  memset(rgb565Buffer, 0x00, sizeof(rgb565Buffer));
+  memset(argb8888Bitmap, 0x00, sizeof(argb8888Bitmap));
+  memset(l4Bitmap, 0x10, sizeof(l4Bitmap));
+
+  callbackDescription =
+  {
+    .functionPtr = callback,
+    .argument    = &callbackCallCount
+  };
+
+  const DMA2D::OutputBufferConfiguration rgb888OutputBufferConfig =
+  {
+    .colorFormat     = DMA2D::OutputColorFormat::RGB888,
+    .bufferDimension = { .width = BUFFER_WIDTH, .height = BUFFER_HEIGHT },
+    .bufferPtr       = rgb888Buffer
+  };
+
+  fillRectangleConfig =
+  {
+    .color                   = { .alpha = 0u, .red = 0xAAu, .green = 0xBBu, .blue = 0xCCu },
+    .dimension               = { .width = 3u, .height = 2u },
+    .position                = { .x = 2u, .y = 1u },
+    .destinationBufferConfig = rgb888OutputBufferConfig,
+    .drawCompletedCallback   = callbackDescription
+  };
+
+  copyBitmapConfig =
+  {
+    .dimension               = { .width = 4u, .height = 2u },
+    .sourceRectanglePosition = { .x = 0u, .y = 0u },
+    .sourceBufferConfig =
+    {
+      .colorFormat     = DMA2D::InputColorFormat::L4,
+      .bufferDimension = { .width = BUFFER_WIDTH, .height = BUFFER_HEIGHT },
+      .bufferPtr       = l4Bitmap,
+      .clutConfig      = { .colorFormat = DMA2D::CLUTColorFormat::ARGB8888, .size = 2u, .clutPtr = clut }
+    },
+    .destinationRectanglePosition = { .x = 1u, .y = 2u },
+    .destinationBufferConfig      = rgb888OutputBufferConfig,
+    .drawCompletedCallback        = callbackDescription
+  };
+
+  blendBitmapConfig =
+  {
+    .dimension                   = { .width = 2u, .height = 2u },
+    .foregroundRectanglePosition = { .x = 0u, .y = 0u },
+    .foregroundBufferConfig =
+    {
+      .colorFormat     = DMA2D::InputColorFormat::ARGB8888,
+      .bufferDimension = { .width = BUFFER_WIDTH, .height = BUFFER_HEIGHT },
+      .bufferPtr       = argb8888Bitmap,
+      .clutConfig      = { .colorFormat = DMA2D::CLUTColorFormat::ARGB8888, .size = 0u, .clutPtr = nullptr }
+    },
+    .backgroundRectanglePosition = { .x = 3u, .y = 3u },
+    .backgroundBufferConfig =
+    {
+      .colorFormat     = DMA2D::InputColorFormat::RGB888,
+      .bufferDimension = { .width = BUFFER_WIDTH, .height = BUFFER_HEIGHT },
+      .bufferPtr       = rgb888Buffer,
+      .clutConfig      = { .colorFormat = DMA2D::CLUTColorFormat::ARGB8888, .size = 0u, .clutPtr = nullptr }
+    },
+    .destinationRectanglePosition = { .x = 3u, .y = 3u },
+    .destinationBufferConfig      = rgb888OutputBufferConfig,
+    .drawCompletedCallback        = callbackDescription
+  };
+
+  clut[0] = 0xFF102030u;
+  clut[1] = 0xFF405060u;
+}
+
+TEST_F(ADMA2DEmulator, FillRectangleDoesNotTouchBufferUntilTransferCompleteIRQ)
+{
+  dma2dEmulator.fillRectangle(fillRectangleConfig);
+
+  ASSERT_THAT(dma2dEmulator.isTransferOngoing(), Eq(true));
+  ASSERT_THAT(getRGB888Pixel(rgb888Buffer, 2u, 1u), Eq(0x111111u));
+  ASSERT_THAT(callbackCallCount, Eq(0u));
+}
+
+TEST_F(ADMA2DEmulator, IRQHandlerFillsOnlyRectangleAndCallsDrawCompletedCallback)
+{
+  dma2dEmulator.fillRectangle(fillRectangleConfig);
+
+  dma2dEmulator.IRQHandler();
+
+  ASSERT_THAT(getRGB888Pixel(rgb888Buffer, 2u, 1u), Eq(0xAABBCCu));
+  ASSERT_THAT(getRGB888Pixel(rgb888Buffer, 4u, 2u), Eq(0xAABBCCu));
+  ASSERT_THAT(getRGB888Pixel(rgb888Buffer, 5u, 1u), Eq(0x111111u));
+  ASSERT_THAT(getRGB888Pixel(rgb888Buffer, 2u, 3u), Eq(0x111111u));
+  ASSERT_THAT(getRGB888Pixel(rgb888Buffer, 1u, 1u), Eq(0x111111u));
+  ASSERT_THAT(dma2dEmulator.isTransferOngoing(), Eq(false));
+  ASSERT_THAT(callbackCallCount, Eq(1u));
+}
+
+TEST_F(ADMA2DEmulator, FillRectangleFailsIfColorValueIsOutOfRangeOfOutputColorFormat)
+{
+  fillRectangleConfig.destinationBufferConfig.colorFormat = DMA2D::OutputColorFormat::RGB565;
+
+  ASSERT_THAT(dma2dEmulator.fillRectangle(fillRectangleConfig), Eq(DMA2D::ErrorCode::COLOR_VALUE_OUT_OF_RANGE));
+}
+
+TEST_F(ADMA2DEmulator, StartingTransferFailsWhileAnotherOneIsOngoing)
+{
+  dma2dEmulator.fillRectangle(fillRectangleConfig);
+
+  ASSERT_THAT(dma2dEmulator.copyBitmap(copyBitmapConfig), Eq(DMA2D::ErrorCode::BUSY));
+}
+
+TEST_F(ADMA2DEmulator, CopyBitmapConvertsIndexedPixelsThroughCLUT)
+{
+  dma2dEmulator.copyBitmap(copyBitmapConfig);
+
+  dma2dEmulator.completeAllTransfers();
+
+  // the first pixel of a byte is stored in its lower nibble
+  ASSERT_THAT(getRGB888Pixel(rgb888Buffer, 1u, 2u), Eq(0x102030u));
+  ASSERT_THAT(getRGB888Pixel(rgb888Buffer, 2u, 2u), Eq(0x405060u));
+  ASSERT_THAT(getRGB888Pixel(rgb888Buffer, 5u, 2u), Eq(0x111111u));
+}
+
+TEST_F(ADMA2DEmulator, CopyBitmapTruncatesComponentsToOutputColorFormat)
+{
+  copyBitmapConfig.destinationBufferConfig.colorFormat = DMA2D::OutputColorFormat::RGB565;
+  copyBitmapConfig.destinationBufferConfig.bufferPtr   = rgb565Buffer;
+  copyBitmapConfig.destinationRectanglePosition        = { .x = 0u, .y = 0u };
+
+  dma2dEmulator.copyBitmap(copyBitmapConfig);
+  dma2dEmulator.completeAllTransfers();
+
+  ASSERT_THAT(rgb565Buffer[0] | (rgb565Buffer[1] << 8u), Eq(((0x10u >> 3u) << 11u) | ((0x20u >> 2u) << 5u) | (0x30u >> 3u)));
+}
+
+TEST_F(ADMA2DEmulator, BlendBitmapBlendsForegroundOverOpaqueBackgroundAsCPUDoes)
+{
+  // blue, green, red, alpha
+  argb8888Bitmap[0] = 0x00u;
+  argb8888Bitmap[1] = 0x80u;
+  argb8888Bitmap[2] = 0xFFu;
+  argb8888Bitmap[3] = 0x40u;
+
+  dma2dEmulator.blendBitmap(blendBitmapConfig);
+  dma2dEmulator.completeAllTransfers();
+
+  const uint32_t expectedRed   = (0x40u * 0xFFu + (255u - 0x40u) * 0x11u) / 255u;
+  const uint32_t expectedGreen = (0x40u * 0x80u + (255u - 0x40u) * 0x11u) / 255u;
+  const uint32_t expectedBlue  = (0x40u * 0x00u + (255u - 0x40u) * 0x11u) / 255u;
+  ASSERT_THAT(getRGB888Pixel(rgb888Buffer, 3u, 3u), Eq((expectedRed << 16u) | (expectedGreen << 8u) | expectedBlue));
+  ASSERT_THAT(getRGB888Pixel(rgb888Buffer, 4u, 3u), Eq(0x111111u));
+}
+
+TEST_F(ADMA2DEmulator, BlendBitmapGivesForegroundColorToPixelsOfAlphaOnlyForeground)
+{
+  argb8888Bitmap[0] = 0xFFu;
+  argb8888Bitmap[1] = 0x00u;
+  blendBitmapConfig.foregroundBufferConfig.colorFormat = DMA2D::InputColorFormat::A8;
+  blendBitmapConfig.foregroundBufferConfig.color       = { .alpha = 0u, .red = 0x12u, .green = 0x34u, .blue = 0x56u };
+
+  dma2dEmulator.blendBitmap(blendBitmapConfig);
+  dma2dEmulator.completeAllTransfers();
+
+  ASSERT_THAT(getRGB888Pixel(rgb888Buffer, 3u, 3u), Eq(0x123456u));
+  ASSERT_THAT(getRGB888Pixel(rgb888Buffer, 4u, 3u), Eq(0x111111u));
+}
+
+TEST_F(ADMA2DEmulator, ExecuteCommandQueueRendersCommandsOneByOneAndCallsQueueCallbackOnlyOnce)
+{
+  uint32_t queueCallbackCallCount = 0u;
+  dma2dEmulator.enqueueFillRectangle(fillRectangleConfig);
+  dma2dEmulator.enqueueCopyBitmap(copyBitmapConfig);
+  dma2dEmulator.executeCommandQueue({ .functionPtr = callback, .argument = &queueCallbackCallCount });
+
+  dma2dEmulator.IRQHandler();
+
+  ASSERT_THAT(getRGB888Pixel(rgb888Buffer, 2u, 1u), Eq(0xAABBCCu));
+  ASSERT_THAT(getRGB888Pixel(rgb888Buffer, 1u, 2u), Eq(0x111111u));
+  ASSERT_THAT(queueCallbackCallCount, Eq(0u));
+  ASSERT_THAT(dma2dEmulator.completeAllTransfers(), Eq(1u));
+  ASSERT_THAT(getRGB888Pixel(rgb888Buffer, 1u, 2u), Eq(0x102030u));
+  ASSERT_THAT(queueCallbackCallCount, Eq(1u));
+  ASSERT_THAT(callbackCallCount, Eq(0u));
+}
+
+TEST_F(ADMA2DEmulator, EnqueueFailsIfCommandQueueIsFull)
+{
+  for (uint32_t i = 0u; i < DMA2D::COMMAND_QUEUE_CAPACITY; ++i)
+  {
+    dma2dEmulator.enqueueFillRectangle(fillRectangleConfig);
+  }
+
+  ASSERT_THAT(dma2dEmulator.enqueueFillRectangle(fillRectangleConfig), Eq(DMA2D::ErrorCode::COMMAND_QUEUE_FULL));
+}
+
+TEST_F(ADMA2DEmulator, EstimatedCycleCountAccumulatesCycleCountOfRenderedTransfers)
+{
+  dma2dEmulator.fillRectangle(fillRectangleConfig);
+  dma2dEmulator.completeAllTransfers();
+  dma2dEmulator.blendBitmap(blendBitmapConfig);
+  dma2dEmulator.completeAllTransfers();
+
+  ASSERT_THAT(dma2dEmulator.getEstimatedCycleCount(),
+    Eq(DMA2DEmulator::estimateFillRectangleCycleCount(fillRectangleConfig) +
+       DMA2DEmulator::estimateBlendBitmapCycleCount(blendBitmapConfig)));
+  ASSERT_THAT(dma2dEmulator.getTransferCount(), Eq(2u));
+}
+
+TEST_F(ADMA2DEmulator, BlendBitmapIsEstimatedToTakeMoreCyclesThanFillRectangleOfTheSameDimension)
+{
+  fillRectangleConfig.dimension = blendBitmapConfig.dimension;
+
+  ASSERT_THAT(DMA2DEmulator::estimateBlendBitmapCycleCount(blendBitmapConfig),
+    Gt(DMA2DEmulator::estimateFillRectangleCycleCount(fillRectangleConfig)));
+}
\ No newline at end of file
@@ -666,6 +666,140 @@ TEST_F(ADMA2D, CopyBitmapSetsFGORRegisterValueAccordingToSourceBufferWidthAndCol
   ASSERT_THAT(virtualDMA2DPeripheral.FGOR, EXPECTED_DMA2D_FGOR_VALUE);
 }
 
+TEST_F(ADMA2D, CopyBitmapAddsOffsetToSourceBufferAddressInBytesIfSourceBufferColorFormatHasFourBitsPerPixel)
+{
+  constexpr uint16_t RECTANGLE_X_POS = 100u;
+  constexpr uint16_t RECTANGLE_Y_POS = 50u;
+  constexpr uint16_t SOURCE_BUFFER_WIDTH = 200u;
+  constexpr uintptr_t SOURCE_BUFFER_OFFSET =
+    (static_cast<uintptr_t>(RECTANGLE_X_POS) +
+    static_cast<uintptr_t>(RECTANGLE_Y_POS) * static_cast<uintptr_t>(SOURCE_BUFFER_WIDTH)) / 2u;
+  constexpr uint32_t EXPECTED_DMA2D_FGMAR_VALUE =
+    DEFAULT_CONFIG_VALUES_SOURCE_BUFFER_ADDRESS + SOURCE_BUFFER_OFFSET;
+  copyBitmapConfig.sourceRectanglePosition =
+  {
+    .x = RECTANGLE_X_POS,
+    .y = RECTANGLE_Y_POS
+  };
+  copyBitmapConfig.sourceBufferConfig.colorFormat = DMA2D::InputColorFormat::L4;
+  copyBitmapConfig.sourceBufferConfig.bufferDimension.width = SOURCE_BUFFER_WIDTH;
+  expectSpecificRegisterSetWithNoChangesAfter(&(virtualDMA2DPeripheral.FGMAR), EXPECTED_DMA2D_FGMAR_VALUE);
+
+  const DMA2D::ErrorCode errorCode = virtualDMA2D.copyBitmap(copyBitmapConfig);
+
+  ASSERT_THAT(errorCode, Eq(DMA2D::ErrorCode::OK));
+  ASSERT_THAT(virtualDMA2DPeripheral.FGMAR, EXPECTED_DMA2D_FGMAR_VALUE);
+}
+
+TEST_F(ADMA2D, CopyBitmapSetsFGORRegisterValueInBytesIfSourceBufferColorFormatIsL8)
+{
+  constexpr uint16_t COPY_RECTANGLE_WIDTH = 100u;
+  constexpr uint16_t SOURCE_BUFFER_WIDTH = 200u;
+  constexpr uint32_t EXPECTED_DMA2D_FGOR_VALUE = SOURCE_BUFFER_WIDTH - COPY_RECTANGLE_WIDTH;
+  copyBitmapConfig.dimension.width = COPY_RECTANGLE_WIDTH,
+  copyBitmapConfig.sourceBufferConfig.colorFormat = DMA2D::InputColorFormat::L8;
+  copyBitmapConfig.sourceBufferConfig.bufferDimension.width = SOURCE_BUFFER_WIDTH;
+  expectSpecificRegisterSetWithNoChangesAfter(&(virtualDMA2DPeripheral.FGOR), EXPECTED_DMA2D_FGOR_VALUE);
+
+  const DMA2D::ErrorCode errorCode = virtualDMA2D.copyBitmap(copyBitmapConfig);
+
+  ASSERT_THAT(errorCode, Eq(DMA2D::ErrorCode::OK));
+  ASSERT_THAT(virtualDMA2DPeripheral.FGOR, EXPECTED_DMA2D_FGOR_VALUE);
+}
+
+TEST_F(ADMA2D, CopyBitmapSetsFGCMARRegisterValueToCLUTAddressIfSourceBufferColorFormatIsIndexed)
+{
+  constexpr uintptr_t CLUT_ADDRESS = 0xAB100000;
+  copyBitmapConfig.sourceBufferConfig.colorFormat = DMA2D::InputColorFormat::L8;
+  copyBitmapConfig.sourceBufferConfig.clutConfig =
+  {
+    .colorFormat = DMA2D::CLUTColorFormat::ARGB8888,
+    .size        = 256u,
+    .clutPtr     = reinterpret_cast<void*>(CLUT_ADDRESS)
+  };
+  expectSpecificRegisterSetWithNoChangesAfter(&(virtualDMA2DPeripheral.FGCMAR), CLUT_ADDRESS);
+
+  const DMA2D::ErrorCode errorCode = virtualDMA2D.copyBitmap(copyBitmapConfig);
+
+  ASSERT_THAT(errorCode, Eq(DMA2D::ErrorCode::OK));
+  ASSERT_THAT(virtualDMA2DPeripheral.FGCMAR, CLUT_ADDRESS);
+}
+
+TEST_F(ADMA2D, CopyBitmapStartsCLUTLoadingWithCLUTSizeAndColorFormatInFGPFCCRRegisterIfSourceBufferColorFormatIsIndexed)
+{
+  constexpr uint32_t DMA2D_FGPFCCR_CCM_POSITION = 4u;
+  constexpr uint32_t DMA2D_FGPFCCR_START_POSITION = 5u;
+  constexpr uint32_t DMA2D_FGPFCCR_CS_POSITION = 8u;
+  constexpr uint32_t DMA2D_FGPFCCR_CS_SIZE = 8u;
+  constexpr uint16_t CLUT_SIZE = 16u;
+  copyBitmapConfig.sourceBufferConfig.colorFormat = DMA2D::InputColorFormat::L4;
+  copyBitmapConfig.sourceBufferConfig.clutConfig =
+  {
+    .colorFormat = DMA2D::CLUTColorFormat::RGB888,
+    .size        = CLUT_SIZE,
+    .clutPtr     = reinterpret_cast<void*>(0xAB100000)
+  };
+  auto bitsValueMatcher = AllOf(
+    BitsHaveValue(DMA2D_FGPFCCR_CS_POSITION, DMA2D_FGPFCCR_CS_SIZE, CLUT_SIZE - 1u),
+    BitHasValue(DMA2D_FGPFCCR_CCM_POSITION, 1u),
+    BitHasValue(DMA2D_FGPFCCR_START_POSITION, 1u));
+  expectSpecificRegisterSetWithNoChangesAfter(&(virtualDMA2DPeripheral.FGPFCCR), bitsValueMatcher);
+
+  const DMA2D::ErrorCode errorCode = virtualDMA2D.copyBitmap(copyBitmapConfig);
+
+  ASSERT_THAT(errorCode, Eq(DMA2D::ErrorCode::OK));
+  ASSERT_THAT(virtualDMA2DPeripheral.FGPFCCR, bitsValueMatcher);
+}
+
+TEST_F(ADMA2D, CopyBitmapDoesNotReloadCLUTIfTheSameCLUTIsAlreadyLoaded)
+{
+  constexpr uint32_t DMA2D_FGPFCCR_START_POSITION = 5u;
+  copyBitmapConfig.sourceBufferConfig.colorFormat = DMA2D::InputColorFormat::L8;
+  copyBitmapConfig.sourceBufferConfig.clutConfig =
+  {
+    .colorFormat = DMA2D::CLUTColorFormat::ARGB8888,
+    .size        = 256u,
+    .clutPtr     = reinterpret_cast<void*>(0xAB100000)
+  };
+  virtualDMA2D.copyBitmap(copyBitmapConfig);
+  virtualDMA2DPeripheral.ISR =
+    expectedRegVal(DMA2D_ISR_RESET_VALUE, DMA2D_ISR_TCIF_POSITION, 1u, 1u);
+  virtualDMA2DPeripheral.CR =
+    expectedRegVal(virtualDMA2DPeripheral.CR, DMA2D_CR_START_POSITION, 1u, 0u);
+  virtualDMA2D.IRQHandler();
+  virtualDMA2DPeripheral.FGCMAR = DMA2D_FGCMAR_RESET_VALUE;
+
+  const DMA2D::ErrorCode errorCode = virtualDMA2D.copyBitmap(copyBitmapConfig);
+
+  ASSERT_THAT(errorCode, Eq(DMA2D::ErrorCode::OK));
+  ASSERT_THAT(virtualDMA2DPeripheral.FGCMAR, DMA2D_FGCMAR_RESET_VALUE);
+  ASSERT_THAT(virtualDMA2DPeripheral.FGPFCCR, BitHasValue(DMA2D_FGPFCCR_START_POSITION, 0u));
+}
+
+TEST_F(ADMA2D, CopyBitmapReloadsCLUTIfDifferentCLUTIsLoaded)
+{
+  constexpr uintptr_t CLUT_ADDRESS = 0xAB200000;
+  copyBitmapConfig.sourceBufferConfig.colorFormat = DMA2D::InputColorFormat::L8;
+  copyBitmapConfig.sourceBufferConfig.clutConfig =
+  {
+    .colorFormat = DMA2D::CLUTColorFormat::ARGB8888,
+    .size        = 256u,
+    .clutPtr     = reinterpret_cast<void*>(0xAB100000)
+  };
+  virtualDMA2D.copyBitmap(copyBitmapConfig);
+  virtualDMA2DPeripheral.ISR =
+    expectedRegVal(DMA2D_ISR_RESET_VALUE, DMA2D_ISR_TCIF_POSITION, 1u, 1u);
+  virtualDMA2DPeripheral.CR =
+    expectedRegVal(virtualDMA2DPeripheral.CR, DMA2D_CR_START_POSITION, 1u, 0u);
+  virtualDMA2D.IRQHandler();
+  copyBitmapConfig.sourceBufferConfig.clutConfig.clutPtr = reinterpret_cast<void*>(CLUT_ADDRESS);
+
+  const DMA2D::ErrorCode errorCode = virtualDMA2D.copyBitmap(copyBitmapConfig);
+
+  ASSERT_THAT(errorCode, Eq(DMA2D::ErrorCode::OK));
+  ASSERT_THAT(virtualDMA2DPeripheral.FGCMAR, CLUT_ADDRESS);
+}
+
 TEST_F(ADMA2D, CopyBitmapSetsWantedDestinationBufferColorFormatInOPFCCRRegister)
 {
   constexpr uint32_t DMA2D_OPFCCR_CM_POSITION = 0u;
@@ -853,6 +987,25 @@ TEST_F(ADMA2D, BlendBitmapSetsRBSBitInFGPFCCRRegisterIfWantedForegroundBufferCol
   ASSERT_THAT(virtualDMA2DPeripheral.FGPFCCR, bitValueMatcher);
 }
 
+TEST_F(ADMA2D, BlendBitmapSetsFGCOLRRegisterValueToForegroundColorIfForegroundBufferColorFormatIsAlphaOnly)
+{
+  constexpr uint32_t EXPECTED_DMA2D_FGCOLR_VALUE = 0x00A1B2C3;
+  blendBitmapConfig.foregroundBufferConfig.colorFormat = DMA2D::InputColorFormat::A8;
+  blendBitmapConfig.foregroundBufferConfig.color =
+  {
+    .alpha = 0u,
+    .red   = 0xA1,
+    .green = 0xB2,
+    .blue  = 0xC3
+  };
+  expectSpecificRegisterSetWithNoChangesAfter(&(virtualDMA2DPeripheral.FGCOLR), EXPECTED_DMA2D_FGCOLR_VALUE);
+
+  const DMA2D::ErrorCode errorCode = virtualDMA2D.blendBitmap(blendBitmapConfig);
+
+  ASSERT_THAT(errorCode, Eq(DMA2D::ErrorCode::OK));
+  ASSERT_THAT(virtualDMA2DPeripheral.FGCOLR, EXPECTED_DMA2D_FGCOLR_VALUE);
+}
+
 TEST_F(ADMA2D, BlendBitmapSetsFGMARRegisterValueRelativeToForegroundBufferAddress)
 {
   constexpr uintptr_t FOREGROUND_BUFFER_ADDRESS = 0xEB000000;
@@ -1209,4 +1362,150 @@ TEST_F(ADMA2D, IRQHandlerCallsDrawCompletedCallbackProvidedInBlendBitmapConfigur
   virtualDMA2D.IRQHandler();
 
   ASSERT_THAT(callbackCallCounter, Eq(1u));
+}
+
+TEST_F(ADMA2D, ExecuteCommandQueueStartsTheFirstEnqueuedCommand)
+{
+  constexpr uint32_t DMA2D_CR_MODE_POSITION = 16u;
+  constexpr uint32_t DMA2D_CR_MODE_SIZE = 3u;
+  constexpr uint32_t EXPECTED_DMA2D_CR_MODE_VALUE = 0b011;
+  const DMA2D::CallbackDescription queueCompletedCallback = { .functionPtr = nullptr, .argument = nullptr };
+  virtualDMA2D.enqueueFillRectangle(fillRectangleConfig);
+  virtualDMA2D.enqueueCopyBitmap(copyBitmapConfig);
+
+  const DMA2D::ErrorCode errorCode = virtualDMA2D.executeCommandQueue(queueCompletedCallback);
+
+  ASSERT_THAT(errorCode, Eq(DMA2D::ErrorCode::OK));
+  ASSERT_THAT(virtualDMA2DPeripheral.CR,
+    BitsHaveValue(DMA2D_CR_MODE_POSITION, DMA2D_CR_MODE_SIZE, EXPECTED_DMA2D_CR_MODE_VALUE));
+  ASSERT_THAT(virtualDMA2DPeripheral.CR, BitHasValue(DMA2D_CR_START_POSITION, 1u));
+}
+
+TEST_F(ADMA2D, EnqueueDoesNotStartAnyDMA2DTransfer)
+{
+  virtualDMA2D.enqueueFillRectangle(fillRectangleConfig);
+  virtualDMA2D.enqueueCopyBitmap(copyBitmapConfig);
+  virtualDMA2D.enqueueBlendBitmap(blendBitmapConfig);
+
+  ASSERT_THAT(virtualDMA2D.isTransferOngoing(), Eq(false));
+}
+
+TEST_F(ADMA2D, IRQHandlerStartsTheNextEnqueuedCommandWithoutCallingQueueCompletedCallback)
+{
+  constexpr uint32_t DMA2D_CR_MODE_POSITION = 16u;
+  constexpr uint32_t DMA2D_CR_MODE_SIZE = 3u;
+  constexpr uint32_t EXPECTED_DMA2D_CR_MODE_VALUE = 0b010;
+  uint32_t callbackCallCounter = 0u;
+  const DMA2D::CallbackDescription queueCompletedCallback =
+  {
+    .functionPtr = [](void *argument) { (*reinterpret_cast<uint32_t*>(argument))++; },
+    .argument    = &callbackCallCounter
+  };
+  virtualDMA2DPeripheral.ISR =
+    expectedRegVal(DMA2D_ISR_RESET_VALUE, DMA2D_ISR_TCIF_POSITION, 1u, 1u);
+  virtualDMA2D.enqueueFillRectangle(fillRectangleConfig);
+  virtualDMA2D.enqueueBlendBitmap(blendBitmapConfig);
+  virtualDMA2D.executeCommandQueue(queueCompletedCallback);
+
+  virtualDMA2D.IRQHandler();
+
+  ASSERT_THAT(callbackCallCounter, Eq(0u));
+  ASSERT_THAT(virtualDMA2D.isTransferOngoing(), Eq(true));
+  ASSERT_THAT(virtualDMA2DPeripheral.CR,
+    BitsHaveValue(DMA2D_CR_MODE_POSITION, DMA2D_CR_MODE_SIZE, EXPECTED_DMA2D_CR_MODE_VALUE));
+}
+
+TEST_F(ADMA2D, IRQHandlerCallsQueueCompletedCallbackOnlyOnceAfterTheLastEnqueuedCommandIsCompleted)
+{
+  uint32_t callbackCallCounter = 0u;
+  const DMA2D::CallbackDescription queueCompletedCallback =
+  {
+    .functionPtr = [](void *argument) { (*reinterpret_cast<uint32_t*>(argument))++; },
+    .argument    = &callbackCallCounter
+  };
+  virtualDMA2DPeripheral.ISR =
+    expectedRegVal(DMA2D_ISR_RESET_VALUE, DMA2D_ISR_TCIF_POSITION, 1u, 1u);
+  virtualDMA2D.enqueueFillRectangle(fillRectangleConfig);
+  virtualDMA2D.enqueueCopyBitmap(copyBitmapConfig);
+  virtualDMA2D.enqueueBlendBitmap(blendBitmapConfig);
+  virtualDMA2D.executeCommandQueue(queueCompletedCallback);
+
+  virtualDMA2D.IRQHandler();
+  virtualDMA2D.IRQHandler();
+  virtualDMA2D.IRQHandler();
+
+  // simulate that START bit is cleared because the ongoing transfer end
+  virtualDMA2DPeripheral.CR =
+    expectedRegVal(virtualDMA2DPeripheral.CR, DMA2D_CR_START_POSITION, 1u, 0u);
+  ASSERT_THAT(callbackCallCounter, Eq(1u));
+  ASSERT_THAT(virtualDMA2D.isTransferOngoing(), Eq(false));
+}
+
+TEST_F(ADMA2D, ExecuteCommandQueueCallsQueueCompletedCallbackDirectlyIfQueueIsEmpty)
+{
+  uint32_t callbackCallCounter = 0u;
+  const DMA2D::CallbackDescription queueCompletedCallback =
+  {
+    .functionPtr = [](void *argument) { (*reinterpret_cast<uint32_t*>(argument))++; },
+    .argument    = &callbackCallCounter
+  };
+
+  const DMA2D::ErrorCode errorCode = virtualDMA2D.executeCommandQueue(queueCompletedCallback);
+
+  ASSERT_THAT(errorCode, Eq(DMA2D::ErrorCode::OK));
+  ASSERT_THAT(callbackCallCounter, Eq(1u));
+  ASSERT_THAT(virtualDMA2D.isTransferOngoing(), Eq(false));
+}
+
+TEST_F(ADMA2D, GetNumberOfEnqueuedCommandsReturnsNumberOfCommandsWhichAreNotStartedYet)
+{
+  const DMA2D::CallbackDescription queueCompletedCallback = { .functionPtr = nullptr, .argument = nullptr };
+  virtualDMA2D.enqueueFillRectangle(fillRectangleConfig);
+  virtualDMA2D.enqueueCopyBitmap(copyBitmapConfig);
+  ASSERT_THAT(virtualDMA2D.getNumberOfEnqueuedCommands(), Eq(2u));
+
+  virtualDMA2D.executeCommandQueue(queueCompletedCallback);
+
+  ASSERT_THAT(virtualDMA2D.getNumberOfEnqueuedCommands(), Eq(1u));
+}
+
+TEST_F(ADMA2D, ExecuteCommandQueueFailsIfAnotherDMA2DTransferIsOngoing)
+{
+  const DMA2D::CallbackDescription queueCompletedCallback = { .functionPtr = nullptr, .argument = nullptr };
+  virtualDMA2D.fillRectangle(fillRectangleConfig);
+
+  ASSERT_THAT(virtualDMA2D.executeCommandQueue(queueCompletedCallback), Eq(DMA2D::ErrorCode::BUSY));
+}
+
+TEST_F(ADMA2D, EnqueueFailsIfCommandQueueIsFull)
+{
+  for (uint32_t i = 0u; i < DMA2D::COMMAND_QUEUE_CAPACITY; ++i)
+  {
+    ASSERT_THAT(virtualDMA2D.enqueueCopyBitmap(copyBitmapConfig), Eq(DMA2D::ErrorCode::OK));
+  }
+
+  ASSERT_THAT(virtualDMA2D.enqueueCopyBitmap(copyBitmapConfig), Eq(DMA2D::ErrorCode::COMMAND_QUEUE_FULL));
+}
+
+TEST_F(ADMA2D, EnqueueFailsWhileCommandQueueIsBeingExecuted)
+{
+  const DMA2D::CallbackDescription queueCompletedCallback = { .functionPtr = nullptr, .argument = nullptr };
+  virtualDMA2D.enqueueCopyBitmap(copyBitmapConfig);
+  virtualDMA2D.executeCommandQueue(queueCompletedCallback);
+
+  ASSERT_THAT(virtualDMA2D.enqueueCopyBitmap(copyBitmapConfig), Eq(DMA2D::ErrorCode::BUSY));
+}
+
+TEST_F(ADMA2D, EnqueueFillRectangleFailsIfForGivenOutputColorFormatAnyComponentOfOutputColorIsOutOfRange)
+{
+  fillRectangleConfig.destinationBufferConfig.colorFormat = DMA2D::OutputColorFormat::RGB565;
+  fillRectangleConfig.color =
+  {
+    .alpha = 0,
+    .red   = 40,
+    .green = 0,
+    .blue  = 10
+  };
+
+  ASSERT_THAT(virtualDMA2D.enqueueFillRectangle(fillRectangleConfig), Eq(DMA2D::ErrorCode::COLOR_VALUE_OUT_OF_RANGE));
 }
\ No newline at end of file
@@ -1981,4 +1981,190 @@ TEST_F(ADSIHost, StartsTransferFromLTDCBySettingLTDCENBitInWCRRegister)
   const DSIHost::ErrorCode errorCode = virtualDSIHost.startTransferFromLTDC();
 
   ASSERT_THAT(errorCode, Eq(DSIHost::ErrorCode::OK));
+}
+
+TEST_F(ADSIHost, IsTransferFromLTDCOngoingReturnsTrueUntilHardwareClearsLTDCENBitInWCRRegister)
+{
+  constexpr uint32_t DSIHOST_WCR_LTDCEN_POSITION = 2u;
+  virtualDSIHost.startTransferFromLTDC();
+  ASSERT_THAT(virtualDSIHost.isTransferFromLTDCOngoing(), Eq(true));
+
+  // emulate that whole frame is transferred from LTDC
+  virtualDSIHostPeripheral.WCR &= ~(1u << DSIHOST_WCR_LTDCEN_POSITION);
+
+  ASSERT_THAT(virtualDSIHost.isTransferFromLTDCOngoing(), Eq(false));
+}
+
+TEST_F(ADSIHost, SetMaximumLTDCWriteMemoryCommandSizeSetsCMDSIZEBitsInLCCRRegister)
+{
+  constexpr uint32_t DSIHOST_LCCR_CMDSIZE_POSITION = 0u;
+  constexpr uint32_t DSIHOST_LCCR_CMDSIZE_SIZE     = 16u;
+  constexpr uint32_t EXPECTED_DSIHOST_LCCR_CMDSIZE_VALUE = 120u;
+  auto bitValueMatcher =
+    BitsHaveValue(DSIHOST_LCCR_CMDSIZE_POSITION, DSIHOST_LCCR_CMDSIZE_SIZE, EXPECTED_DSIHOST_LCCR_CMDSIZE_VALUE);
+  expectRegisterSetOnlyOnce(&(virtualDSIHostPeripheral.LCCR), bitValueMatcher);
+
+  virtualDSIHost.setMaximumLTDCWriteMemoryCommandSize(120u);
+
+  ASSERT_THAT(virtualDSIHostPeripheral.LCCR, bitValueMatcher);
+}
+
+TEST_F(ADSIHost, StartTransferFromLTDCOnTearingEffectEnablesTEIEBitInWIERRegisterWithoutStartingTransfer)
+{
+  constexpr uint32_t DSIHOST_WIER_TEIE_POSITION = 0u;
+  constexpr uint32_t DSIHOST_WCR_LTDCEN_POSITION = 2u;
+  auto bitValueMatcher = BitHasValue(DSIHOST_WIER_TEIE_POSITION, 1u);
+  expectSpecificRegisterSetWithNoChangesAfter(&(virtualDSIHostPeripheral.WIER), bitValueMatcher);
+
+  const DSIHost::ErrorCode errorCode = virtualDSIHost.startTransferFromLTDCOnTearingEffect();
+
+  ASSERT_THAT(errorCode, Eq(DSIHost::ErrorCode::OK));
+  ASSERT_THAT(virtualDSIHostPeripheral.WIER, bitValueMatcher);
+  ASSERT_THAT(virtualDSIHostPeripheral.WCR, BitHasValue(DSIHOST_WCR_LTDCEN_POSITION, 0u));
+}
+
+TEST_F(ADSIHost, IsTransferFromLTDCOngoingReturnsTrueWhileTransferIsWaitingForTearingEffect)
+{
+  virtualDSIHost.startTransferFromLTDCOnTearingEffect();
+
+  ASSERT_THAT(virtualDSIHost.isTransferFromLTDCOngoing(), Eq(true));
+}
+
+TEST_F(ADSIHost, IsWaitingForTearingEffectReturnsTrueOnlyUntilTearingEffectStartsTransfer)
+{
+  constexpr uint32_t DSIHOST_WISR_TEIF_POSITION = 0u;
+  virtualDSIHost.startTransferFromLTDCOnTearingEffect();
+  ASSERT_THAT(virtualDSIHost.isWaitingForTearingEffect(), Eq(true));
+
+  virtualDSIHostPeripheral.WISR |= (1u << DSIHOST_WISR_TEIF_POSITION);
+  virtualDSIHost.IRQHandler();
+
+  ASSERT_THAT(virtualDSIHost.isWaitingForTearingEffect(), Eq(false));
+}
+
+TEST_F(ADSIHost, CancelWaitForTearingEffectDisablesTEIEBitInWIERRegisterWithoutStartingTransfer)
+{
+  constexpr uint32_t DSIHOST_WIER_TEIE_POSITION = 0u;
+  constexpr uint32_t DSIHOST_WCR_LTDCEN_POSITION = 2u;
+  virtualDSIHost.startTransferFromLTDCOnTearingEffect();
+
+  virtualDSIHost.cancelWaitForTearingEffect();
+
+  ASSERT_THAT(virtualDSIHostPeripheral.WIER, BitHasValue(DSIHOST_WIER_TEIE_POSITION, 0u));
+  ASSERT_THAT(virtualDSIHostPeripheral.WCR, BitHasValue(DSIHOST_WCR_LTDCEN_POSITION, 0u));
+  ASSERT_THAT(virtualDSIHost.isTransferFromLTDCOngoing(), Eq(false));
+}
+
+TEST_F(ADSIHost, IRQHandlerDoesNotStartTransferFromLTDCOnTearingEffectIfWaitForItIsCancelled)
+{
+  constexpr uint32_t DSIHOST_WISR_TEIF_POSITION  = 0u;
+  constexpr uint32_t DSIHOST_WCR_LTDCEN_POSITION = 2u;
+  virtualDSIHost.startTransferFromLTDCOnTearingEffect();
+  virtualDSIHost.cancelWaitForTearingEffect();
+  virtualDSIHostPeripheral.WISR |= (1u << DSIHOST_WISR_TEIF_POSITION);
+
+  virtualDSIHost.IRQHandler();
+
+  ASSERT_THAT(virtualDSIHostPeripheral.WCR, BitHasValue(DSIHOST_WCR_LTDCEN_POSITION, 0u));
+}
+
+TEST_F(ADSIHost, IRQHandlerStartsTransferFromLTDCAndDisablesTEIEIfTearingEffectOccursAfterTransferIsRequested)
+{
+  constexpr uint32_t DSIHOST_WISR_TEIF_POSITION = 0u;
+  constexpr uint32_t DSIHOST_WIER_TEIE_POSITION = 0u;
+  constexpr uint32_t DSIHOST_WCR_LTDCEN_POSITION = 2u;
+  virtualDSIHost.startTransferFromLTDCOnTearingEffect();
+  virtualDSIHostPeripheral.WISR |= (1u << DSIHOST_WISR_TEIF_POSITION);
+
+  virtualDSIHost.IRQHandler();
+
+  ASSERT_THAT(virtualDSIHostPeripheral.WCR, BitHasValue(DSIHOST_WCR_LTDCEN_POSITION, 1u));
+  ASSERT_THAT(virtualDSIHostPeripheral.WIER, BitHasValue(DSIHOST_WIER_TEIE_POSITION, 0u));
+}
+
+TEST_F(ADSIHost, IRQHandlerClearsTearingEffectFlagBySettingCTEIFBitInWIFCRRegister)
+{
+  constexpr uint32_t DSIHOST_WISR_TEIF_POSITION  = 0u;
+  constexpr uint32_t DSIHOST_WIFCR_CTEIF_POSITION = 0u;
+  virtualDSIHost.startTransferFromLTDCOnTearingEffect();
+  virtualDSIHostPeripheral.WISR |= (1u << DSIHOST_WISR_TEIF_POSITION);
+  EXPECT_CALL(memoryAccessHook, setRegisterValue(_, Matcher<uint32_t>(_)))
+    .Times(AnyNumber());
+  EXPECT_CALL(memoryAccessHook,
+    setRegisterValue(&(virtualDSIHostPeripheral.WIFCR), BitHasValue(DSIHOST_WIFCR_CTEIF_POSITION, 1u)))
+    .Times(1u);
+
+  virtualDSIHost.IRQHandler();
+}
+
+TEST_F(ADSIHost, IRQHandlerDoesNotStartTransferFromLTDCOnTearingEffectIfTransferIsNotRequested)
+{
+  constexpr uint32_t DSIHOST_WISR_TEIF_POSITION  = 0u;
+  constexpr uint32_t DSIHOST_WCR_LTDCEN_POSITION = 2u;
+  virtualDSIHostPeripheral.WISR |= (1u << DSIHOST_WISR_TEIF_POSITION);
+
+  virtualDSIHost.IRQHandler();
+
+  ASSERT_THAT(virtualDSIHostPeripheral.WCR, BitHasValue(DSIHOST_WCR_LTDCEN_POSITION, 0u));
+}
+
+TEST_F(ADSIHost, StartTransferFromLTDCEnablesERIEBitInWIERRegister)
+{
+  constexpr uint32_t DSIHOST_WIER_ERIE_POSITION = 1u;
+  auto bitValueMatcher = BitHasValue(DSIHOST_WIER_ERIE_POSITION, 1u);
+  expectSpecificRegisterSetWithNoChangesAfter(&(virtualDSIHostPeripheral.WIER), bitValueMatcher);
+
+  const DSIHost::ErrorCode errorCode = virtualDSIHost.startTransferFromLTDC();
+
+  ASSERT_THAT(errorCode, Eq(DSIHost::ErrorCode::OK));
+  ASSERT_THAT(virtualDSIHostPeripheral.WIER, bitValueMatcher);
+}
+
+TEST_F(ADSIHost, IRQHandlerCallsRegisteredEndOfRefreshCallbackOnlyOnceAfterWholeFrameIsTransferred)
+{
+  constexpr uint32_t DSIHOST_WISR_ERIF_POSITION = 1u;
+  uint32_t callbackCallCount = 0u;
+  virtualDSIHost.registerEndOfRefreshCallback(
+  {
+    .functionPtr = [](void *argument) { ++(*reinterpret_cast<uint32_t*>(argument)); },
+    .argument    = &callbackCallCount
+  });
+  virtualDSIHost.startTransferFromLTDC();
+  virtualDSIHost.IRQHandler();
+  ASSERT_THAT(callbackCallCount, Eq(0u));
+
+  virtualDSIHostPeripheral.WISR |= (1u << DSIHOST_WISR_ERIF_POSITION);
+  virtualDSIHost.IRQHandler();
+  virtualDSIHost.IRQHandler();
+
+  ASSERT_THAT(callbackCallCount, Eq(1u));
+}
+
+TEST_F(ADSIHost, IRQHandlerClearsEndOfRefreshFlagBySettingCERIFBitInWIFCRRegister)
+{
+  constexpr uint32_t DSIHOST_WISR_ERIF_POSITION   = 1u;
+  constexpr uint32_t DSIHOST_WIFCR_CERIF_POSITION = 1u;
+  virtualDSIHost.startTransferFromLTDC();
+  virtualDSIHostPeripheral.WISR |= (1u << DSIHOST_WISR_ERIF_POSITION);
+  expectRegisterSetOnlyOnce(&(virtualDSIHostPeripheral.WIFCR), BitHasValue(DSIHOST_WIFCR_CERIF_POSITION, 1u));
+
+  virtualDSIHost.IRQHandler();
+}
+
+TEST_F(ADSIHost, IRQHandlerDoesNotCallUnregisteredEndOfRefreshCallback)
+{
+  constexpr uint32_t DSIHOST_WISR_ERIF_POSITION = 1u;
+  uint32_t callbackCallCount = 0u;
+  virtualDSIHost.registerEndOfRefreshCallback(
+  {
+    .functionPtr = [](void *argument) { ++(*reinterpret_cast<uint32_t*>(argument)); },
+    .argument    = &callbackCallCount
+  });
+  virtualDSIHost.unregisterEndOfRefreshCallback();
+  virtualDSIHost.startTransferFromLTDC();
+  virtualDSIHostPeripheral.WISR |= (1u << DSIHOST_WISR_ERIF_POSITION);
+
+  virtualDSIHost.IRQHandler();
+
+  ASSERT_THAT(callbackCallCount, Eq(0u));
 }
\ No newline at end of file
@@ -159,5 +159,29 @@ TEST_F(AnInterruptController, enableInterruptFailsIfInterruptPriorityIsOutOfAllo
   const InterruptController::ErrorCode errorCode =
     virtualInterruptController.enableInterrupt(RANDOM_INVALID_IRQ_NUMBER);
 
+  ASSERT_THAT(errorCode, Eq(InterruptController::ErrorCode::IRQ_NUMBER_OUT_OF_RANGE));
+}
+
+TEST_F(AnInterruptController, disableInterruptSetsOnlyCorrespondingBitInICERRegisterOfNVICForMCUSpecificInterrupts)
+{
+  constexpr uint32_t ICER_INDEX = RANDOM_MCU_SPECIFIC_IRQ_NUMBER / NUMBER_OF_BITS_IN_UINT32_T;
+  constexpr uint32_t ICER_BIT_POSITION = RANDOM_MCU_SPECIFIC_IRQ_NUMBER % NUMBER_OF_BITS_IN_UINT32_T;
+  const uint32_t expectedICERValue = MemoryUtility<uint32_t>::setBit(0u, ICER_BIT_POSITION);
+  virtualNVIC.ICER[ICER_INDEX] = 0xFFFFFFFFu;
+  expectRegisterSetOnlyOnce(&(virtualNVIC.ICER[ICER_INDEX]), expectedICERValue);
+
+  const InterruptController::ErrorCode errorCode =
+    virtualInterruptController.disableInterrupt(RANDOM_MCU_SPECIFIC_IRQ_NUMBER);
+
+  ASSERT_THAT(errorCode, Eq(InterruptController::ErrorCode::OK));
+}
+
+TEST_F(AnInterruptController, disableInterruptFailsIfIRQNumberIsOutOfAllowedRange)
+{
+  expectNoRegisterToChange();
+
+  const InterruptController::ErrorCode errorCode =
+    virtualInterruptController.disableInterrupt(RANDOM_INVALID_IRQ_NUMBER);
+
   ASSERT_THAT(errorCode, Eq(InterruptController::ErrorCode::IRQ_NUMBER_OUT_OF_RANGE));
 }
\ No newline at end of file
@@ -742,3 +742,458 @@ TEST_F(ALTDC, InitForcesImmediateReloadOfShadowRegistersAtTheEndOfFunctionFlowBy
   ASSERT_THAT(errorCode, Eq(LTDC::ErrorCode::OK));
   ASSERT_THAT(virtualLTDCPeripheralPtr->SRCR, bitValueMatcher);
 }
+
+TEST_F(ALTDC, SetFrameBufferAddressSetsCFBADDInLayer1CFBARRegisterToGivenAddressIfLayer1IsSpecified)
+{
+  void *const FRAME_BUFFER_ADDRESS = reinterpret_cast<void*>(0x20001000);
+  const uint32_t EXPECTED_LTDC_LAYER_CFBAR_VALUE = 0x20001000;
+  expectRegisterSetOnlyOnce(&(virtualLTDCPeripheralLayer1Ptr->CFBAR), EXPECTED_LTDC_LAYER_CFBAR_VALUE);
+
+  virtualLTDC.setFrameBufferAddress(LTDC::Layer::LAYER1, FRAME_BUFFER_ADDRESS);
+
+  ASSERT_THAT(virtualLTDCPeripheralLayer1Ptr->CFBAR, Eq(EXPECTED_LTDC_LAYER_CFBAR_VALUE));
+}
+
+TEST_F(ALTDC, SetFrameBufferAddressSetsCFBADDInLayer2CFBARRegisterToGivenAddressIfLayer2IsSpecified)
+{
+  void *const FRAME_BUFFER_ADDRESS = reinterpret_cast<void*>(0x20070000);
+  const uint32_t EXPECTED_LTDC_LAYER_CFBAR_VALUE = 0x20070000;
+  expectRegisterSetOnlyOnce(&(virtualLTDCPeripheralLayer2Ptr->CFBAR), EXPECTED_LTDC_LAYER_CFBAR_VALUE);
+
+  virtualLTDC.setFrameBufferAddress(LTDC::Layer::LAYER2, FRAME_BUFFER_ADDRESS);
+
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->CFBAR, Eq(EXPECTED_LTDC_LAYER_CFBAR_VALUE));
+}
+
+TEST_F(ALTDC, SetDisplayWindowSetsValueOfAAWAndAAHInAWCRRegisterAccordingToWindowDimension)
+{
+  constexpr uint32_t LTDC_AWCR_AAW_POSITION = 16u;
+  constexpr uint32_t LTDC_AWCR_AAW_SIZE     = 12u;
+  constexpr uint32_t LTDC_AWCR_AAH_POSITION = 0u;
+  constexpr uint32_t LTDC_AWCR_AAH_SIZE     = 11u;
+  ltdcConfig.hsyncWidth          = 2u;
+  ltdcConfig.horizontalBackPorch = 3u;
+  ltdcConfig.vsyncWidth          = 1u;
+  ltdcConfig.verticalBackPorch   = 4u;
+  virtualLTDC.init(ltdcConfig, ltdcLayer1Config);
+  constexpr uint32_t EXPECTED_LTDC_AWCR_AAW_VALUE = 100u + 2u + 3u - 1u;
+  constexpr uint32_t EXPECTED_LTDC_AWCR_AAH_VALUE = 50u + 1u + 4u - 1u;
+
+  virtualLTDC.setDisplayWindow({ .x = 20u, .y = 30u }, { .width = 100u, .height = 50u });
+
+  ASSERT_THAT(virtualLTDCPeripheralPtr->AWCR,
+    BitsHaveValue(LTDC_AWCR_AAW_POSITION, LTDC_AWCR_AAW_SIZE, EXPECTED_LTDC_AWCR_AAW_VALUE));
+  ASSERT_THAT(virtualLTDCPeripheralPtr->AWCR,
+    BitsHaveValue(LTDC_AWCR_AAH_POSITION, LTDC_AWCR_AAH_SIZE, EXPECTED_LTDC_AWCR_AAH_VALUE));
+}
+
+TEST_F(ALTDC, SetDisplayWindowSetsLayer1WindowStopPositionsAccordingToWindowDimension)
+{
+  constexpr uint32_t LTDC_LAYER_WHPCR_WHSPPOS_POSITION = 16u;
+  constexpr uint32_t LTDC_LAYER_WHPCR_WHSPPOS_SIZE     = 12u;
+  constexpr uint32_t LTDC_LAYER_WVPCR_WVSPPOS_POSITION = 16u;
+  constexpr uint32_t LTDC_LAYER_WVPCR_WVSPPOS_SIZE     = 11u;
+  ltdcConfig.hsyncWidth          = 1u;
+  ltdcConfig.horizontalBackPorch = 1u;
+  ltdcConfig.vsyncWidth          = 1u;
+  ltdcConfig.verticalBackPorch   = 1u;
+  ltdcLayer1Config.frameBufferConfig.bufferDimension = { .width = 390u, .height = 390u };
+  virtualLTDC.init(ltdcConfig, ltdcLayer1Config);
+  constexpr uint32_t EXPECTED_LTDC_LAYER_WHPCR_WHSPPOS_VALUE = 2u + 100u - 1u;
+  constexpr uint32_t EXPECTED_LTDC_LAYER_WVPCR_WVSPPOS_VALUE = 2u + 50u - 1u;
+
+  virtualLTDC.setDisplayWindow({ .x = 20u, .y = 30u }, { .width = 100u, .height = 50u });
+
+  ASSERT_THAT(virtualLTDCPeripheralLayer1Ptr->WHPCR, BitsHaveValue(LTDC_LAYER_WHPCR_WHSPPOS_POSITION,
+    LTDC_LAYER_WHPCR_WHSPPOS_SIZE, EXPECTED_LTDC_LAYER_WHPCR_WHSPPOS_VALUE));
+  ASSERT_THAT(virtualLTDCPeripheralLayer1Ptr->WVPCR, BitsHaveValue(LTDC_LAYER_WVPCR_WVSPPOS_POSITION,
+    LTDC_LAYER_WVPCR_WVSPPOS_SIZE, EXPECTED_LTDC_LAYER_WVPCR_WVSPPOS_VALUE));
+}
+
+TEST_F(ALTDC, SetDisplayWindowSetsLayer1CFBARRegisterToAddressOfFirstPixelOfWindowInFrameBuffer)
+{
+  constexpr uint32_t FRAME_BUFFER_ADDRESS = 0x20001000;
+  constexpr uint32_t PIXEL_SIZE_RGB565 = 2u;
+  ltdcLayer1Config.frameBufferConfig.colorFormat     = LTDC::ColorFormat::RGB565;
+  ltdcLayer1Config.frameBufferConfig.bufferDimension = { .width = 390u, .height = 390u };
+  ltdcLayer1Config.frameBufferConfig.bufferPtr       = reinterpret_cast<void*>(FRAME_BUFFER_ADDRESS);
+  virtualLTDC.init(ltdcConfig, ltdcLayer1Config);
+  constexpr uint32_t EXPECTED_LTDC_LAYER_CFBAR_VALUE = FRAME_BUFFER_ADDRESS + (30u * 390u + 20u) * PIXEL_SIZE_RGB565;
+
+  virtualLTDC.setDisplayWindow({ .x = 20u, .y = 30u }, { .width = 100u, .height = 50u });
+
+  ASSERT_THAT(virtualLTDCPeripheralLayer1Ptr->CFBAR, Eq(EXPECTED_LTDC_LAYER_CFBAR_VALUE));
+}
+
+TEST_F(ALTDC, SetDisplayWindowSetsLayer1LineLengthAccordingToWindowWidthAndLinePitchAccordingToFrameBufferWidth)
+{
+  constexpr uint32_t PIXEL_SIZE_RGB565 = 2u;
+  constexpr uint32_t LTDC_CFBLR_CFBLL_POSITION = 0u;
+  constexpr uint32_t LTDC_CFBLR_CFBLL_SIZE     = 13u;
+  constexpr uint32_t LTDC_CFBLR_CFBP_POSITION  = 16u;
+  constexpr uint32_t LTDC_CFBLR_CFBP_SIZE      = 13u;
+  constexpr uint32_t LTDC_CFBLNR_CFBLNBR_POSITION = 0u;
+  constexpr uint32_t LTDC_CFBLNR_CFBLNBR_SIZE     = 11u;
+  ltdcLayer1Config.frameBufferConfig.colorFormat     = LTDC::ColorFormat::RGB565;
+  ltdcLayer1Config.frameBufferConfig.bufferDimension = { .width = 390u, .height = 390u };
+  virtualLTDC.init(ltdcConfig, ltdcLayer1Config);
+  constexpr uint32_t EXPECTED_LTDC_CFBLR_CFBLL_VALUE     = 100u * PIXEL_SIZE_RGB565 + 3u;
+  constexpr uint32_t EXPECTED_LTDC_CFBLR_CFBP_VALUE      = 390u * PIXEL_SIZE_RGB565;
+  constexpr uint32_t EXPECTED_LTDC_CFBLNR_CFBLNBR_VALUE  = 50u;
+
+  virtualLTDC.setDisplayWindow({ .x = 20u, .y = 30u }, { .width = 100u, .height = 50u });
+
+  ASSERT_THAT(virtualLTDCPeripheralLayer1Ptr->CFBLR,
+    BitsHaveValue(LTDC_CFBLR_CFBLL_POSITION, LTDC_CFBLR_CFBLL_SIZE, EXPECTED_LTDC_CFBLR_CFBLL_VALUE));
+  ASSERT_THAT(virtualLTDCPeripheralLayer1Ptr->CFBLR,
+    BitsHaveValue(LTDC_CFBLR_CFBP_POSITION, LTDC_CFBLR_CFBP_SIZE, EXPECTED_LTDC_CFBLR_CFBP_VALUE));
+  ASSERT_THAT(virtualLTDCPeripheralLayer1Ptr->CFBLNR,
+    BitsHaveValue(LTDC_CFBLNR_CFBLNBR_POSITION, LTDC_CFBLNR_CFBLNBR_SIZE, EXPECTED_LTDC_CFBLNR_CFBLNBR_VALUE));
+}
+
+TEST_F(ALTDC, SetDisplayWindowForcesImmediateReloadOfShadowRegistersAtTheEndOfFunctionFlow)
+{
+  constexpr uint32_t LTDC_SRCR_IMR_POSITION = 0u;
+  constexpr uint32_t EXPECTED_LTDC_SRCR_IMR_VALUE = 0x1;
+  auto bitValueMatcher =
+    BitHasValue(LTDC_SRCR_IMR_POSITION, EXPECTED_LTDC_SRCR_IMR_VALUE);
+  virtualLTDC.init(ltdcConfig, ltdcLayer1Config);
+  virtualLTDCPeripheralPtr->SRCR = LTDC_SRCR_RESET_VALUE;
+  expectSpecificRegisterSetToBeCalledLast(&(virtualLTDCPeripheralPtr->SRCR), bitValueMatcher);
+
+  virtualLTDC.setDisplayWindow({ .x = 0u, .y = 0u }, { .width = 10u, .height = 10u });
+
+  ASSERT_THAT(virtualLTDCPeripheralPtr->SRCR, bitValueMatcher);
+}
+
+TEST_F(ALTDC, SetFrameBufferAddressOffsetsGivenAddressByPositionOfDisplayWindow)
+{
+  constexpr uint32_t FRAME_BUFFER_ADDRESS = 0x20070000;
+  constexpr uint32_t PIXEL_SIZE_ARGB8888 = 4u;
+  ltdcLayer1Config.frameBufferConfig.colorFormat     = LTDC::ColorFormat::ARGB8888;
+  ltdcLayer1Config.frameBufferConfig.bufferDimension = { .width = 200u, .height = 100u };
+  virtualLTDC.init(ltdcConfig, ltdcLayer1Config);
+  virtualLTDC.setDisplayWindow({ .x = 5u, .y = 2u }, { .width = 10u, .height = 10u });
+  constexpr uint32_t EXPECTED_LTDC_LAYER_CFBAR_VALUE = FRAME_BUFFER_ADDRESS + (2u * 200u + 5u) * PIXEL_SIZE_ARGB8888;
+
+  virtualLTDC.setFrameBufferAddress(LTDC::Layer::LAYER1, reinterpret_cast<void*>(FRAME_BUFFER_ADDRESS));
+
+  ASSERT_THAT(virtualLTDCPeripheralLayer1Ptr->CFBAR, Eq(EXPECTED_LTDC_LAYER_CFBAR_VALUE));
+}
+
+TEST_F(ALTDC, ConfigureLayerSetsLayer2PixelFormatConstantAlphaAndBlendingFactorsAccordingToLayerConfig)
+{
+  constexpr uint32_t LTDC_LAYER_PFCR_PF_POSITION     = 0u;
+  constexpr uint32_t LTDC_LAYER_PFCR_PF_SIZE         = 3u;
+  constexpr uint32_t LTDC_LAYER_CACR_CONSTA_POSITION = 0u;
+  constexpr uint32_t LTDC_LAYER_CACR_CONSTA_SIZE     = 8u;
+  constexpr uint32_t LTDC_BFCR_BF1_POSITION = 8u;
+  constexpr uint32_t LTDC_BFCR_BF1_SIZE     = 3u;
+  constexpr uint32_t LTDC_BFCR_BF2_POSITION = 0u;
+  constexpr uint32_t LTDC_BFCR_BF2_SIZE     = 3u;
+  LTDC::LTDCLayerConfig ltdcLayer2Config = ltdcLayer1Config;
+  ltdcLayer2Config.alpha                         = 0x80;
+  ltdcLayer2Config.currentLayerBlendingFactor    = LTDC::BlendingFactor::CONST_ALPHA;
+  ltdcLayer2Config.subjacentLayerBlendingFactor  = LTDC::BlendingFactor::CONST_ALPHA;
+  ltdcLayer2Config.frameBufferConfig.colorFormat = LTDC::ColorFormat::ARGB4444;
+  virtualLTDC.init(ltdcConfig, ltdcLayer1Config);
+  constexpr uint32_t EXPECTED_LTDC_LAYER_PFCR_PF_VALUE     = 0b100;
+  constexpr uint32_t EXPECTED_LTDC_LAYER_CACR_CONSTA_VALUE = 0x80;
+  constexpr uint32_t EXPECTED_LTDC_BFCR_BF1_VALUE          = 0b100;
+  constexpr uint32_t EXPECTED_LTDC_BFCR_BF2_VALUE          = 0b101;
+
+  virtualLTDC.configureLayer(LTDC::Layer::LAYER2, ltdcLayer2Config, { .x = 0u, .y = 0u });
+
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->PFCR,
+    BitsHaveValue(LTDC_LAYER_PFCR_PF_POSITION, LTDC_LAYER_PFCR_PF_SIZE, EXPECTED_LTDC_LAYER_PFCR_PF_VALUE));
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->CACR,
+    BitsHaveValue(LTDC_LAYER_CACR_CONSTA_POSITION, LTDC_LAYER_CACR_CONSTA_SIZE, EXPECTED_LTDC_LAYER_CACR_CONSTA_VALUE));
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->BFCR,
+    BitsHaveValue(LTDC_BFCR_BF1_POSITION, LTDC_BFCR_BF1_SIZE, EXPECTED_LTDC_BFCR_BF1_VALUE));
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->BFCR,
+    BitsHaveValue(LTDC_BFCR_BF2_POSITION, LTDC_BFCR_BF2_SIZE, EXPECTED_LTDC_BFCR_BF2_VALUE));
+}
+
+TEST_F(ALTDC, ConfigureLayerPlacesLayer2WindowAtGivenPositionAndLeavesLayer2Disabled)
+{
+  constexpr uint32_t LTDC_LAYER_WHPCR_WHSTPOS_POSITION = 0u;
+  constexpr uint32_t LTDC_LAYER_WHPCR_WHSTPOS_SIZE     = 12u;
+  constexpr uint32_t LTDC_LAYER_WHPCR_WHSPPOS_POSITION = 16u;
+  constexpr uint32_t LTDC_LAYER_WHPCR_WHSPPOS_SIZE     = 12u;
+  constexpr uint32_t LTDC_LAYER_WVPCR_WVSTPOS_POSITION = 0u;
+  constexpr uint32_t LTDC_LAYER_WVPCR_WVSTPOS_SIZE     = 11u;
+  constexpr uint32_t LTDC_LAYER_WVPCR_WVSPPOS_POSITION = 16u;
+  constexpr uint32_t LTDC_LAYER_WVPCR_WVSPPOS_SIZE     = 11u;
+  constexpr uint32_t LTDC_CR_LEN_POSITION = 0u;
+  ltdcConfig.hsyncWidth          = 1u;
+  ltdcConfig.horizontalBackPorch = 1u;
+  ltdcConfig.vsyncWidth          = 1u;
+  ltdcConfig.verticalBackPorch   = 1u;
+  ltdcConfig.displayWidth        = 390u;
+  ltdcConfig.displayHeight       = 390u;
+  LTDC::LTDCLayerConfig ltdcLayer2Config = ltdcLayer1Config;
+  ltdcLayer2Config.frameBufferConfig.bufferDimension = { .width = 100u, .height = 50u };
+  virtualLTDC.init(ltdcConfig, ltdcLayer1Config);
+  constexpr uint32_t EXPECTED_LTDC_LAYER_WHPCR_WHSTPOS_VALUE = 2u + 20u;
+  constexpr uint32_t EXPECTED_LTDC_LAYER_WHPCR_WHSPPOS_VALUE = 2u + 20u + 100u - 1u;
+  constexpr uint32_t EXPECTED_LTDC_LAYER_WVPCR_WVSTPOS_VALUE = 2u + 30u;
+  constexpr uint32_t EXPECTED_LTDC_LAYER_WVPCR_WVSPPOS_VALUE = 2u + 30u + 50u - 1u;
+
+  virtualLTDC.configureLayer(LTDC::Layer::LAYER2, ltdcLayer2Config, { .x = 20u, .y = 30u });
+
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->WHPCR, BitsHaveValue(LTDC_LAYER_WHPCR_WHSTPOS_POSITION,
+    LTDC_LAYER_WHPCR_WHSTPOS_SIZE, EXPECTED_LTDC_LAYER_WHPCR_WHSTPOS_VALUE));
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->WHPCR, BitsHaveValue(LTDC_LAYER_WHPCR_WHSPPOS_POSITION,
+    LTDC_LAYER_WHPCR_WHSPPOS_SIZE, EXPECTED_LTDC_LAYER_WHPCR_WHSPPOS_VALUE));
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->WVPCR, BitsHaveValue(LTDC_LAYER_WVPCR_WVSTPOS_POSITION,
+    LTDC_LAYER_WVPCR_WVSTPOS_SIZE, EXPECTED_LTDC_LAYER_WVPCR_WVSTPOS_VALUE));
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->WVPCR, BitsHaveValue(LTDC_LAYER_WVPCR_WVSPPOS_POSITION,
+    LTDC_LAYER_WVPCR_WVSPPOS_SIZE, EXPECTED_LTDC_LAYER_WVPCR_WVSPPOS_VALUE));
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->CR, BitHasValue(LTDC_CR_LEN_POSITION, 0u));
+}
+
+TEST_F(ALTDC, EnableLayerSetsLENBitInLayer2CRRegisterIfLayer2WindowOverlapsDisplayWindow)
+{
+  constexpr uint32_t LTDC_CR_LEN_POSITION = 0u;
+  ltdcConfig.displayWidth  = 390u;
+  ltdcConfig.displayHeight = 390u;
+  LTDC::LTDCLayerConfig ltdcLayer2Config = ltdcLayer1Config;
+  ltdcLayer2Config.frameBufferConfig.bufferDimension = { .width = 100u, .height = 50u };
+  virtualLTDC.init(ltdcConfig, ltdcLayer1Config);
+  virtualLTDC.configureLayer(LTDC::Layer::LAYER2, ltdcLayer2Config, { .x = 20u, .y = 30u });
+
+  virtualLTDC.enableLayer(LTDC::Layer::LAYER2);
+
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->CR, BitHasValue(LTDC_CR_LEN_POSITION, 1u));
+}
+
+TEST_F(ALTDC, DisableLayerResetsLENBitInLayer1CRRegister)
+{
+  constexpr uint32_t LTDC_CR_LEN_POSITION = 0u;
+  virtualLTDC.init(ltdcConfig, ltdcLayer1Config);
+
+  virtualLTDC.disableLayer(LTDC::Layer::LAYER1);
+
+  ASSERT_THAT(virtualLTDCPeripheralLayer1Ptr->CR, BitHasValue(LTDC_CR_LEN_POSITION, 0u));
+}
+
+TEST_F(ALTDC, SetDisplayWindowKeepsEnabledLayer2OffWhileItsWindowDoesNotOverlapDisplayWindow)
+{
+  constexpr uint32_t LTDC_CR_LEN_POSITION = 0u;
+  ltdcConfig.displayWidth  = 390u;
+  ltdcConfig.displayHeight = 390u;
+  ltdcLayer1Config.frameBufferConfig.bufferDimension = { .width = 390u, .height = 390u };
+  LTDC::LTDCLayerConfig ltdcLayer2Config = ltdcLayer1Config;
+  ltdcLayer2Config.frameBufferConfig.bufferDimension = { .width = 100u, .height = 50u };
+  ltdcLayer2Config.frameBufferConfig.bufferPtr       = reinterpret_cast<void*>(0x20070000);
+  virtualLTDC.init(ltdcConfig, ltdcLayer1Config);
+  virtualLTDC.configureLayer(LTDC::Layer::LAYER2, ltdcLayer2Config, { .x = 0u, .y = 0u });
+  virtualLTDC.enableLayer(LTDC::Layer::LAYER2);
+
+  virtualLTDC.setDisplayWindow({ .x = 200u, .y = 200u }, { .width = 50u, .height = 50u });
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->CR, BitHasValue(LTDC_CR_LEN_POSITION, 0u));
+
+  virtualLTDC.setDisplayWindow({ .x = 0u, .y = 0u }, { .width = 390u, .height = 390u });
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->CR, BitHasValue(LTDC_CR_LEN_POSITION, 1u));
+}
+
+TEST_F(ALTDC, SetDisplayWindowClipsLayer2WindowToPartOfItOverlappingDisplayWindow)
+{
+  constexpr uint32_t FRAME_BUFFER_ADDRESS = 0x20070000;
+  constexpr uint32_t PIXEL_SIZE_ARGB8888 = 4u;
+  constexpr uint32_t LTDC_LAYER_WHPCR_WHSTPOS_POSITION = 0u;
+  constexpr uint32_t LTDC_LAYER_WHPCR_WHSTPOS_SIZE     = 12u;
+  constexpr uint32_t LTDC_CFBLR_CFBLL_POSITION = 0u;
+  constexpr uint32_t LTDC_CFBLR_CFBLL_SIZE     = 13u;
+  constexpr uint32_t LTDC_CFBLNR_CFBLNBR_POSITION = 0u;
+  constexpr uint32_t LTDC_CFBLNR_CFBLNBR_SIZE     = 11u;
+  ltdcConfig.hsyncWidth          = 1u;
+  ltdcConfig.horizontalBackPorch = 1u;
+  ltdcConfig.displayWidth        = 390u;
+  ltdcConfig.displayHeight       = 390u;
+  ltdcLayer1Config.frameBufferConfig.bufferDimension = { .width = 390u, .height = 390u };
+  LTDC::LTDCLayerConfig ltdcLayer2Config = ltdcLayer1Config;
+  ltdcLayer2Config.frameBufferConfig.colorFormat     = LTDC::ColorFormat::ARGB8888;
+  ltdcLayer2Config.frameBufferConfig.bufferDimension = { .width = 100u, .height = 50u };
+  ltdcLayer2Config.frameBufferConfig.bufferPtr       = reinterpret_cast<void*>(FRAME_BUFFER_ADDRESS);
+  virtualLTDC.init(ltdcConfig, ltdcLayer1Config);
+  virtualLTDC.configureLayer(LTDC::Layer::LAYER2, ltdcLayer2Config, { .x = 20u, .y = 30u });
+  constexpr uint32_t EXPECTED_LTDC_LAYER_WHPCR_WHSTPOS_VALUE = 2u + 20u - 10u;
+  constexpr uint32_t EXPECTED_LTDC_LAYER_CFBAR_VALUE = FRAME_BUFFER_ADDRESS + (10u * 100u) * PIXEL_SIZE_ARGB8888;
+  constexpr uint32_t EXPECTED_LTDC_CFBLR_CFBLL_VALUE    = 100u * PIXEL_SIZE_ARGB8888 + 3u;
+  constexpr uint32_t EXPECTED_LTDC_CFBLNR_CFBLNBR_VALUE = 50u - 10u;
+
+  virtualLTDC.setDisplayWindow({ .x = 10u, .y = 40u }, { .width = 200u, .height = 200u });
+
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->WHPCR, BitsHaveValue(LTDC_LAYER_WHPCR_WHSTPOS_POSITION,
+    LTDC_LAYER_WHPCR_WHSTPOS_SIZE, EXPECTED_LTDC_LAYER_WHPCR_WHSTPOS_VALUE));
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->CFBAR, Eq(EXPECTED_LTDC_LAYER_CFBAR_VALUE));
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->CFBLR,
+    BitsHaveValue(LTDC_CFBLR_CFBLL_POSITION, LTDC_CFBLR_CFBLL_SIZE, EXPECTED_LTDC_CFBLR_CFBLL_VALUE));
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->CFBLNR,
+    BitsHaveValue(LTDC_CFBLNR_CFBLNBR_POSITION, LTDC_CFBLNR_CFBLNBR_SIZE, EXPECTED_LTDC_CFBLNR_CFBLNBR_VALUE));
+}
+
+TEST_F(ALTDC, SetLayerConstantAlphaSetsValueOfCONSTABitsInLayer2CACRRegister)
+{
+  constexpr uint32_t LTDC_LAYER_CACR_CONSTA_POSITION = 0u;
+  constexpr uint32_t LTDC_LAYER_CACR_CONSTA_SIZE     = 8u;
+  constexpr uint32_t EXPECTED_LTDC_LAYER_CACR_CONSTA_VALUE = 0x40;
+  auto bitsValueMatcher =
+    BitsHaveValue(LTDC_LAYER_CACR_CONSTA_POSITION, LTDC_LAYER_CACR_CONSTA_SIZE, EXPECTED_LTDC_LAYER_CACR_CONSTA_VALUE);
+  expectRegisterSetOnlyOnce(&(virtualLTDCPeripheralLayer2Ptr->CACR), bitsValueMatcher);
+
+  virtualLTDC.setLayerConstantAlpha(LTDC::Layer::LAYER2, 0x40);
+
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->CACR, bitsValueMatcher);
+}
+
+TEST_F(ALTDC, SetLayerBlendingFactorsSetsValueOfBF1AndBF2InLayer2BFCRRegister)
+{
+  constexpr uint32_t LTDC_BFCR_BF1_POSITION = 8u;
+  constexpr uint32_t LTDC_BFCR_BF1_SIZE     = 3u;
+  constexpr uint32_t LTDC_BFCR_BF2_POSITION = 0u;
+  constexpr uint32_t LTDC_BFCR_BF2_SIZE     = 3u;
+  constexpr uint32_t EXPECTED_LTDC_BFCR_BF1_VALUE = 0b110;
+  constexpr uint32_t EXPECTED_LTDC_BFCR_BF2_VALUE = 0b111;
+
+  virtualLTDC.setLayerBlendingFactors(LTDC::Layer::LAYER2,
+    LTDC::BlendingFactor::PIXEL_ALPHA_X_CONST_ALPHA,
+    LTDC::BlendingFactor::PIXEL_ALPHA_X_CONST_ALPHA);
+
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->BFCR,
+    BitsHaveValue(LTDC_BFCR_BF1_POSITION, LTDC_BFCR_BF1_SIZE, EXPECTED_LTDC_BFCR_BF1_VALUE));
+  ASSERT_THAT(virtualLTDCPeripheralLayer2Ptr->BFCR,
+    BitsHaveValue(LTDC_BFCR_BF2_POSITION, LTDC_BFCR_BF2_SIZE, EXPECTED_LTDC_BFCR_BF2_VALUE));
+}
+
+TEST_F(ALTDC, ReloadOnVerticalBlankSetsVBRBitInSRCRRegister)
+{
+  constexpr uint32_t LTDC_SRCR_VBR_POSITION = 1u;
+  constexpr uint32_t EXPECTED_LTDC_SRCR_VBR_VALUE = 0x1;
+  auto bitValueMatcher =
+    BitHasValue(LTDC_SRCR_VBR_POSITION, EXPECTED_LTDC_SRCR_VBR_VALUE);
+  expectRegisterSetOnlyOnce(&(virtualLTDCPeripheralPtr->SRCR), bitValueMatcher);
+
+  virtualLTDC.reloadOnVerticalBlank();
+
+  ASSERT_THAT(virtualLTDCPeripheralPtr->SRCR, bitValueMatcher);
+}
+
+TEST_F(ALTDC, ReloadImmediatelySetsIMRBitInSRCRRegister)
+{
+  constexpr uint32_t LTDC_SRCR_IMR_POSITION = 0u;
+  constexpr uint32_t EXPECTED_LTDC_SRCR_IMR_VALUE = 0x1;
+  auto bitValueMatcher =
+    BitHasValue(LTDC_SRCR_IMR_POSITION, EXPECTED_LTDC_SRCR_IMR_VALUE);
+  expectRegisterSetOnlyOnce(&(virtualLTDCPeripheralPtr->SRCR), bitValueMatcher);
+
+  virtualLTDC.reloadImmediately();
+
+  ASSERT_THAT(virtualLTDCPeripheralPtr->SRCR, bitValueMatcher);
+}
+
+TEST_F(ALTDC, IsReloadOngoingReturnsTrueUntilHardwareClearsVBRBitInSRCRRegister)
+{
+  virtualLTDC.reloadOnVerticalBlank();
+  ASSERT_THAT(virtualLTDC.isReloadOngoing(), Eq(true));
+
+  // emulate that shadow registers are reloaded during vertical blanking period
+  virtualLTDCPeripheralPtr->SRCR = LTDC_SRCR_RESET_VALUE;
+
+  ASSERT_THAT(virtualLTDC.isReloadOngoing(), Eq(false));
+}
+
+TEST_F(ALTDC, ReloadOnVerticalBlankWithCallbackEnablesRRIEBitInIERRegisterBeforeSettingVBRBitInSRCRRegister)
+{
+  constexpr uint32_t LTDC_IER_RRIE_POSITION = 3u;
+  constexpr uint32_t LTDC_SRCR_VBR_POSITION = 1u;
+  auto bitValueMatcher = BitHasValue(LTDC_SRCR_VBR_POSITION, 1u);
+  expectSpecificRegisterSetToBeCalledLast(&(virtualLTDCPeripheralPtr->SRCR), bitValueMatcher);
+
+  virtualLTDC.reloadOnVerticalBlank({ .functionPtr = nullptr, .argument = nullptr });
+
+  ASSERT_THAT(virtualLTDCPeripheralPtr->IER, BitHasValue(LTDC_IER_RRIE_POSITION, 1u));
+  ASSERT_THAT(virtualLTDCPeripheralPtr->SRCR, bitValueMatcher);
+}
+
+TEST_F(ALTDC, IRQHandlerCallsReloadCompletedCallbackOnlyOnceAfterShadowRegistersAreReloaded)
+{
+  constexpr uint32_t LTDC_ISR_RRIF_POSITION = 3u;
+  uint32_t callbackCallCount = 0u;
+  virtualLTDC.reloadOnVerticalBlank(
+  {
+    .functionPtr = [](void *argument) { ++(*reinterpret_cast<uint32_t*>(argument)); },
+    .argument    = &callbackCallCount
+  });
+  virtualLTDC.IRQHandler();
+  ASSERT_THAT(callbackCallCount, Eq(0u));
+
+  virtualLTDCPeripheralPtr->ISR |= (1u << LTDC_ISR_RRIF_POSITION);
+  virtualLTDC.IRQHandler();
+  virtualLTDC.IRQHandler();
+
+  ASSERT_THAT(callbackCallCount, Eq(1u));
+}
+
+TEST_F(ALTDC, IRQHandlerClearsRegisterReloadFlagBySettingCRRIFBitInICRRegister)
+{
+  constexpr uint32_t LTDC_ISR_RRIF_POSITION  = 3u;
+  constexpr uint32_t LTDC_ICR_CRRIF_POSITION = 3u;
+  virtualLTDC.reloadOnVerticalBlank({ .functionPtr = nullptr, .argument = nullptr });
+  virtualLTDCPeripheralPtr->ISR |= (1u << LTDC_ISR_RRIF_POSITION);
+  expectRegisterSetOnlyOnce(&(virtualLTDCPeripheralPtr->ICR), BitHasValue(LTDC_ICR_CRRIF_POSITION, 1u));
+
+  virtualLTDC.IRQHandler();
+}
+
+TEST_F(ALTDC, EnableLineInterruptSetsLIPOSInLIPCRRegisterRelativeToFirstLineOfActiveArea)
+{
+  constexpr uint32_t LTDC_LIPCR_LIPOS_POSITION = 0u;
+  constexpr uint32_t LTDC_LIPCR_LIPOS_SIZE     = 11u;
+  ltdcConfig.vsyncWidth        = 2u;
+  ltdcConfig.verticalBackPorch = 3u;
+  virtualLTDC.init(ltdcConfig, ltdcLayer1Config);
+  constexpr uint32_t EXPECTED_LTDC_LIPCR_LIPOS_VALUE = 2u + 3u + 390u;
+  auto bitsValueMatcher =
+    BitsHaveValue(LTDC_LIPCR_LIPOS_POSITION, LTDC_LIPCR_LIPOS_SIZE, EXPECTED_LTDC_LIPCR_LIPOS_VALUE);
+  expectRegisterSetOnlyOnce(&(virtualLTDCPeripheralPtr->LIPCR), bitsValueMatcher);
+
+  virtualLTDC.enableLineInterrupt(390u, { .functionPtr = nullptr, .argument = nullptr });
+
+  ASSERT_THAT(virtualLTDCPeripheralPtr->LIPCR, bitsValueMatcher);
+}
+
+TEST_F(ALTDC, EnableLineInterruptSetsLIEBitInIERRegister)
+{
+  constexpr uint32_t LTDC_IER_LIE_POSITION = 0u;
+  auto bitValueMatcher = BitHasValue(LTDC_IER_LIE_POSITION, 1u);
+  expectSpecificRegisterSetWithNoChangesAfter(&(virtualLTDCPeripheralPtr->IER), bitValueMatcher);
+
+  virtualLTDC.enableLineInterrupt(0u, { .functionPtr = nullptr, .argument = nullptr });
+
+  ASSERT_THAT(virtualLTDCPeripheralPtr->IER, bitValueMatcher);
+}
+
+TEST_F(ALTDC, IRQHandlerCallsLineCallbackEachTimeLineIsReachedUntilLineInterruptIsDisabled)
+{
+  constexpr uint32_t LTDC_ISR_LIF_POSITION = 0u;
+  uint32_t callbackCallCount = 0u;
+  virtualLTDC.enableLineInterrupt(0u,
+  {
+    .functionPtr = [](void *argument) { ++(*reinterpret_cast<uint32_t*>(argument)); },
+    .argument    = &callbackCallCount
+  });
+
+  virtualLTDCPeripheralPtr->ISR |= (1u << LTDC_ISR_LIF_POSITION);
+  virtualLTDC.IRQHandler();
+  virtualLTDCPeripheralPtr->ISR |= (1u << LTDC_ISR_LIF_POSITION);
+  virtualLTDC.IRQHandler();
+  ASSERT_THAT(callbackCallCount, Eq(2u));
+
+  virtualLTDC.disableLineInterrupt();
+  virtualLTDCPeripheralPtr->ISR |= (1u << LTDC_ISR_LIF_POSITION);
+  virtualLTDC.IRQHandler();
+
+  ASSERT_THAT(callbackCallCount, Eq(2u));
+}
\ No newline at end of file
@@ -0,0 +1,431 @@
+#include "GUIContainer.h"
+#include "GUIRectangle.h"
+#include "GUIImage.h"
+#include "FrameBuffer.h"
+#include "ArrayList.h"
+#include "DMA2DEmulator.h"
+#include "SysTick.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+
+//! Host benchmark of CPU drawing of parameterised GUI scenes into display sized RGB888 and RGB565 frame buffers.
+//! Every scene is printed as one CSV line, so results of two builds can be compared by a script.
+//! Throughput counts visible pixels of all objects, occluded ones included. Usage: benchmark [frame count]
+
+namespace
+{
+  constexpr uint16_t FRAME_BUFFER_WIDTH  = 390u;
+  constexpr uint16_t FRAME_BUFFER_HEIGHT = 390u;
+  constexpr uint16_t BITMAP_WIDTH        = 128u;
+  constexpr uint16_t BITMAP_HEIGHT       = 128u;
+  constexpr uint32_t MAX_OBJECT_COUNT    = 64u;
+  constexpr uint32_t DEFAULT_FRAME_COUNT = 100u;
+
+  constexpr uint32_t OBJECT_COUNTS[] = { 1u, 4u, 16u, 64u };
+
+  //! Number of heap allocations made so far, frames are expected not to make any
+  uint64_t s_allocationCount = 0u;
+
+  FrameBuffer<FRAME_BUFFER_WIDTH, FRAME_BUFFER_HEIGHT, IFrameBuffer::ColorFormat::RGB888> s_rgb888FrameBuffer;
+  FrameBuffer<FRAME_BUFFER_WIDTH, FRAME_BUFFER_HEIGHT, IFrameBuffer::ColorFormat::RGB565> s_rgb565FrameBuffer;
+
+  uint8_t s_argb8888Bitmap[BITMAP_WIDTH * BITMAP_HEIGHT * 4u];
+
+  enum class ObjectType : uint8_t
+  {
+    RECTANGLE      = 0u,
+    ARGB8888_IMAGE = 1u
+  };
+
+  enum class Layout : uint8_t
+  {
+    DISJOINT             = 0u,
+    OVERLAPPING          = 1u,
+    PARTIALLY_OFF_SCREEN = 2u
+  };
+
+  struct SceneConfig
+  {
+    IFrameBuffer::ColorFormat colorFormat;
+    ObjectType objectType;
+    Layout layout;
+    uint32_t objectCount;
+  };
+
+  struct SceneResult
+  {
+    uint64_t pixelsPerFrame;
+    uint64_t minFrameTimeInNs;
+    uint64_t medianFrameTimeInNs;
+    uint64_t maxFrameTimeInNs;
+    double megapixelsPerSecond;
+    double allocationsPerFrame;
+  };
+
+  //! SysTick counting microseconds of the host steady clock, used for drawing time measurements of objects
+  class HostSysTick : public SysTick
+  {
+  public:
+
+    HostSysTick():
+      SysTick(nullptr, nullptr, nullptr),
+      m_startTime(std::chrono::steady_clock::now())
+    {}
+
+    uint64_t getTicks(void) const override
+    {
+      return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_startTime).count();
+    }
+
+    uint32_t getTicksPerSecond(void) const override
+    {
+      return 1000000u;
+    }
+
+    uint64_t getElapsedTimeInMs(uint64_t timestamp) const override
+    {
+      return (getTicks() - timestamp) / 1000u;
+    }
+
+    uint64_t getElapsedTimeInUs(uint64_t timestamp) const override
+    {
+      return getTicks() - timestamp;
+    }
+
+  private:
+
+    std::chrono::steady_clock::time_point m_startTime;
+  };
+
+  IFrameBuffer& getFrameBuffer(IFrameBuffer::ColorFormat colorFormat)
+  {
+    if (IFrameBuffer::ColorFormat::RGB565 == colorFormat)
+    {
+      return s_rgb565FrameBuffer;
+    }
+
+    return s_rgb888FrameBuffer;
+  }
+
+  class Scene
+  {
+  public:
+
+    Scene(DMA2D &dma2d, SysTick &sysTick, const SceneConfig &sceneConfig);
+
+    inline GUI::Container& getContainer(void)
+    {
+      return m_container;
+    }
+
+    uint64_t getVisiblePixelCount(void) const;
+
+  private:
+
+    GUI::RectangleBase::RectangleBaseDescription buildBaseDescription(uint32_t objectIdx) const;
+
+    SceneConfig m_sceneConfig;
+    ArrayList<GUI::Container::ObjectInfo, MAX_OBJECT_COUNT> m_objectInfoList;
+    GUI::Container m_container;
+    std::vector<GUI::Rectangle> m_rectangles;
+    std::vector<GUI::Image> m_images;
+  };
+
+  Scene::Scene(DMA2D &dma2d, SysTick &sysTick, const SceneConfig &sceneConfig):
+    m_sceneConfig(sceneConfig),
+    m_container(m_objectInfoList, getFrameBuffer(sceneConfig.colorFormat))
+  {
+    IFrameBuffer &frameBuffer = getFrameBuffer(sceneConfig.colorFormat);
+
+    // objects are never moved after they are added, as the container keeps pointers to them
+    m_rectangles.reserve(sceneConfig.objectCount);
+    m_images.reserve(sceneConfig.objectCount);
+
+    for (uint32_t objectIdx = 0u; objectIdx < sceneConfig.objectCount; ++objectIdx)
+    {
+      GUI::IObject *objectPtr = nullptr;
+
+      if (ObjectType::RECTANGLE == sceneConfig.objectType)
+      {
+        m_rectangles.emplace_back(dma2d, sysTick, frameBuffer);
+        m_rectangles.back().init(
+        {
+          .baseDescription = buildBaseDescription(objectIdx),
+          .color =
+          {
+            .red   = static_cast<uint8_t>(objectIdx * 53u),
+            .green = static_cast<uint8_t>(objectIdx * 97u),
+            .blue  = static_cast<uint8_t>(objectIdx * 29u)
+          }
+        });
+        objectPtr = &m_rectangles.back();
+      }
+      else
+      {
+        const GUI::RectangleBase::RectangleBaseDescription baseDescription = buildBaseDescription(objectIdx);
+
+        m_images.emplace_back(dma2d, sysTick, frameBuffer);
+        m_images.back().init(
+        {
+          .baseDescription = baseDescription,
+          .bitmapDescription =
+          {
+            .colorFormat  = GUI::ColorFormat::ARGB8888,
+            .dimension    = { .width = BITMAP_WIDTH, .height = BITMAP_HEIGHT },
+            .copyPosition = { .x = 0, .y = 0, .tag = GUI::Position::Tag::TOP_LEFT_CORNER },
+            .bitmapPtr    = s_argb8888Bitmap,
+            .clutPtr      = nullptr,
+            .clutSize     = 0u
+          }
+        });
+        objectPtr = &m_images.back();
+      }
+
+      m_container.addObject(objectPtr, objectIdx);
+    }
+  }
+
+  uint64_t Scene::getVisiblePixelCount(void) const
+  {
+    uint64_t visiblePixelCount = 0u;
+
+    for (const GUI::Rectangle &rectangle : m_rectangles)
+    {
+      visiblePixelCount += rectangle.getVisiblePartArea();
+    }
+
+    for (const GUI::Image &image : m_images)
+    {
+      visiblePixelCount += image.getVisiblePartArea();
+    }
+
+    return visiblePixelCount;
+  }
+
+  GUI::RectangleBase::RectangleBaseDescription Scene::buildBaseDescription(uint32_t objectIdx) const
+  {
+    constexpr int16_t FREE_SPACE = static_cast<int16_t>(FRAME_BUFFER_WIDTH - BITMAP_WIDTH);
+
+    const uint32_t objectCount = m_sceneConfig.objectCount;
+    GUI::RectangleBase::RectangleBaseDescription baseDescription =
+    {
+      .dimension = { .width = BITMAP_WIDTH, .height = BITMAP_HEIGHT },
+      .position  = { .x = 0, .y = 0, .tag = GUI::Position::Tag::TOP_LEFT_CORNER }
+    };
+
+    switch (m_sceneConfig.layout)
+    {
+      case Layout::DISJOINT:
+      {
+        // objects are laid out in a grid, each one inside its own cell
+        uint32_t columnCount = 1u;
+        while ((columnCount * columnCount) < objectCount)
+        {
+          ++columnCount;
+        }
+
+        const uint16_t cellSize   = FRAME_BUFFER_WIDTH / columnCount;
+        const uint16_t objectSize = std::min<uint16_t>(cellSize - 2u, BITMAP_WIDTH);
+
+        baseDescription.dimension  = { .width = objectSize, .height = objectSize };
+        baseDescription.position.x = static_cast<int16_t>((objectIdx % columnCount) * cellSize + 1u);
+        baseDescription.position.y = static_cast<int16_t>((objectIdx / columnCount) * cellSize + 1u);
+      }
+      break;
+
+      case Layout::OVERLAPPING:
+      {
+        const int16_t step = static_cast<int16_t>(FREE_SPACE / std::max<uint32_t>(objectCount - 1u, 1u));
+
+        baseDescription.position.x = static_cast<int16_t>(objectIdx * step);
+        baseDescription.position.y = static_cast<int16_t>((objectIdx * step * 3u) % FREE_SPACE);
+      }
+      break;
+
+      case Layout::PARTIALLY_OFF_SCREEN:
+      default:
+      {
+        // objects are spread along all four edges, each of them half outside the frame buffer
+        const int16_t halfSize        = BITMAP_WIDTH / 2;
+        const int16_t positionOnEdge  = static_cast<int16_t>(((objectIdx / 4u) * 61u) % FREE_SPACE);
+        const int16_t nearEdge        = -halfSize;
+        const int16_t farEdge         = static_cast<int16_t>(FRAME_BUFFER_WIDTH - halfSize);
+
+        switch (objectIdx % 4u)
+        {
+          case 0u:  baseDescription.position = { .x = nearEdge, .y = positionOnEdge, .tag = GUI::Position::Tag::TOP_LEFT_CORNER }; break;
+          case 1u:  baseDescription.position = { .x = farEdge, .y = positionOnEdge, .tag = GUI::Position::Tag::TOP_LEFT_CORNER }; break;
+          case 2u:  baseDescription.position = { .x = positionOnEdge, .y = nearEdge, .tag = GUI::Position::Tag::TOP_LEFT_CORNER }; break;
+          default:  baseDescription.position = { .x = positionOnEdge, .y = farEdge, .tag = GUI::Position::Tag::TOP_LEFT_CORNER }; break;
+        }
+      }
+      break;
+    }
+
+    return baseDescription;
+  }
+
+  const char* toString(IFrameBuffer::ColorFormat colorFormat)
+  {
+    return (IFrameBuffer::ColorFormat::RGB565 == colorFormat) ? "rgb565" : "rgb888";
+  }
+
+  const char* toString(ObjectType objectType)
+  {
+    return (ObjectType::RECTANGLE == objectType) ? "rectangles" : "argb8888_images";
+  }
+
+  const char* toString(Layout layout)
+  {
+    switch (layout)
+    {
+      case Layout::DISJOINT:
+        return "disjoint";
+
+      case Layout::OVERLAPPING:
+        return "overlapping";
+
+      case Layout::PARTIALLY_OFF_SCREEN:
+      default:
+        return "partially_off_screen";
+    }
+  }
+
+  void initBitmap(void)
+  {
+    for (uint32_t pixelIdx = 0u; pixelIdx < (BITMAP_WIDTH * BITMAP_HEIGHT); ++pixelIdx)
+    {
+      // alpha covers fully transparent, translucent and opaque pixels
+      s_argb8888Bitmap[4u * pixelIdx]      = static_cast<uint8_t>(pixelIdx * 7u);
+      s_argb8888Bitmap[4u * pixelIdx + 1u] = static_cast<uint8_t>(pixelIdx * 13u);
+      s_argb8888Bitmap[4u * pixelIdx + 2u] = static_cast<uint8_t>(pixelIdx * 17u);
+      s_argb8888Bitmap[4u * pixelIdx + 3u] = static_cast<uint8_t>((pixelIdx % BITMAP_WIDTH) * 2u);
+    }
+  }
+
+  SceneResult runScene(DMA2D &dma2d, SysTick &sysTick, const SceneConfig &sceneConfig, uint32_t frameCount)
+  {
+    Scene scene(dma2d, sysTick, sceneConfig);
+    GUI::Container &container = scene.getContainer();
+    const GUI::Region frameBufferRegion =
+      { .x = 0, .y = 0, .width = FRAME_BUFFER_WIDTH, .height = FRAME_BUFFER_HEIGHT };
+
+    std::vector<uint64_t> frameTimesInNs(frameCount);
+
+    // warm-up frame, so that the first measured frame does not pay for cold caches
+    container.draw(GUI::DrawHardware::CPU);
+
+    const uint64_t initialAllocationCount = s_allocationCount;
+    uint64_t totalFrameTimeInNs = 0u;
+
+    for (uint32_t frameIdx = 0u; frameIdx < frameCount; ++frameIdx)
+    {
+      container.invalidateRegion(frameBufferRegion);
+
+      const auto startTime = std::chrono::steady_clock::now();
+      container.draw(GUI::DrawHardware::CPU);
+      const auto endTime = std::chrono::steady_clock::now();
+
+      frameTimesInNs[frameIdx] = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count();
+      totalFrameTimeInNs += frameTimesInNs[frameIdx];
+    }
+
+    const uint64_t allocationCount = s_allocationCount - initialAllocationCount;
+
+    std::sort(frameTimesInNs.begin(), frameTimesInNs.end());
+
+    SceneResult sceneResult;
+    sceneResult.pixelsPerFrame      = scene.getVisiblePixelCount();
+    sceneResult.minFrameTimeInNs    = frameTimesInNs.front();
+    sceneResult.medianFrameTimeInNs = frameTimesInNs[frameCount / 2u];
+    sceneResult.maxFrameTimeInNs    = frameTimesInNs.back();
+    sceneResult.megapixelsPerSecond = (0u == totalFrameTimeInNs) ? 0.0 :
+      (1000.0 * sceneResult.pixelsPerFrame * frameCount) / totalFrameTimeInNs;
+    sceneResult.allocationsPerFrame = static_cast<double>(allocationCount) / frameCount;
+
+    return sceneResult;
+  }
+}
+
+void* operator new(std::size_t size)
+{
+  ++s_allocationCount;
+
+  void *memoryPtr = std::malloc((0u == size) ? 1u : size);
+  if (nullptr == memoryPtr)
+  {
+    throw std::bad_alloc();
+  }
+
+  return memoryPtr;
+}
+
+void operator delete(void *memoryPtr) noexcept
+{
+  std::free(memoryPtr);
+}
+
+void operator delete(void *memoryPtr, std::size_t) noexcept
+{
+  std::free(memoryPtr);
+}
+
+int main(int argc, char *argv[])
+{
+  const uint32_t frameCount = (argc > 1) ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : DEFAULT_FRAME_COUNT;
+  if (0u == frameCount)
+  {
+    std::fprintf(stderr, "usage: %s [frame count]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  DMA2DEmulator dma2d;
+  HostSysTick sysTick;
+
+  initBitmap();
+
+  std::printf("color_format,scene,layout,objects,frames,object_pixels_per_frame,frame_time_min_us,frame_time_median_us,"
+              "frame_time_max_us,megapixels_per_second,allocations_per_frame\n");
+
+  for (IFrameBuffer::ColorFormat colorFormat : { IFrameBuffer::ColorFormat::RGB888, IFrameBuffer::ColorFormat::RGB565 })
+  {
+    for (ObjectType objectType : { ObjectType::RECTANGLE, ObjectType::ARGB8888_IMAGE })
+    {
+      for (Layout layout : { Layout::DISJOINT, Layout::OVERLAPPING, Layout::PARTIALLY_OFF_SCREEN })
+      {
+        for (uint32_t objectCount : OBJECT_COUNTS)
+        {
+          const SceneConfig sceneConfig =
+          {
+            .colorFormat = colorFormat,
+            .objectType  = objectType,
+            .layout      = layout,
+            .objectCount = objectCount
+          };
+          const SceneResult sceneResult = runScene(dma2d, sysTick, sceneConfig, frameCount);
+
+          std::printf("%s,%s,%s,%u,%u,%llu,%.3f,%.3f,%.3f,%.2f,%.2f\n",
+            toString(colorFormat),
+            toString(objectType),
+            toString(layout),
+            static_cast<unsigned>(objectCount),
+            static_cast<unsigned>(frameCount),
+            static_cast<unsigned long long>(sceneResult.pixelsPerFrame),
+            sceneResult.minFrameTimeInNs / 1000.0,
+            sceneResult.medianFrameTimeInNs / 1000.0,
+            sceneResult.maxFrameTimeInNs / 1000.0,
+            sceneResult.megapixelsPerSecond,
+            sceneResult.allocationsPerFrame);
+        }
+      }
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
\ No newline at end of file
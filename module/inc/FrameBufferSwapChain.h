@@ -0,0 +1,58 @@
+#ifndef FRAME_BUFFER_SWAP_CHAIN_H
+#define FRAME_BUFFER_SWAP_CHAIN_H
+
+#include "IFrameBuffer.h"
+#include "LTDC.h"
+#include <cstdint>
+
+
+//! Pair of frame buffers, one scanned out by LTDC (front) while the other one is drawn into (back)
+class FrameBufferSwapChain
+{
+public:
+
+  FrameBufferSwapChain(
+    LTDC &ltdc,
+    IFrameBuffer &frameBuffer1,
+    IFrameBuffer &frameBuffer2,
+    LTDC::Layer layer = LTDC::Layer::LAYER1);
+
+  //! This enum class represents errors which can happen during method calls
+  enum class ErrorCode : uint8_t
+  {
+    OK                      = 0u,
+    PRESENT_ALREADY_PENDING = 1u
+  };
+
+  //! Moment in which LTDC latches the address of the presented frame buffer
+  enum class ReloadMode : uint8_t
+  {
+    VERTICAL_BLANK = 0u,
+    IMMEDIATE      = 1u
+  };
+
+  IFrameBuffer& getFrontBuffer(void);
+  IFrameBuffer& getBackBuffer(void);
+
+  //! In DSI adapted command mode without auto-refresh, LTDC has vertical blanking only while a display refresh
+  //! is ongoing, so VERTICAL_BLANK would keep the back buffer unavailable until the next refresh. There,
+  //! IMMEDIATE has to be used while no refresh is ongoing, as nothing is scanned out between two refreshes.
+  ErrorCode present(ReloadMode reloadMode = ReloadMode::VERTICAL_BLANK);
+
+  bool isBackBufferAvailable(void) const;
+
+private:
+
+  static constexpr uint8_t FRAME_BUFFER_COUNT = 2u;
+
+  //! Reference to LTDC
+  LTDC &m_ltdc;
+
+  LTDC::Layer m_layer;
+
+  IFrameBuffer *m_frameBufferPtr[FRAME_BUFFER_COUNT];
+
+  uint8_t m_frontBufferIndex;
+};
+
+#endif // #ifndef FRAME_BUFFER_SWAP_CHAIN_H
\ No newline at end of file
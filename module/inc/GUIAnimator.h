@@ -0,0 +1,162 @@
+#ifndef GUI_ANIMATOR_H
+#define GUI_ANIMATOR_H
+
+#include "IGUIObject.h"
+#include "GUICommon.h"
+#include "SysTick.h"
+#include <cstdint>
+
+
+namespace GUI
+{
+  //! Drives tweens of position, color and opacity from SysTick time, so motion speed does not depend on
+  //! frame rate and a late frame simply jumps to the value of the moment it is drawn
+  class Animator
+  {
+  public:
+
+    static constexpr uint32_t MAX_ANIMATION_COUNT = 8u;
+
+    //! Number of segments of each easing lookup table, values between entries are linearly interpolated
+    static constexpr uint32_t EASING_LUT_SEGMENT_COUNT = 32u;
+
+    //! Fixed point one of eased progress
+    static constexpr uint32_t PROGRESS_ONE = 65536u;
+
+    typedef void (*ColorSetterFunc)(void*, Color);
+    typedef void (*OpacitySetterFunc)(void*, uint8_t);
+
+    Animator(SysTick &sysTick);
+
+    enum class Easing : uint8_t
+    {
+      LINEAR      = 0u,
+      EASE_IN     = 1u,
+      EASE_OUT    = 2u,
+      EASE_IN_OUT = 3u,
+      COUNT
+    };
+
+    enum class Repeat : uint8_t
+    {
+      ONCE      = 0u,
+      LOOP      = 1u,
+      //! Every odd cycle runs from the end value back to the start value
+      PING_PONG = 2u
+    };
+
+    struct AnimationDescription
+    {
+      uint32_t durationInMs;
+      Easing easing;
+      Repeat repeat;
+      //! Animation starts as if it had already run for this time, e.g. to continue from the current value
+      uint32_t startOffsetInMs;
+    };
+
+    struct ColorSetterDescription
+    {
+      ColorSetterFunc functionPtr;
+      void *argument;
+    };
+
+    struct OpacitySetterDescription
+    {
+      OpacitySetterFunc functionPtr;
+      void *argument;
+    };
+
+    //! Position tween moves the object with moveToPosition, the tag of the start position is used for both
+    ErrorCode animatePosition(
+      IObject &object,
+      Position startPosition,
+      Position endPosition,
+      const AnimationDescription &animationDescription);
+
+    ErrorCode animateColor(
+      const ColorSetterDescription &colorSetter,
+      Color startColor,
+      Color endColor,
+      const AnimationDescription &animationDescription);
+
+    ErrorCode animateOpacity(
+      const OpacitySetterDescription &opacitySetter,
+      uint8_t startOpacity,
+      uint8_t endOpacity,
+      const AnimationDescription &animationDescription);
+
+    //! Stops all animations of the object, or of the setter with the given argument
+    void stop(const void *targetPtr);
+    void stopAll(void);
+
+    //! While paused, time of animations does not pass
+    void pause(void);
+    void resume(void);
+
+    inline bool isPaused(void) const
+    {
+      return m_isPaused;
+    }
+
+    bool isAnimating(void) const;
+
+    //! Applies values of all running animations at one SysTick timestamp, it is meant to be called right
+    //! before Container::draw, values which did not change since the last update are not applied again
+    void update(void);
+
+    //! Returns eased progress (0 to PROGRESS_ONE) of linear progress (0 to PROGRESS_ONE)
+    static uint32_t ease(Easing easing, uint32_t progress);
+
+  private:
+
+    enum class Property : uint8_t
+    {
+      POSITION = 0u,
+      COLOR    = 1u,
+      OPACITY  = 2u
+    };
+
+    struct Animation
+    {
+      bool isActive;
+      Property property;
+      AnimationDescription description;
+      uint64_t startTimestamp;
+      uint64_t durationInTicks;
+      IObject *objectPtr;
+      ColorSetterDescription colorSetter;
+      OpacitySetterDescription opacitySetter;
+      Position startPosition;
+      Position endPosition;
+      Color startColor;
+      Color endColor;
+      Color lastColor;
+      uint8_t startOpacity;
+      uint8_t endOpacity;
+      uint8_t lastOpacity;
+      bool isApplied;
+    };
+
+    Animation* allocateAnimation(const AnimationDescription &animationDescription);
+
+    uint32_t getProgress(const Animation &animation, uint64_t timestamp) const;
+
+    void applyPosition(Animation &animation, uint32_t progress);
+    void applyColor(Animation &animation, uint32_t progress);
+    void applyOpacity(Animation &animation, uint32_t progress);
+
+    static int32_t interpolate(int32_t startValue, int32_t endValue, uint32_t progress);
+    static const void* getTarget(const Animation &animation);
+
+    //! Reference to SysTick
+    SysTick &m_sysTick;
+
+    Animation m_animations[MAX_ANIMATION_COUNT];
+
+    bool m_isPaused;
+
+    uint64_t m_pauseTimestamp;
+  };
+}
+
+#endif // #ifndef GUI_ANIMATOR_H
\ No newline at end of file
@@ -0,0 +1,32 @@
+#ifndef GUI_BLITTER_H
+#define GUI_BLITTER_H
+
+#include "GUICommon.h"
+#include <cstdint>
+
+
+namespace GUI
+{
+  //! Row kernels used by CPU drawing of GUI objects
+  class Blitter
+  {
+  public:
+
+    //! Copies row of RGB888 pixels, as the row is one contiguous span it is a single block copy
+    static void copyRowRGB888(uint8_t *destinationPtr, const uint8_t *sourcePtr, uint32_t numberOfPixels);
+
+    //! Fills row of RGB888 pixels with 32-bit stores of 12-byte pattern (4 pixels), head and tail bytes are stored one by one
+    static void fillRowRGB888(uint8_t *destinationPtr, Color color, uint32_t numberOfPixels);
+
+    //! Blends row of ARGB8888 pixels over row of RGB888 pixels, result is bit-exact to (a * s + (255 - a) * d) / 255
+    static void blendRowARGB8888ToRGB888(uint8_t *destinationPtr, const uint8_t *sourcePtr, uint32_t numberOfPixels);
+
+    //! Exact integer division by 255 for values in range [0, 255 * 255]
+    static inline uint32_t divideBy255(uint32_t value)
+    {
+      return (value + 1u + (value >> 8u)) >> 8u;
+    }
+  };
+}
+
+#endif // #ifndef GUI_BLITTER_H
\ No newline at end of file
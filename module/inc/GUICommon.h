@@ -16,13 +16,21 @@ namespace GUI
     Z_INDEX_ALREADY_IN_USAGE       = 4u,
     CONTAINER_FULL_ERROR           = 5u,
     DMA2D_TRANSACTION_ONGOING      = 6u,
+    DMA2D_COMMAND_QUEUE_FULL       = 7u,
+    INCOMPATIBLE_TILE_FBUFF        = 8u,
+    DMA2D_UNSUPPORTED_OPERATION    = 9u,
+    ANIMATOR_FULL_ERROR            = 10u,
   };
 
   //! TODO
   enum class DrawHardware : uint8_t
   {
-    CPU   = 0u,
-    DMA2D = 1u
+    CPU    = 0u,
+    DMA2D  = 1u,
+    //! Container draws large objects with DMA2D and, concurrently, small non-overlapping ones with CPU
+    HYBRID = 2u,
+    //! Each object is drawn with the hardware which its measured draw cost model estimates as cheaper
+    AUTO   = 3u
   };
 
   //! TODO
@@ -30,6 +38,9 @@ namespace GUI
   {
     ARGB8888 = 0u,
     RGB888   = 1u,
+    L8       = 2u,
+    L4       = 3u,
+    RLE      = 4u,
   };
 
   //! TODO
@@ -93,6 +104,156 @@ namespace GUI
     uint16_t height;
   };
 
+  //! TODO This struct represents axis aligned rectangular area of the frame buffer (e.g. damaged or clip area)
+  struct Region
+  {
+    inline bool operator==(const Region &region) const
+    {
+      return (region.x == x) && (region.y == y) && (region.width == width) && (region.height == height);
+    }
+
+    inline bool operator!=(const Region &region) const
+    {
+      return not (region == *this);
+    }
+
+    inline bool isEmpty(void) const
+    {
+      return (0u == width) || (0u == height);
+    }
+
+    inline uint32_t getArea(void) const
+    {
+      return static_cast<uint32_t>(width) * height;
+    }
+
+    inline bool doesOverlap(const Region &region) const
+    {
+      return not getIntersection(region).isEmpty();
+    }
+
+    inline bool doesContain(const Region &region) const
+    {
+      return getIntersection(region) == region;
+    }
+
+    inline Region getIntersection(const Region &region) const
+    {
+      const int32_t left   = (x > region.x) ? x : region.x;
+      const int32_t top    = (y > region.y) ? y : region.y;
+      const int32_t right  = (getRight() < region.getRight()) ? getRight() : region.getRight();
+      const int32_t bottom = (getBottom() < region.getBottom()) ? getBottom() : region.getBottom();
+
+      if ((left >= right) || (top >= bottom))
+      {
+        return { .x = 0, .y = 0, .width = 0u, .height = 0u };
+      }
+
+      return
+      {
+        .x      = static_cast<int16_t>(left),
+        .y      = static_cast<int16_t>(top),
+        .width  = static_cast<uint16_t>(right - left),
+        .height = static_cast<uint16_t>(bottom - top)
+      };
+    }
+
+    inline Region getUnion(const Region &region) const
+    {
+      if (isEmpty())
+      {
+        return region;
+      }
+      else if (region.isEmpty())
+      {
+        return *this;
+      }
+
+      const int32_t left   = (x < region.x) ? x : region.x;
+      const int32_t top    = (y < region.y) ? y : region.y;
+      const int32_t right  = (getRight() > region.getRight()) ? getRight() : region.getRight();
+      const int32_t bottom = (getBottom() > region.getBottom()) ? getBottom() : region.getBottom();
+
+      return
+      {
+        .x      = static_cast<int16_t>(left),
+        .y      = static_cast<int16_t>(top),
+        .width  = static_cast<uint16_t>(right - left),
+        .height = static_cast<uint16_t>(bottom - top)
+      };
+    }
+
+    //! Returns part of the region not covered by the given one, as long as that part is rectangular
+    //! (otherwise the region is returned unchanged, which is a safe over-approximation)
+    inline Region getDifference(const Region &region) const
+    {
+      const Region intersection = getIntersection(region);
+
+      if (intersection.isEmpty())
+      {
+        return *this;
+      }
+      else if (intersection == *this)
+      {
+        return { .x = 0, .y = 0, .width = 0u, .height = 0u };
+      }
+
+      if ((intersection.x == x) && (intersection.width == width))
+      {
+        if (intersection.y == y)
+        {
+          return cropRows(intersection.getBottom(), getBottom());
+        }
+        else if (intersection.getBottom() == getBottom())
+        {
+          return cropRows(y, intersection.y);
+        }
+      }
+      else if ((intersection.y == y) && (intersection.height == height))
+      {
+        if (intersection.x == x)
+        {
+          return cropColumns(intersection.getRight(), getRight());
+        }
+        else if (intersection.getRight() == getRight())
+        {
+          return cropColumns(x, intersection.x);
+        }
+      }
+
+      return *this;
+    }
+
+    //! Returns first column right of the region (exclusive bound)
+    inline int32_t getRight(void) const
+    {
+      return static_cast<int32_t>(x) + width;
+    }
+
+    //! Returns first row below the region (exclusive bound)
+    inline int32_t getBottom(void) const
+    {
+      return static_cast<int32_t>(y) + height;
+    }
+
+    int16_t x;
+    int16_t y;
+    uint16_t width;
+    uint16_t height;
+
+  private:
+
+    inline Region cropRows(int32_t top, int32_t bottom) const
+    {
+      return { .x = x, .y = static_cast<int16_t>(top), .width = width, .height = static_cast<uint16_t>(bottom - top) };
+    }
+
+    inline Region cropColumns(int32_t left, int32_t right) const
+    {
+      return { .x = static_cast<int16_t>(left), .y = y, .width = static_cast<uint16_t>(right - left), .height = height };
+    }
+  };
+
   //! TODO
   struct Color
   {
@@ -106,6 +267,27 @@ namespace GUI
       return not (color == *this);
     }
 
+    //! Lower bits of each component which do not fit into RGB565 pixel are dropped
+    inline uint16_t toRGB565(void) const
+    {
+      return static_cast<uint16_t>(((red & 0xF8u) << 8u) | ((green & 0xFCu) << 3u) | (blue >> 3u));
+    }
+
+    //! Components are expanded to 8 bits by replicating their upper bits, so white stays white
+    static inline Color fromRGB565(uint16_t pixel)
+    {
+      const uint8_t red5   = static_cast<uint8_t>((pixel >> 11u) & 0x1Fu);
+      const uint8_t green6 = static_cast<uint8_t>((pixel >> 5u) & 0x3Fu);
+      const uint8_t blue5  = static_cast<uint8_t>(pixel & 0x1Fu);
+
+      return
+      {
+        .red   = static_cast<uint8_t>((red5 << 3u) | (red5 >> 2u)),
+        .green = static_cast<uint8_t>((green6 << 2u) | (green6 >> 4u)),
+        .blue  = static_cast<uint8_t>((blue5 << 3u) | (blue5 >> 2u))
+      };
+    }
+
     uint8_t red;
     uint8_t green;
     uint8_t blue;
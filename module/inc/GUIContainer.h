@@ -3,8 +3,12 @@
 
 #include "IGUIContainer.h"
 #include "IArrayList.h"
+#include "ArrayList.h"
 #include "IGUIObject.h"
 #include "IFrameBuffer.h"
+#include "ITileFrameBuffer.h"
+#include "DMA2D.h"
+#include "GUIFrameProfiler.h"
 
 
 namespace GUI
@@ -21,6 +25,9 @@ namespace GUI
 
     Container(IArrayList<ObjectInfo> &objectInfoList, IFrameBuffer &frameBuffer);
 
+    //! Objects drawn with DMA2D are batched into the DMA2D command queue instead of being drawn one by one
+    Container(IArrayList<ObjectInfo> &objectInfoList, IFrameBuffer &frameBuffer, DMA2D &dma2d);
+
     class Iterator
     {
     public:
@@ -56,8 +63,27 @@ namespace GUI
     IObject* getObject(uint32_t zIndex) override;
     ErrorCode addObject(IObject *objectPtr, uint32_t zIndex) override;
 
+    void invalidateRegion(const Region &region) override;
+
+    //! Objects are drawn tile by tile into the tile frame buffer, and each tile is then copied into the frame buffer
+    ErrorCode enableTiledRendering(ITileFrameBuffer &tileFrameBuffer);
+    void disableTiledRendering(void);
+    bool isTiledRenderingEnabled(void) const;
+
+    //! Profiler records every frame drawn by the container, until it is detached
+    void attachFrameProfiler(FrameProfiler &frameProfiler);
+    void detachFrameProfiler(void);
+
     void draw(DrawHardware drawHardware) override;
     bool isDrawCompleted(void) const override;
+
+    //! Continues draw calls after DMA2D completes its part, has to be called from the main loop
+    void runtimeTask(void);
+
+    //! Bounding box of all regions redrawn by the last draw call, empty if nothing was redrawn. Only this part
+    //! of the frame buffer differs from the previous frame, so only it has to be sent to the display.
+    Region getLastDrawnRegion(void) const;
+
     ErrorCode getDrawingTime(DrawHardware drawHardware, uint64_t &drawingTimeInUs) const override;
 
     void registerDrawCompletedCallback(const CallbackDescription &callbackDescription) override;
@@ -68,10 +94,40 @@ namespace GUI
 
   private:
 
+    //! Maximum number of disjoint damaged regions tracked between two draws, overflow is merged
+    static constexpr uint32_t MAX_DAMAGED_REGION_COUNT = 8u;
+
+    //! In hybrid drawing, objects whose visible part has at least this many pixels are drawn by DMA2D
+    static constexpr uint32_t HYBRID_DMA2D_MIN_VISIBLE_AREA = 1024u;
+
+    //! Maximum number of objects drawn by CPU while one hybrid DMA2D batch is being executed
+    static constexpr uint32_t MAX_HYBRID_CPU_OBJECT_COUNT = 8u;
+
+    //! Touch hit-testing index divides the frame buffer into HIT_TEST_GRID_SIZE x HIT_TEST_GRID_SIZE cells
+    static constexpr uint32_t HIT_TEST_GRID_SIZE = 8u;
+
+    //! Each grid cell is a bitmask over z-ordered objects, containers with more objects are hit-tested linearly
+    static constexpr uint32_t MAX_HIT_TEST_GRID_OBJECT_COUNT = 64u;
+
+    struct HybridCPUDrawInfo
+    {
+      IObject *objectPtr;
+      uint32_t zIndex;
+      Region clipRegion;
+    };
+
     bool doesGUIObjectContainAnyOfTouchPoints(
       const IObject &guiObject,
       const IArrayList<Point> &touchPoints);
 
+    IObject* findEventTargetLinearly(const IArrayList<Point> &touchPoints);
+    IObject* findEventTargetInHitTestGrid(uint64_t candidateObjectMask, const IArrayList<Point> &touchPoints);
+    bool getHitTestGridCandidateObjectMask(const IArrayList<Point> &touchPoints, uint64_t &candidateObjectMask);
+    bool getHitTestGridCellIdx(Point point, uint32_t &cellIdx) const;
+    void rebuildHitTestGrid(void);
+    uint16_t getHitTestGridCellWidth(void) const;
+    uint16_t getHitTestGridCellHeight(void) const;
+
     Position getPositionTopLeftCorner(void) const;
     Position getPositionTopRightCorner(void) const;
     Position getPositionBottomLeftCorner(void) const;
@@ -80,33 +136,158 @@ namespace GUI
 
     void drawDMA2D(void);
     void drawCPU(void);
+    void drawHybrid(void);
+    void drawAuto(void);
+    void drawAutoObjects(void);
+    void continueAutoDrawing(void);
 
     void startDrawingTransaction(DrawHardware drawHardware);
     void endDrawingTransaction(void);
 
     void callDrawCompletedCallbackIfRegistered(void);
 
-    bool startDrawingOfTheNextObjectWithDMA2D(void);
+    bool startDrawingOfTheNextObject(void);
+    void drawDMA2DBatches(void);
+    void continueDMA2DDrawing(void);
+    bool enqueueDMA2DDrawCommandsOfRemainingObjects(void);
+    void executeDMA2DBatch(void);
+    DMA2D::ErrorCode executeDMA2DCommandQueue(void (*queueCompletedCallbackFunctionPtr)(void*));
+    void endDMA2DBatchProfiling(void);
+
+    void drawHybridBatches(void);
+    void continueHybridDrawing(void);
+    void prepareHybridBatch(void);
+    void executeHybridDMA2DPart(void);
+    void drawHybridCPUPart(void);
+    bool doesRegionOverlapHybridDMA2DPart(const Region &region) const;
+    bool doesRegionOverlapHybridCPUPart(const Region &region) const;
+
+    void drawTiledDMA2D(void);
+    void drawTiledCPU(void);
+    void startTiledDrawing(void);
+    void endTiledDrawing(void);
+    bool prepareNextTileDrawing(void);
+    void loadCurrentTileFromFrameBufferCPU(void);
+    void storeCurrentTileIntoFrameBufferCPU(void);
+    void drawTiledDMA2DBatches(void);
+    void enqueueTiledDMA2DDrawCommands(void);
+    bool enqueueCurrentTileLoadCommands(void);
+    bool enqueueCurrentTileStoreCommands(void);
+    bool enqueueCopyRegionCommand(
+      const Region &region,
+      const IFrameBuffer &sourceFrameBuffer,
+      IFrameBuffer &destinationFrameBuffer);
+    bool isCurrentTileDrawingCompleted(void);
+    bool isCurrentTileLoadNeeded(const Region &region);
+    bool isRegionCoveredByOpaqueObject(const Region &region);
+    void setFrameBufferOfAllObjects(IFrameBuffer &frameBuffer);
+
+    bool findNextObjectToDraw(void);
+    Region calculateVisibleRegionOfCurrentObject(void);
+    void drawCurrentObject(DrawHardware drawHardware);
+    void drawObjectWithCPU(IObject *objectPtr, uint32_t zIndex, const Region &clipRegion);
+    void resetClipRegionOfAllObjects(void);
+
+    Region getFrameBufferRegion(void) const;
+    void invalidateRegionsDrawnIntoOtherFrameBuffer(void);
+    void mergeIntoDamagedRegionWithTheLeastGrowth(const Region &region);
 
     IObject* findObjectAtZIndex(uint32_t zIndex) const;
 
     ErrorCode insertObjectInfoIntoList(const ObjectInfo &objectInfo);
 
+    static void copyRegionCPU(
+      const Region &region,
+      const IFrameBuffer &sourceFrameBuffer,
+      IFrameBuffer &destinationFrameBuffer);
+
     static ErrorCode mapToErrorCode(IArrayListBase::ErrorCode errorCode);
+    static DMA2D::InputColorFormat mapToDMA2DInputColorFormat(IFrameBuffer::ColorFormat colorFormat);
+    static DMA2D::OutputColorFormat mapToDMA2DOutputColorFormat(IFrameBuffer::ColorFormat colorFormat);
 
     static void objectDrawingCompletedCallback(void *guiContainerPtr);
+    static void dma2dCommandQueueCompletedCallback(void *guiContainerPtr);
+    static void dma2dHybridCommandQueueCompletedCallback(void *guiContainerPtr);
+    static void objectDamagedRegionCallback(void *guiContainerPtr, const Region &region);
 
     IArrayList<ObjectInfo> &m_objectInfoList;
 
     IFrameBuffer *m_frameBufferPtr;
 
+    //! Frame buffer used before the current one, e.g. the other buffer of a swap chain
+    IFrameBuffer *m_previousFrameBufferPtr;
+
     Iterator m_currentDrawingObjectIterator;
 
+    //! Regions which have to be redrawn at the next draw call
+    ArrayList<Region, MAX_DAMAGED_REGION_COUNT> m_damagedRegionList;
+
+    //! Regions which are being redrawn by the ongoing draw call
+    ArrayList<Region, MAX_DAMAGED_REGION_COUNT> m_drawingRegionList;
+
+    IArrayList<Region>::Iterator m_currentDrawingRegionIterator;
+
+    //! Bounding box of the regions redrawn by the last draw call
+    Region m_lastDrawnRegion = {};
+
+    //! Part of the current damaged region in which the current object is visible (not hidden by opaque objects)
+    Region m_currentDrawingClipRegion;
+
     CallbackDescription m_drawCompletedCallback;
 
     bool m_isDrawingCompleted = true;
 
     DrawHardware m_drawHardwareInUsage = DrawHardware::CPU;
+
+    //! DMA2D whose command queue is used for drawing, if not set objects are drawn one by one
+    DMA2D *m_dma2dPtr = nullptr;
+
+    //! Visible regions of objects enqueued into DMA2D part of the ongoing hybrid batch
+    ArrayList<Region, DMA2D::COMMAND_QUEUE_CAPACITY> m_hybridDMA2DRegionList;
+
+    //! Objects drawn by CPU while DMA2D part of the ongoing hybrid batch is being executed
+    ArrayList<HybridCPUDrawInfo, MAX_HYBRID_CPU_OBJECT_COUNT> m_hybridCPUDrawInfoList;
+
+    //! Set once the DMA2D command queue batch of the ongoing draw call is completed, accessed only atomically
+    bool m_isDMA2DBatchCompleted = false;
+
+    //! DMA2D was busy when the command queue batch of the ongoing draw call had to be executed
+    bool m_isDMA2DBatchExecutionPending = false;
+
+    //! Set once DMA2D part of the ongoing hybrid batch is completed, accessed only atomically
+    bool m_isHybridDMA2DPartCompleted = false;
+
+    //! DMA2D was busy when DMA2D part of the ongoing hybrid batch had to be executed
+    bool m_isHybridDMA2DPartExecutionPending = false;
+
+    //! Set once the object drawn by the ongoing AUTO draw call is completed, accessed only atomically
+    bool m_isAutoObjectDrawingCompleted = false;
+
+    FrameProfiler *m_frameProfilerPtr = nullptr;
+
+    //! Bit i of a cell is set if the region of the i-th object of the z-ordered object list overlaps the cell
+    uint64_t m_hitTestGrid[HIT_TEST_GRID_SIZE * HIT_TEST_GRID_SIZE] = {};
+
+    //! Grid is rebuilt lazily, on the first hit test after an object is added, moved or resized
+    bool m_isHitTestGridValid = false;
+
+    //! Object found by the last hit test, events targeting it are dispatched without walking the object list
+    IObject *m_lastEventTargetPtr = nullptr;
+
+    //! Tile frame buffer used for tiled rendering, if not set objects are drawn directly into the frame buffer
+    ITileFrameBuffer *m_tileFrameBufferPtr = nullptr;
+
+    //! Damaged regions of the ongoing tiled draw call, m_drawingRegionList holds only their parts inside the current tile
+    ArrayList<Region, MAX_DAMAGED_REGION_COUNT> m_tiledDrawingRegionList;
+
+    //! Rows of the frame buffer covered by the current tile
+    Region m_currentTileRegion;
+
+    //! Next part of the current tile to be loaded from the frame buffer, needed where no opaque object covers it
+    IArrayList<Region>::Iterator m_currentTileLoadRegionIterator;
+
+    //! Next part of the current tile to be stored into the frame buffer
+    IArrayList<Region>::Iterator m_currentTileStoreRegionIterator;
   };
 }
 
@@ -0,0 +1,63 @@
+#ifndef GUI_DRAW_COST_MODEL_H
+#define GUI_DRAW_COST_MODEL_H
+
+#include "GUICommon.h"
+#include <cstdint>
+
+
+namespace GUI
+{
+  //! Estimates drawing time on CPU and DMA2D as fixed setup cost plus cost per pixel, both fitted to
+  //! measured draws with exponentially weighted linear regression
+  class DrawCostModel
+  {
+  public:
+
+    //! Weight of the newest measurement in the exponentially weighted averages
+    static constexpr float SMOOTHING_FACTOR = 0.125f;
+
+    //! Every n-th selection picks the more expensive hardware, so its estimate follows changes of the workload
+    static constexpr uint32_t EXPLORATION_PERIOD = 32u;
+
+    void reset(void);
+
+    void update(DrawHardware drawHardware, uint64_t visiblePartArea, uint64_t drawingTimeInUs);
+
+    bool isCalibrated(DrawHardware drawHardware) const;
+
+    float getSetupCostInUs(DrawHardware drawHardware) const;
+    float getCostPerPixelInUs(DrawHardware drawHardware) const;
+    float estimateDrawingTimeInUs(DrawHardware drawHardware, uint64_t visiblePartArea) const;
+
+    //! Picks the cheaper of CPU and DMA2D, uncalibrated hardware is picked first to get measured
+    DrawHardware selectDrawHardware(uint64_t visiblePartArea);
+
+  private:
+
+    static constexpr uint8_t DISTINCT_DRAW_HARDWARE_COUNT = 2u;
+
+    //! Below this area variance all samples are of about the same size, so setup cost can not be separated
+    static constexpr float MIN_AREA_VARIANCE = 1.0f;
+
+    struct Statistics
+    {
+      uint32_t sampleCount;
+      float meanArea;
+      float meanDrawingTime;
+      float areaVariance;
+      float areaDrawingTimeCovariance;
+    };
+
+    const Statistics* getStatistics(DrawHardware drawHardware) const;
+
+    Statistics m_statistics[DISTINCT_DRAW_HARDWARE_COUNT] =
+    {
+      { .sampleCount = 0u, .meanArea = 0.0f, .meanDrawingTime = 0.0f, .areaVariance = 0.0f, .areaDrawingTimeCovariance = 0.0f },
+      { .sampleCount = 0u, .meanArea = 0.0f, .meanDrawingTime = 0.0f, .areaVariance = 0.0f, .areaDrawingTimeCovariance = 0.0f }
+    };
+
+    uint32_t m_selectionCounter = 0u;
+  };
+}
+
+#endif // #ifndef GUI_DRAW_COST_MODEL_H
\ No newline at end of file
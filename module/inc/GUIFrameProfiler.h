@@ -0,0 +1,147 @@
+#ifndef GUI_FRAME_PROFILER_H
+#define GUI_FRAME_PROFILER_H
+
+#include "IGUIObject.h"
+#include "IStringBuilder.h"
+#include "USARTLogger.h"
+#include "SysTick.h"
+#include "DMA2D.h"
+#include <cstdint>
+
+
+namespace GUI
+{
+  //! Records duration, DMA2D and CPU time, pixel count and the most expensive objects of each frame drawn
+  //! by the container it is attached to, and keeps rolling statistics of the last frames
+  class FrameProfiler
+  {
+  public:
+
+    //! Number of the most expensive objects kept for each frame
+    static constexpr uint32_t TOP_OBJECT_COUNT = 4u;
+
+    //! Number of the last frames over which rolling statistics are calculated
+    static constexpr uint32_t FRAME_HISTORY_LENGTH = 128u;
+
+    //! Maximum number of distinct objects tracked within one frame, the cheapest one is dropped on overflow
+    static constexpr uint32_t MAX_FRAME_OBJECT_COUNT = 16u;
+
+    FrameProfiler(SysTick &sysTick);
+
+    enum class Metric : uint8_t
+    {
+      TOTAL_TIME  = 0u,
+      DMA2D_TIME  = 1u,
+      CPU_TIME    = 2u,
+      PIXEL_COUNT = 3u,
+      COUNT
+    };
+
+    struct ObjectProfile
+    {
+      const IObject *objectPtr;
+      uint32_t zIndex;
+      uint32_t drawingTimeInUs;
+      uint32_t pixelCount;
+    };
+
+    struct FrameProfile
+    {
+      //! Time from the start of the draw call until the draw completed callback
+      uint32_t totalTimeInUs;
+      //! Time during which DMA2D was drawing, it can overlap with CPU time
+      uint32_t dma2dTimeInUs;
+      //! Time during which CPU was drawing objects
+      uint32_t cpuTimeInUs;
+      //! Number of pixels drawn by objects, pixels drawn by several overlapping objects are counted several times
+      uint32_t pixelCount;
+      //! The most expensive objects, sorted from the most expensive one
+      ObjectProfile topObjects[TOP_OBJECT_COUNT];
+      uint32_t topObjectCount;
+    };
+
+    struct Statistics
+    {
+      uint32_t frameCount;
+      uint32_t min;
+      uint32_t average;
+      uint32_t max;
+      uint32_t p99;
+    };
+
+    void reset(void);
+
+    void startFrame(void);
+    void endFrame(void);
+    bool isFrameOngoing(void) const;
+
+    //! Records object drawn by CPU synchronously since the given timestamp
+    void addCPUDrawing(const IObject *objectPtr, uint32_t zIndex, uint64_t startTimestamp, uint32_t pixelCount);
+
+    //! Object drawn asynchronously is tracked from its draw call, over the return of the draw call, to its completion
+    uint32_t startObjectDrawing(const IObject *objectPtr, uint32_t zIndex, uint32_t pixelCount);
+    void returnFromObjectDrawing(uint32_t objectDrawingId);
+    void endObjectDrawing(void);
+
+    //! Objects enqueued into DMA2D batch share the batch time in proportion to their pixel counts
+    void addDMA2DBatchObject(const IObject *objectPtr, uint32_t zIndex, uint32_t pixelCount);
+    void startDMA2DBatch(void);
+    void endDMA2DBatch(void);
+
+    uint64_t getTimestamp(void) const;
+
+    const FrameProfile& getLastFrameProfile(void) const;
+    Statistics getStatistics(Metric metric) const;
+
+    void dump(USARTLogger &usartLogger, IStringBuilder &stringBuilder) const;
+
+  private:
+
+    struct ObjectDrawingInfo
+    {
+      ObjectProfile objectProfile;
+      uint32_t id;
+      uint64_t startTimestamp;
+      uint64_t returnTimestamp;
+      bool isReturned;
+    };
+
+    void addObjectProfile(const ObjectProfile &objectProfile);
+    void selectTopObjects(void);
+    void storeFrameIntoHistory(void);
+
+    void appendStatisticsLine(IStringBuilder &stringBuilder, const char *metricName, Metric metric) const;
+    void appendObjectLine(IStringBuilder &stringBuilder, uint32_t rank, const ObjectProfile &objectProfile) const;
+
+    static uint32_t saturateToUint32(uint64_t value);
+
+    //! Reference to SysTick
+    SysTick &m_sysTick;
+
+    bool m_isFrameOngoing;
+
+    uint64_t m_frameStartTimestamp;
+
+    FrameProfile m_currentFrameProfile;
+
+    FrameProfile m_lastFrameProfile;
+
+    //! Objects drawn in the ongoing frame, top objects are selected from them at the end of the frame
+    ObjectProfile m_frameObjectProfiles[MAX_FRAME_OBJECT_COUNT];
+    uint32_t m_frameObjectCount;
+
+    ObjectDrawingInfo m_ongoingObjectDrawingInfo;
+    uint32_t m_lastObjectDrawingId;
+
+    uint64_t m_dma2dBatchStartTimestamp;
+    ObjectProfile m_dma2dBatchObjectProfiles[DMA2D::COMMAND_QUEUE_CAPACITY];
+    uint32_t m_dma2dBatchObjectCount;
+
+    //! Ring buffer of metrics of the last frames
+    uint32_t m_frameHistory[static_cast<uint8_t>(Metric::COUNT)][FRAME_HISTORY_LENGTH];
+    uint32_t m_frameHistoryNextIndex;
+    uint32_t m_frameHistorySize;
+  };
+}
+
+#endif // #ifndef GUI_FRAME_PROFILER_H
\ No newline at end of file
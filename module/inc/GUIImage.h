@@ -15,12 +15,29 @@ namespace GUI
 
     Image(DMA2D &dma2d, SysTick &sysTick, IFrameBuffer &frameBuffer);
 
+    //! Run types of RLE bitmap, stored in the two most significant bits of the run header byte
+    enum class RLERunType : uint8_t
+    {
+      TRANSPARENT = 0u,
+      OPAQUE      = 1u,
+      BLENDED     = 2u
+    };
+
+    //! Run length is stored decremented by one in the six least significant bits of the run header byte
+    static constexpr uint16_t RLE_MAX_RUN_LENGTH = 64u;
+
+    //! Indexed bitmaps (L8, L4) look up colors in CLUT with ARGB8888 entries (0xAARRGGBB),
+    //! L4 bitmaps store the first pixel in the low nibble and must have even width.
+    //! RLE bitmaps are streams of runs, where runs never cross the row end. Each run is the header byte
+    //! followed by pixels in RGB888 (opaque run) or ARGB8888 (blended run) byte order, transparent run has no pixels.
     struct BitmapDescription
     {
       ColorFormat colorFormat;
       Dimension dimension;
       Position copyPosition;
       const void *bitmapPtr;
+      const uint32_t *clutPtr;
+      uint16_t clutSize;
     };
 
     struct ImageDescription
@@ -35,6 +52,14 @@ namespace GUI
 
     void moveToPosition(const Position &position) override;
 
+    void setClipRegion(const Region &clipRegion) override;
+    void resetClipRegion(void) override;
+
+    void setBitmap(const BitmapDescription &bitmapDescription);
+
+    //! Image is opaque only if its bitmap has no alpha channel or all entries of its CLUT are opaque
+    bool isOpaque(void) const override;
+
     inline ColorFormat getBitmapColorFormat(void) const
     {
       return m_bitmapDescription.colorFormat;
@@ -45,6 +70,16 @@ namespace GUI
       return m_bitmapDescription.dimension;
     }
 
+    inline const uint32_t* getBitmapCLUTPtr(void) const
+    {
+      return m_bitmapDescription.clutPtr;
+    }
+
+    inline uint16_t getBitmapCLUTSize(void) const
+    {
+      return m_bitmapDescription.clutSize;
+    }
+
     inline Position getBitmapCopyPosition(void) const
     {
       return m_bitmapDescription.copyPosition;
@@ -52,6 +87,9 @@ namespace GUI
 
     Position getBitmapVisiblePartCopyPosition(void) const;
 
+    //! Images are modeled per bitmap color format, as e.g. RLE decoding costs far more than a plain copy
+    DrawCostModel& getDrawCostModel(void) const override;
+
     const void* getBitmapPtr(void) const
     {
       return m_bitmapDescription.bitmapPtr;
@@ -59,27 +97,64 @@ namespace GUI
 
   private:
 
+    static constexpr uint8_t DISTINCT_COLOR_FORMAT_COUNT = 5u;
+
     void drawCPU(void) override;
     void drawDMA2D(void) override;
+    ErrorCode enqueueDMA2DCommands(void) override;
+
+    //! DMA2D is not able to decode RLE bitmap, nor to read L4 bitmap from the middle of a byte
+    bool canBeDrawnByDMA2D(void) const override;
 
-    void drawDMA2DFromBitmapRGB888ToFrameBufferRGB888(void);
-    void drawDMA2DFromBitmapARGB8888ToFrameBufferRGB888(void);
+    void drawDMA2DFromBitmapRGB888(void);
+    void drawDMA2DFromBitmapARGB8888(void);
 
+    void drawCPUFromBitmapRGB888(void);
+    void drawCPUFromBitmapARGB8888(void);
+    void drawCPUFromBitmapIndexed(void);
+    void drawCPUFromBitmapRLE(void);
     void drawCPUFromBitmapRGB888ToFrameBufferRGB888(void);
     void drawCPUFromBitmapARGB8888ToFrameBufferRGB888(void);
+    void drawCPUFromBitmapRGB888ToFrameBufferRGB565(void);
+    void drawCPUFromBitmapARGB8888ToFrameBufferRGB565(void);
+    void drawCPUFromBitmapIndexedToFrameBufferRGB888(void);
+    void drawCPUFromBitmapIndexedToFrameBufferRGB565(void);
+
+    void drawCPUFromBitmapRLEToFrameBufferRGB888(void);
+    void drawCPUFromBitmapRLEToFrameBufferRGB565(void);
+
+    uint8_t getBitmapColorIndex(uint32_t pixelIdx) const;
+    const uint8_t* skipRLEBitmapRows(const uint8_t *rlePtr, uint16_t numberOfRows) const;
+
+    static RLERunType getRLERunType(uint8_t runHeader);
+    static uint16_t getRLERunLength(uint8_t runHeader);
+    static uint8_t getRLERunPixelSize(RLERunType runType);
 
     bool isFrameBufferColorFormatSupported(void) const;
     bool isImageVisibleOnTheScreen(void) const;
 
     void buildCopyBitmapConfig(void);
     void buildBlendBitmapConfig(void);
+    void updateBitmapConfigsVisiblePart(void);
+    bool canBitmapVisiblePartBeReadByDMA2D(void) const;
+
+    static bool isBitmapOpaque(const BitmapDescription &bitmapDescription);
+    static bool isIndexedColorFormat(ColorFormat colorFormat);
+    static DMA2D::CLUTConfiguration buildCLUTConfig(const BitmapDescription &bitmapDescription);
 
     static DMA2D::Position mapToDMA2DPosition(Position position);
     static DMA2D::Dimension mapToDMA2DDimension(Dimension dimension);
     static DMA2D::Dimension mapToDMA2DDimension(IFrameBuffer::Dimension dimension);
+    static DMA2D::InputColorFormat mapToDMA2DInputColorFormat(ColorFormat colorFormat);
+    static DMA2D::InputColorFormat mapToDMA2DInputColorFormat(IFrameBuffer::ColorFormat colorFormat);
+    static DMA2D::OutputColorFormat mapToDMA2DOutputColorFormat(IFrameBuffer::ColorFormat colorFormat);
+    static ErrorCode mapToErrorCode(DMA2D::ErrorCode errorCode);
 
     BitmapDescription m_bitmapDescription;
 
+    //! Cached at bitmap change, so that CLUT is not scanned at every draw
+    bool m_isBitmapOpaque;
+
     DrawHardware m_lastTransactionDrawHardware;
 
     DMA2D::CopyBitmapConfig m_copyBitmapConfig;
@@ -88,6 +163,8 @@ namespace GUI
 
     //! Reference to DMA2D
     DMA2D &m_dma2d;
+
+    static DrawCostModel s_drawCostModel[DISTINCT_COLOR_FORMAT_COUNT];
   };
 }
 
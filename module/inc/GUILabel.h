@@ -0,0 +1,138 @@
+#ifndef GUI_LABEL_H
+#define GUI_LABEL_H
+
+#include "GUIRectangleBase.h"
+#include "IFrameBuffer.h"
+#include "DMA2D.h"
+#include "SysTick.h"
+#include <cstdint>
+
+
+namespace GUI
+{
+  class Label : public RectangleBase
+  {
+  public:
+
+    Label(DMA2D &dma2d, SysTick &sysTick, IFrameBuffer &frameBuffer);
+
+    static constexpr uint8_t MAX_TEXT_LENGTH = 32u;
+
+    //! Alpha only formats of glyph atlas, A4 atlas stores the first pixel in the low nibble
+    enum class GlyphFormat : uint8_t
+    {
+      A8 = 0u,
+      A4 = 1u
+    };
+
+    //! Glyph occupies columns [x, x + width) of the atlas, pen is moved by advance after it is drawn.
+    //! Glyphs without ink (e.g. space) have zero width, so they cost no blit.
+    struct Glyph
+    {
+      uint16_t x;
+      uint8_t width;
+      uint8_t advance;
+    };
+
+    //! All glyphs are placed side by side in the single row of the atlas, whose height is the font height.
+    //! Glyph of the character c is glyphPtr[c - firstCharacter], characters without glyph are skipped.
+    //! A4 atlas must have even width, its glyphs are blended by DMA2D only if their visible part starts at even x
+    //! and has even width.
+    struct FontDescription
+    {
+      GlyphFormat glyphFormat;
+      Dimension atlasDimension;
+      const void *atlasPtr;
+      const Glyph *glyphPtr;
+      char firstCharacter;
+      uint8_t glyphCount;
+    };
+
+    //! Text is drawn from the top left corner of the label and it is clipped to the label dimension
+    struct LabelDescription
+    {
+      RectangleBaseDescription baseDescription;
+      const FontDescription *fontPtr;
+      const char *text;
+      Color color;
+    };
+
+    ErrorCode init(const LabelDescription &labelDescription);
+
+    void setFrameBuffer(IFrameBuffer &frameBuffer) override;
+
+    //! Label is never opaque, as the background is seen between and through the glyphs
+    bool isOpaque(void) const override;
+
+    //! Text longer than MAX_TEXT_LENGTH is truncated
+    void setText(const char *text);
+
+    inline const char* getText(void) const
+    {
+      return m_text;
+    }
+
+    Color getColor(void) const;
+    void setColor(Color color);
+
+    //! Returns width of the text with the label font, regardless of the label dimension
+    uint16_t getTextWidth(void) const;
+
+    DrawCostModel& getDrawCostModel(void) const override;
+
+  private:
+
+    //! Visible part of a single glyph, atlas position is the top left corner of that part in the atlas
+    struct GlyphBlit
+    {
+      Position atlasPosition;
+      Region region;
+    };
+
+    void drawCPU(void) override;
+    void drawDMA2D(void) override;
+    ErrorCode enqueueDMA2DCommands(void) override;
+
+    void drawCPUToFrameBufferRGB888(void);
+    void drawCPUToFrameBufferRGB565(void);
+
+    uint8_t layoutVisibleGlyphs(void);
+    bool canGlyphBlitsBeDrawnByDMA2D(void) const;
+
+    uint8_t getGlyphAlpha(uint16_t x, uint16_t y) const;
+    const Glyph* findGlyph(char character) const;
+
+    void buildBlendBitmapConfig(void);
+
+    bool isFrameBufferColorFormatSupported(void) const;
+
+    static DMA2D::InputColorFormat mapToDMA2DInputColorFormat(GlyphFormat glyphFormat);
+    static DMA2D::InputColorFormat mapToDMA2DInputColorFormat(IFrameBuffer::ColorFormat colorFormat);
+    static DMA2D::OutputColorFormat mapToDMA2DOutputColorFormat(IFrameBuffer::ColorFormat colorFormat);
+    static DMA2D::Position mapToDMA2DPosition(Position position);
+    static DMA2D::Dimension mapToDMA2DDimension(Dimension dimension);
+    static DMA2D::Dimension mapToDMA2DDimension(IFrameBuffer::Dimension dimension);
+    static DMA2D::Color mapToDMA2DColor(Color color);
+    static ErrorCode mapToErrorCode(DMA2D::ErrorCode errorCode);
+
+    const FontDescription *m_fontPtr;
+
+    char m_text[MAX_TEXT_LENGTH + 1u];
+
+    Color m_color;
+
+    GlyphBlit m_glyphBlits[MAX_TEXT_LENGTH];
+
+    uint8_t m_glyphBlitCount;
+
+    //! Configuration shared by all glyph blits, only dimension and positions differ between them
+    DMA2D::BlendBitmapConfig m_blendBitmapConfig;
+
+    //! Reference to DMA2D
+    DMA2D &m_dma2d;
+
+    static DrawCostModel s_drawCostModel;
+  };
+}
+
+#endif // #ifndef GUI_LABEL_H
\ No newline at end of file
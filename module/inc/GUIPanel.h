@@ -0,0 +1,79 @@
+#ifndef GUI_PANEL_H
+#define GUI_PANEL_H
+
+#include "GUIRectangleBase.h"
+#include "IArrayList.h"
+#include "IFrameBuffer.h"
+#include "SysTick.h"
+#include <cstdint>
+
+
+namespace GUI
+{
+  //! Panel groups objects into a single object, so it can be added to a container or to another panel.
+  //! Positions of its objects are relative to the panel, they are drawn clipped to the panel region and
+  //! the whole subtree is skipped if the panel is not visible.
+  class Panel : public RectangleBase
+  {
+  public:
+
+    struct ObjectInfo
+    {
+      IObject *objectPtr;
+      uint32_t zIndex;
+    };
+
+    Panel(IArrayList<ObjectInfo> &objectInfoList, SysTick &sysTick, IFrameBuffer &frameBuffer);
+
+    uint32_t getCapacity(void) const;
+    uint32_t getSize(void) const;
+    bool isEmpty(void) const;
+
+    IObject* getObject(uint32_t zIndex);
+
+    //! Position of the object is taken as relative to the top left corner of the panel
+    ErrorCode addObject(IObject *objectPtr, uint32_t zIndex);
+
+    void setFrameBuffer(IFrameBuffer &frameBuffer) override;
+
+    //! Moves the panel together with all its objects, damaged are only the old and the new panel region
+    void moveToPosition(const Position &position) override;
+
+    bool isOpaque(void) const override;
+
+    //! Event is forwarded to the top most object containing any of the touch points, otherwise to the panel
+    void notify(const TouchEvent &touchEvent) override;
+
+  private:
+
+    void drawCPU(void) override;
+    void drawDMA2D(void) override;
+    ErrorCode enqueueDMA2DCommands(void) override;
+
+    void drawNextObjectDMA2D(void);
+
+    IObject* getObjectAtIdx(uint32_t objectIdx) const;
+
+    bool doesObjectContainAnyOfTouchPoints(const IObject &object, const IArrayList<Point> &touchPoints) const;
+
+    ErrorCode insertObjectInfoIntoList(const ObjectInfo &objectInfo);
+
+    static ErrorCode mapToErrorCode(IArrayListBase::ErrorCode errorCode);
+
+    static void objectDrawingCompletedCallback(void *guiPanelPtr);
+    static void objectDamagedRegionCallback(void *guiPanelPtr, const Region &region);
+
+    IArrayList<ObjectInfo> &m_objectInfoList;
+
+    //! Index of the first object not yet drawn, drawing interrupted by a full DMA2D command queue continues from it
+    uint32_t m_nextObjectIdx = 0u;
+
+    //! Objects are drawn one by one with DMA2D, each started from the draw completed callback of the previous one
+    bool m_isDrawingObjectsDMA2D = false;
+
+    //! Damaged regions of objects are not forwarded while they are moved together with the panel
+    bool m_isMovingObjects = false;
+  };
+}
+
+#endif // #ifndef GUI_PANEL_H
\ No newline at end of file
@@ -28,20 +28,34 @@ namespace GUI
 
     void moveToPosition(const Position &position) override;
 
+    void setClipRegion(const Region &clipRegion) override;
+    void resetClipRegion(void) override;
+
+    bool isOpaque(void) const override;
+
     Color getColor(void) const;
+    void setColor(Color color);
+
+    DrawCostModel& getDrawCostModel(void) const override;
 
   private:
 
     void drawCPU(void) override;
     void drawDMA2D(void) override;
 
+    void drawCPUToFrameBufferRGB888(void);
+    void drawCPUToFrameBufferRGB565(void);
+    ErrorCode enqueueDMA2DCommands(void) override;
+
     void buildFillRectangleConfig(void);
+    void updateFillRectangleConfigVisiblePart(void);
 
     static DMA2D::OutputColorFormat mapToDMA2DOutputColorFormat(IFrameBuffer::ColorFormat colorFormat);
     static DMA2D::Position mapToDMA2DPosition(Position position);
     static DMA2D::Dimension mapToDMA2DDimension(Dimension dimension);
     static DMA2D::Dimension mapToDMA2DDimension(IFrameBuffer::Dimension dimension);
-    static DMA2D::Color mapToDMA2DColor(Color color);
+    static DMA2D::Color mapToDMA2DColor(Color color, IFrameBuffer::ColorFormat colorFormat);
+    static ErrorCode mapToErrorCode(DMA2D::ErrorCode errorCode);
 
     Color m_color;
 
@@ -51,6 +65,8 @@ namespace GUI
 
     //! Reference to DMA2D
     DMA2D &m_dma2d;
+
+    static DrawCostModel s_drawCostModel;
   };
 }
 
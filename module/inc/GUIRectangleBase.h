@@ -2,6 +2,7 @@
 #define GUI_RECTANGLE_BASE_H
 
 #include "IGUIObject.h"
+#include "GUIDrawCostModel.h"
 #include "FrameBuffer.h"
 #include "SysTick.h"
 
@@ -53,10 +54,20 @@ namespace GUI
 
     bool doesContainPoint(Point point) const override;
 
+    Region getRegion(void) const override;
+
+    Region getClipRegion(void) const;
+    void setClipRegion(const Region &clipRegion) override;
+    void resetClipRegion(void) override;
+
+    void registerDamagedRegionCallback(const DamagedRegionCallbackDescription &callbackDescription) override;
+    void unregisterDamagedRegionCallback(void) override;
+
     Position getPosition(Position::Tag positionTag) const override;
     void moveToPosition(const Position &position) override;
 
     void draw(DrawHardware drawHardware) override;
+    ErrorCode enqueueDMA2DDrawCommands(void) override;
     bool isDrawCompleted(void) const override;
     ErrorCode getDrawingTime(DrawHardware drawHardware, uint64_t &drawingTimeInUs) const override;
 
@@ -75,6 +86,12 @@ namespace GUI
 
     Position getVisiblePartPosition(Position::Tag positionTag) const;
 
+    //! Intersection of the object region with the clip region, no draw path touches pixels outside of it
+    Region getVisiblePartRegion(void) const;
+
+    //! Cost model shared by all objects of the same type, DrawHardware::AUTO picks the hardware with it
+    virtual DrawCostModel& getDrawCostModel(void) const;
+
     static void callbackDMA2DDrawCompleted(void *guiRectangleBasePtr);
 
   protected:
@@ -91,6 +108,7 @@ namespace GUI
 
     virtual void drawCPU(void) = 0;
     virtual void drawDMA2D(void) = 0;
+    virtual ErrorCode enqueueDMA2DCommands(void) = 0;
 
     Position getPositionTopLeftCorner(void) const;
     Position getPositionTopRightCorner(void) const;
@@ -100,6 +118,11 @@ namespace GUI
 
     bool isVisibleOnTheScreen(void) const;
 
+    DrawHardware resolveDrawHardware(DrawHardware drawHardware) const;
+
+    //! Object which DMA2D is not able to draw in its current state is drawn by CPU, whatever hardware is requested
+    virtual bool canBeDrawnByDMA2D(void) const;
+
     void startDrawingTransaction(DrawHardware drawHardware);
     void endDrawingTransaction(DrawHardware drawHardware);
 
@@ -107,6 +130,8 @@ namespace GUI
 
     void callDrawCompletedCallbackIfRegistered(void);
 
+    void reportDamagedRegion(const Region &region);
+
     static void recalculatePositionToBeTopLeftCorner(RectangleBaseDescription &rectangleDescription);
 
     template <typename T>
@@ -133,7 +158,16 @@ namespace GUI
 
     CallbackDescription m_drawCompletedCallback;
 
+    DamagedRegionCallbackDescription m_damagedRegionCallback;
+
+    //! Region to which drawing is restricted, on top of the frame buffer bounds
+    Region m_clipRegion;
+
+    bool m_isClipRegionSet = false;
+
     TouchEventCallbackDescription m_touchEventCallback;
+
+    static DrawCostModel s_drawCostModel;
   };
 }
 
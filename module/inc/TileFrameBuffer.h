@@ -0,0 +1,97 @@
+#ifndef TILE_FRAME_BUFFER_H
+#define TILE_FRAME_BUFFER_H
+
+#include "ITileFrameBuffer.h"
+#include <cstdint>
+
+
+template <uint16_t t_width, uint16_t t_height, uint16_t t_tileHeight, IFrameBuffer::ColorFormat t_colorFormat>
+class TileFrameBuffer : public ITileFrameBuffer
+{
+public:
+
+  inline uint16_t getWidth(void) const override
+  {
+    return t_width;
+  }
+
+  inline uint16_t getHeight(void) const override
+  {
+    return t_height;
+  }
+
+  inline Dimension getDimension(void) const override
+  {
+    return
+    {
+      .width  = t_width,
+      .height = t_height
+    };
+  }
+
+  inline ColorFormat getColorFormat(void) const override
+  {
+    return t_colorFormat;
+  }
+
+  //! Size of the frame buffer the tile belongs to (not of the tile memory)
+  inline uint32_t getSize(void) const override
+  {
+    return static_cast<uint32_t>(t_width) * t_height * IFrameBuffer::getColorFormatPixelSize(t_colorFormat);
+  }
+
+  inline void* getPointer(void) override
+  {
+    return reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(m_tile) - getTileOffset());
+  }
+
+  inline const void* getPointer(void) const override
+  {
+    return reinterpret_cast<const void*>(reinterpret_cast<uintptr_t>(m_tile) - getTileOffset());
+  }
+
+  inline bool operator==(const IFrameBuffer &frameBuffer) const override
+  {
+    return (this == &frameBuffer);
+  }
+
+  inline uint16_t getTileHeight(void) const override
+  {
+    return t_tileHeight;
+  }
+
+  inline uint16_t getTileFirstRow(void) const override
+  {
+    return m_tileFirstRow;
+  }
+
+  inline void setTileFirstRow(uint16_t firstRow) override
+  {
+    m_tileFirstRow = firstRow;
+  }
+
+  inline void* getTilePointer(void) override
+  {
+    return reinterpret_cast<void*>(m_tile);
+  }
+
+  inline const void* getTilePointer(void) const override
+  {
+    return reinterpret_cast<const void*>(m_tile);
+  }
+
+private:
+
+  static constexpr uint32_t ROW_SIZE = static_cast<uint32_t>(t_width) * IFrameBuffer::getColorFormatPixelSize(t_colorFormat);
+
+  inline uintptr_t getTileOffset(void) const
+  {
+    return static_cast<uintptr_t>(m_tileFirstRow) * ROW_SIZE;
+  }
+
+  uint16_t m_tileFirstRow = 0u;
+
+  uint8_t m_tile[ROW_SIZE * static_cast<uint32_t>(t_tileHeight)];
+};
+
+#endif // #ifndef TILE_FRAME_BUFFER_H
\ No newline at end of file
@@ -13,6 +13,7 @@ public:
   {
     ARGB8888 = 0u,
     RGB888   = 1u,
+    RGB565   = 2u,
   };
 
   struct Dimension
@@ -53,6 +54,9 @@ constexpr uint8_t IFrameBuffer::getColorFormatPixelSize(ColorFormat colorFormat)
     case ColorFormat::RGB888:
       return 3u;
 
+    case ColorFormat::RGB565:
+      return 2u;
+
     default:
       return 0u;
   }
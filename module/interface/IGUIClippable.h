@@ -0,0 +1,32 @@
+#ifndef I_GUI_CLIPPABLE_H
+#define I_GUI_CLIPPABLE_H
+
+#include "GUICommon.h"
+
+
+namespace GUI
+{
+  class IClippable
+  {
+  public:
+    typedef void (*DamagedRegionCallbackFunc)(void*, const Region&);
+
+    virtual ~IClippable() = default;
+
+    struct DamagedRegionCallbackDescription
+    {
+      DamagedRegionCallbackFunc functionPtr;
+      void *argument;
+    };
+
+    virtual Region getRegion(void) const = 0;
+
+    virtual void setClipRegion(const Region &clipRegion) = 0;
+    virtual void resetClipRegion(void) = 0;
+
+    virtual void registerDamagedRegionCallback(const DamagedRegionCallbackDescription &callbackDescription) = 0;
+    virtual void unregisterDamagedRegionCallback(void) = 0;
+  };
+}
+
+#endif // #ifndef I_GUI_CLIPPABLE_H
\ No newline at end of file
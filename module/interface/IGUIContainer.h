@@ -22,6 +22,8 @@ namespace GUI
     virtual IObject* getObject(uint32_t zIndex) = 0;
     virtual ErrorCode addObject(IObject *objectPtr, uint32_t zIndex) = 0;
 
+    virtual void invalidateRegion(const Region &region) = 0;
+
     virtual IObject* getEventTarget(const TouchEvent &touchEvent) = 0;
     virtual void dispatchEvent(TouchEvent &touchEvent) = 0;
   };
@@ -5,15 +5,23 @@
 #include "IGUIDrawable.h"
 #include "IGUIMovable.h"
 #include "IGUIShape.h"
+#include "IGUIClippable.h"
 #include "IGUITouchEventListener.h"
 
 
 namespace GUI
 {
-  class IObject : public IObjectBase, public IDrawable, public IMovable, public IShape, public ITouchEventListener
+  class IObject : public IObjectBase, public IDrawable, public IMovable, public IShape, public IClippable,
+    public ITouchEventListener
   {
   public:
     virtual ~IObject() = default;
+
+    //! Opaque object completely hides everything drawn below it inside of its region
+    virtual bool isOpaque(void) const = 0;
+
+    //! Enqueues DMA2D commands which draw the object, without starting DMA2D
+    virtual ErrorCode enqueueDMA2DDrawCommands(void) = 0;
   };
 }
 
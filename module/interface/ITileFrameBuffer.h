@@ -0,0 +1,22 @@
+#ifndef I_TILE_FRAME_BUFFER_H
+#define I_TILE_FRAME_BUFFER_H
+
+#include "IFrameBuffer.h"
+#include <cstdint>
+
+
+//! Frame buffer which has dimension of the whole screen, but only memory for a horizontal stripe (tile) of it.
+//! Pointer is shifted in the way that drawing into rows covered by the tile lands into the tile memory.
+class ITileFrameBuffer : public IFrameBuffer
+{
+public:
+  virtual ~ITileFrameBuffer() = default;
+
+  virtual uint16_t getTileHeight(void) const = 0;
+  virtual uint16_t getTileFirstRow(void) const = 0;
+  virtual void setTileFirstRow(uint16_t firstRow) = 0;
+  virtual void* getTilePointer(void) = 0;
+  virtual const void* getTilePointer(void) const = 0;
+};
+
+#endif // #ifndef I_TILE_FRAME_BUFFER_H
\ No newline at end of file
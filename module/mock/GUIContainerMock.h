@@ -35,6 +35,7 @@ public:
 
   MOCK_METHOD(GUI::IObject*, getObject, (uint32_t), (override));
   MOCK_METHOD(GUI::ErrorCode, addObject, (GUI::IObject *, uint32_t), (override));
+  MOCK_METHOD(void, invalidateRegion, (const GUI::Region &), (override));
 
   MOCK_METHOD(GUI::IObject*, getEventTarget, (const GUI::TouchEvent &), (override));
   MOCK_METHOD(void, dispatchEvent, (GUI::TouchEvent &), (override));
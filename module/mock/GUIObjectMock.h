@@ -18,6 +18,10 @@ public:
     m_callbackDescription{
       .functionPtr = nullptr,
       .argument    = nullptr
+    },
+    m_damagedRegionCallbackDescription{
+      .functionPtr = nullptr,
+      .argument    = nullptr
     }
   {
     ON_CALL(*this, draw(_))
@@ -35,11 +39,21 @@ public:
         return m_isDrawCompleted;
       });
 
+    // by default object occupies single pixel in the top left corner of the frame buffer
+    ON_CALL(*this, getRegion())
+      .WillByDefault(Return(GUI::Region{ .x = 0, .y = 0, .width = 1u, .height = 1u }));
+
     ON_CALL(*this, registerDrawCompletedCallback(_))
       .WillByDefault([&](const CallbackDescription &callbackDescription)
       {
         m_callbackDescription = callbackDescription;
       });
+
+    ON_CALL(*this, registerDamagedRegionCallback(_))
+      .WillByDefault([&](const DamagedRegionCallbackDescription &callbackDescription)
+      {
+        m_damagedRegionCallbackDescription = callbackDescription;
+      });
   }
 
   virtual ~GUIObjectMock() = default;
@@ -55,10 +69,17 @@ public:
   MOCK_METHOD(GUI::Position, getPosition, (GUI::Position::Tag), (const, override));
   MOCK_METHOD(void, moveToPosition, (const GUI::Position &), (override));
   MOCK_METHOD(void, draw, (GUI::DrawHardware), (override));
+  MOCK_METHOD(GUI::ErrorCode, enqueueDMA2DDrawCommands, (), (override));
+  MOCK_METHOD(bool, isOpaque, (), (const, override));
   MOCK_METHOD(bool, isDrawCompleted, (), (const, override));
   MOCK_METHOD(GUI::ErrorCode, getDrawingTime, (GUI::DrawHardware, uint64_t &), (const, override));
   MOCK_METHOD(void, registerDrawCompletedCallback, (const CallbackDescription &), (override));
   MOCK_METHOD(void, unregisterDrawCompletedCallback, (), (override));
+  MOCK_METHOD(GUI::Region, getRegion, (), (const, override));
+  MOCK_METHOD(void, setClipRegion, (const GUI::Region &), (override));
+  MOCK_METHOD(void, resetClipRegion, (), (override));
+  MOCK_METHOD(void, registerDamagedRegionCallback, (const DamagedRegionCallbackDescription &), (override));
+  MOCK_METHOD(void, unregisterDamagedRegionCallback, (), (override));
   MOCK_METHOD(void, notify, (const GUI::TouchEvent &), (override));
 
   // fake method;
@@ -72,11 +93,22 @@ public:
     }
   }
 
+  // fake method;
+  inline void reportDamagedRegion(const GUI::Region &region)
+  {
+    if (nullptr != m_damagedRegionCallbackDescription.functionPtr)
+    {
+      m_damagedRegionCallbackDescription.functionPtr(m_damagedRegionCallbackDescription.argument, region);
+    }
+  }
+
 private:
 
   bool m_isDrawCompleted;
 
   CallbackDescription m_callbackDescription;
+
+  DamagedRegionCallbackDescription m_damagedRegionCallbackDescription;
 };
 
 #endif // #ifndef GUI_RECTANGLE_OBJECT_MOCK_H
\ No newline at end of file
@@ -21,6 +21,8 @@ public:
   // visibility is intentionally altered from protected to public to enable testability
   MOCK_METHOD(void , drawCPU, (), (override));
   MOCK_METHOD(void , drawDMA2D, (), (override));
+  MOCK_METHOD(GUI::ErrorCode , enqueueDMA2DCommands, (), (override));
+  MOCK_METHOD(bool , isOpaque, (), (const, override));
 
 };
 
@@ -0,0 +1,53 @@
+#include "FrameBufferSwapChain.h"
+
+
+FrameBufferSwapChain::FrameBufferSwapChain(
+  LTDC &ltdc,
+  IFrameBuffer &frameBuffer1,
+  IFrameBuffer &frameBuffer2,
+  LTDC::Layer layer):
+  m_ltdc(ltdc),
+  m_layer(layer),
+  m_frameBufferPtr{ &frameBuffer1, &frameBuffer2 },
+  m_frontBufferIndex(0u)
+{}
+
+IFrameBuffer& FrameBufferSwapChain::getFrontBuffer(void)
+{
+  return *m_frameBufferPtr[m_frontBufferIndex];
+}
+
+IFrameBuffer& FrameBufferSwapChain::getBackBuffer(void)
+{
+  return *m_frameBufferPtr[(m_frontBufferIndex + 1u) % FRAME_BUFFER_COUNT];
+}
+
+FrameBufferSwapChain::ErrorCode FrameBufferSwapChain::present(ReloadMode reloadMode)
+{
+  if (not isBackBufferAvailable())
+  {
+    return ErrorCode::PRESENT_ALREADY_PENDING;
+  }
+
+  m_ltdc.setFrameBufferAddress(m_layer, getBackBuffer().getPointer());
+
+  if (ReloadMode::IMMEDIATE == reloadMode)
+  {
+    m_ltdc.reloadImmediately();
+  }
+  else
+  {
+    // new address is latched at the next vertical blanking, so the frame which is being scanned out is not torn
+    m_ltdc.reloadOnVerticalBlank();
+  }
+
+  m_frontBufferIndex = (m_frontBufferIndex + 1u) % FRAME_BUFFER_COUNT;
+
+  return ErrorCode::OK;
+}
+
+bool FrameBufferSwapChain::isBackBufferAvailable(void) const
+{
+  // until the reload happens, LTDC still scans out the buffer which has just become the back one
+  return not m_ltdc.isReloadOngoing();
+}
\ No newline at end of file
@@ -0,0 +1,370 @@
+#include "GUIAnimator.h"
+
+
+namespace
+{
+  struct EasingLUT
+  {
+    uint32_t values[GUI::Animator::EASING_LUT_SEGMENT_COUNT + 1u];
+  };
+
+  constexpr uint32_t calculateEasedProgress(GUI::Animator::Easing easing, uint64_t progress)
+  {
+    constexpr uint64_t ONE = GUI::Animator::PROGRESS_ONE;
+
+    switch (easing)
+    {
+      case GUI::Animator::Easing::EASE_IN:
+        return static_cast<uint32_t>(progress * progress / ONE);
+
+      case GUI::Animator::Easing::EASE_OUT:
+        return static_cast<uint32_t>(ONE - (ONE - progress) * (ONE - progress) / ONE);
+
+      // smoothstep, 3t^2 - 2t^3
+      case GUI::Animator::Easing::EASE_IN_OUT:
+        return static_cast<uint32_t>(progress * progress * (3u * ONE - 2u * progress) / (ONE * ONE));
+
+      case GUI::Animator::Easing::LINEAR:
+      default:
+        return static_cast<uint32_t>(progress);
+    }
+  }
+
+  constexpr EasingLUT buildEasingLUT(GUI::Animator::Easing easing)
+  {
+    EasingLUT easingLUT = {};
+
+    for (uint32_t i = 0u; i <= GUI::Animator::EASING_LUT_SEGMENT_COUNT; ++i)
+    {
+      easingLUT.values[i] = calculateEasedProgress(easing,
+        static_cast<uint64_t>(i) * GUI::Animator::PROGRESS_ONE / GUI::Animator::EASING_LUT_SEGMENT_COUNT);
+    }
+
+    return easingLUT;
+  }
+
+  constexpr EasingLUT s_easingLUTs[static_cast<uint8_t>(GUI::Animator::Easing::COUNT)] =
+  {
+    buildEasingLUT(GUI::Animator::Easing::LINEAR),
+    buildEasingLUT(GUI::Animator::Easing::EASE_IN),
+    buildEasingLUT(GUI::Animator::Easing::EASE_OUT),
+    buildEasingLUT(GUI::Animator::Easing::EASE_IN_OUT)
+  };
+}
+
+
+GUI::Animator::Animator(SysTick &sysTick):
+  m_sysTick(sysTick),
+  m_animations{},
+  m_isPaused(false),
+  m_pauseTimestamp(0u)
+{}
+
+GUI::ErrorCode GUI::Animator::animatePosition(
+  IObject &object,
+  Position startPosition,
+  Position endPosition,
+  const AnimationDescription &animationDescription)
+{
+  Animation *animationPtr = allocateAnimation(animationDescription);
+  if (nullptr == animationPtr)
+  {
+    return ErrorCode::ANIMATOR_FULL_ERROR;
+  }
+
+  animationPtr->property      = Property::POSITION;
+  animationPtr->objectPtr     = &object;
+  animationPtr->startPosition = startPosition;
+  animationPtr->endPosition   = endPosition;
+
+  return ErrorCode::OK;
+}
+
+GUI::ErrorCode GUI::Animator::animateColor(
+  const ColorSetterDescription &colorSetter,
+  Color startColor,
+  Color endColor,
+  const AnimationDescription &animationDescription)
+{
+  if (nullptr == colorSetter.functionPtr)
+  {
+    return ErrorCode::ARGUMENT_NULL_POINTER;
+  }
+
+  Animation *animationPtr = allocateAnimation(animationDescription);
+  if (nullptr == animationPtr)
+  {
+    return ErrorCode::ANIMATOR_FULL_ERROR;
+  }
+
+  animationPtr->property    = Property::COLOR;
+  animationPtr->colorSetter = colorSetter;
+  animationPtr->startColor  = startColor;
+  animationPtr->endColor    = endColor;
+
+  return ErrorCode::OK;
+}
+
+GUI::ErrorCode GUI::Animator::animateOpacity(
+  const OpacitySetterDescription &opacitySetter,
+  uint8_t startOpacity,
+  uint8_t endOpacity,
+  const AnimationDescription &animationDescription)
+{
+  if (nullptr == opacitySetter.functionPtr)
+  {
+    return ErrorCode::ARGUMENT_NULL_POINTER;
+  }
+
+  Animation *animationPtr = allocateAnimation(animationDescription);
+  if (nullptr == animationPtr)
+  {
+    return ErrorCode::ANIMATOR_FULL_ERROR;
+  }
+
+  animationPtr->property      = Property::OPACITY;
+  animationPtr->opacitySetter = opacitySetter;
+  animationPtr->startOpacity  = startOpacity;
+  animationPtr->endOpacity    = endOpacity;
+
+  return ErrorCode::OK;
+}
+
+void GUI::Animator::stop(const void *targetPtr)
+{
+  for (Animation &animation : m_animations)
+  {
+    if (animation.isActive && (targetPtr == getTarget(animation)))
+    {
+      animation.isActive = false;
+    }
+  }
+}
+
+void GUI::Animator::stopAll(void)
+{
+  for (Animation &animation : m_animations)
+  {
+    animation.isActive = false;
+  }
+}
+
+void GUI::Animator::pause(void)
+{
+  if (not m_isPaused)
+  {
+    m_isPaused       = true;
+    m_pauseTimestamp = m_sysTick.getTicks();
+  }
+}
+
+void GUI::Animator::resume(void)
+{
+  if (m_isPaused)
+  {
+    const uint64_t pauseDuration = m_sysTick.getTicks() - m_pauseTimestamp;
+
+    for (Animation &animation : m_animations)
+    {
+      animation.startTimestamp += pauseDuration;
+    }
+
+    m_isPaused = false;
+  }
+}
+
+bool GUI::Animator::isAnimating(void) const
+{
+  for (const Animation &animation : m_animations)
+  {
+    if (animation.isActive)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void GUI::Animator::update(void)
+{
+  if (m_isPaused)
+  {
+    return;
+  }
+
+  // all animations are sampled at the same moment, so objects animated together stay in sync
+  const uint64_t timestamp = m_sysTick.getTicks();
+
+  for (Animation &animation : m_animations)
+  {
+    if (not animation.isActive)
+    {
+      continue;
+    }
+
+    const uint32_t progress = ease(animation.description.easing, getProgress(animation, timestamp));
+
+    switch (animation.property)
+    {
+      case Property::POSITION:
+        applyPosition(animation, progress);
+        break;
+
+      case Property::COLOR:
+        applyColor(animation, progress);
+        break;
+
+      case Property::OPACITY:
+        applyOpacity(animation, progress);
+        break;
+
+      default:
+        // do nothing
+        break;
+    }
+
+    if ((Repeat::ONCE == animation.description.repeat) &&
+        ((timestamp - animation.startTimestamp) >= animation.durationInTicks))
+    {
+      animation.isActive = false;
+    }
+  }
+}
+
+uint32_t GUI::Animator::ease(Easing easing, uint32_t progress)
+{
+  constexpr uint32_t SEGMENT_LENGTH = PROGRESS_ONE / EASING_LUT_SEGMENT_COUNT;
+
+  const uint32_t *lutPtr = s_easingLUTs[static_cast<uint8_t>(easing) % static_cast<uint8_t>(Easing::COUNT)].values;
+  const uint32_t segmentIdx = progress / SEGMENT_LENGTH;
+
+  if (segmentIdx >= EASING_LUT_SEGMENT_COUNT)
+  {
+    return lutPtr[EASING_LUT_SEGMENT_COUNT];
+  }
+
+  const uint32_t segmentProgress = progress % SEGMENT_LENGTH;
+
+  return lutPtr[segmentIdx] + (lutPtr[segmentIdx + 1u] - lutPtr[segmentIdx]) * segmentProgress / SEGMENT_LENGTH;
+}
+
+GUI::Animator::Animation* GUI::Animator::allocateAnimation(const AnimationDescription &animationDescription)
+{
+  for (Animation &animation : m_animations)
+  {
+    if (not animation.isActive)
+    {
+      animation = {};
+      animation.isActive        = true;
+      animation.description     = animationDescription;
+      // animation started while paused starts running once animator is resumed
+      animation.startTimestamp  = m_isPaused ? m_pauseTimestamp : m_sysTick.getTicks();
+      animation.durationInTicks =
+        static_cast<uint64_t>(animationDescription.durationInMs) * m_sysTick.getTicksPerSecond() / 1000u;
+
+      // timestamps are only subtracted from each other, so an offset larger than the current ticks is fine
+      animation.startTimestamp -=
+        static_cast<uint64_t>(animationDescription.startOffsetInMs) * m_sysTick.getTicksPerSecond() / 1000u;
+
+      return &animation;
+    }
+  }
+
+  return nullptr;
+}
+
+uint32_t GUI::Animator::getProgress(const Animation &animation, uint64_t timestamp) const
+{
+  const uint64_t elapsedTicks = timestamp - animation.startTimestamp;
+
+  if ((0u == animation.durationInTicks) ||
+      ((Repeat::ONCE == animation.description.repeat) && (elapsedTicks >= animation.durationInTicks)))
+  {
+    return PROGRESS_ONE;
+  }
+
+  const uint64_t cycleIdx = elapsedTicks / animation.durationInTicks;
+  const uint32_t progress =
+    static_cast<uint32_t>((elapsedTicks % animation.durationInTicks) * PROGRESS_ONE / animation.durationInTicks);
+
+  if ((Repeat::PING_PONG == animation.description.repeat) && (0u != (cycleIdx % 2u)))
+  {
+    return PROGRESS_ONE - progress;
+  }
+
+  return progress;
+}
+
+void GUI::Animator::applyPosition(Animation &animation, uint32_t progress)
+{
+  const Position position =
+  {
+    .x   = static_cast<int16_t>(interpolate(animation.startPosition.x, animation.endPosition.x, progress)),
+    .y   = static_cast<int16_t>(interpolate(animation.startPosition.y, animation.endPosition.y, progress)),
+    .tag = animation.startPosition.tag
+  };
+  const Position currentPosition = animation.objectPtr->getPosition(position.tag);
+
+  if ((currentPosition.x != position.x) || (currentPosition.y != position.y))
+  {
+    animation.objectPtr->moveToPosition(position);
+  }
+}
+
+void GUI::Animator::applyColor(Animation &animation, uint32_t progress)
+{
+  const Color color =
+  {
+    .red   = static_cast<uint8_t>(interpolate(animation.startColor.red, animation.endColor.red, progress)),
+    .green = static_cast<uint8_t>(interpolate(animation.startColor.green, animation.endColor.green, progress)),
+    .blue  = static_cast<uint8_t>(interpolate(animation.startColor.blue, animation.endColor.blue, progress))
+  };
+
+  if ((not animation.isApplied) || (animation.lastColor != color))
+  {
+    animation.colorSetter.functionPtr(animation.colorSetter.argument, color);
+    animation.lastColor = color;
+    animation.isApplied = true;
+  }
+}
+
+void GUI::Animator::applyOpacity(Animation &animation, uint32_t progress)
+{
+  const uint8_t opacity = static_cast<uint8_t>(interpolate(animation.startOpacity, animation.endOpacity, progress));
+
+  if ((not animation.isApplied) || (animation.lastOpacity != opacity))
+  {
+    animation.opacitySetter.functionPtr(animation.opacitySetter.argument, opacity);
+    animation.lastOpacity = opacity;
+    animation.isApplied   = true;
+  }
+}
+
+int32_t GUI::Animator::interpolate(int32_t startValue, int32_t endValue, uint32_t progress)
+{
+  const int64_t delta = static_cast<int64_t>(endValue - startValue) * progress;
+
+  // rounded to the nearest value, so the end value is reached exactly at full progress
+  const int64_t halfOfProgressOne = PROGRESS_ONE / 2u;
+  return startValue + static_cast<int32_t>((delta + ((delta < 0) ? -halfOfProgressOne : halfOfProgressOne)) /
+    static_cast<int64_t>(PROGRESS_ONE));
+}
+
+const void* GUI::Animator::getTarget(const Animation &animation)
+{
+  switch (animation.property)
+  {
+    case Property::POSITION:
+      return animation.objectPtr;
+
+    case Property::COLOR:
+      return animation.colorSetter.argument;
+
+    case Property::OPACITY:
+      return animation.opacitySetter.argument;
+
+    default:
+      return nullptr;
+  }
+}
\ No newline at end of file
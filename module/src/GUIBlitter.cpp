@@ -0,0 +1,149 @@
+#include "GUIBlitter.h"
+#include <cstring>
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1) && !defined(UNIT_TEST)
+#include "stm32l4r9xx.h"
+#endif
+
+
+namespace
+{
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1) && !defined(UNIT_TEST)
+
+  inline uint32_t uxtb16(uint32_t value)
+  {
+    return __UXTB16(value);
+  }
+
+  inline uint32_t smlad(uint32_t x, uint32_t y, uint32_t accumulator)
+  {
+    return __SMLAD(x, y, accumulator);
+  }
+
+  inline uint32_t pkhbt(uint32_t x, uint32_t y)
+  {
+    return __PKHBT(x, y, 16);
+  }
+
+  inline uint32_t pkhtb(uint32_t x, uint32_t y)
+  {
+    return __PKHTB(x, y, 16);
+  }
+
+#else
+
+  // portable equivalents of Cortex-M4 DSP instructions, used by host builds
+
+  inline uint32_t uxtb16(uint32_t value)
+  {
+    return value & 0x00FF00FFu;
+  }
+
+  inline uint32_t smlad(uint32_t x, uint32_t y, uint32_t accumulator)
+  {
+    const int32_t productLow  = static_cast<int16_t>(x & 0xFFFFu) * static_cast<int16_t>(y & 0xFFFFu);
+    const int32_t productHigh = static_cast<int16_t>(x >> 16u) * static_cast<int16_t>(y >> 16u);
+
+    return accumulator + static_cast<uint32_t>(productLow + productHigh);
+  }
+
+  inline uint32_t pkhbt(uint32_t x, uint32_t y)
+  {
+    return (x & 0x0000FFFFu) | (y << 16u);
+  }
+
+  inline uint32_t pkhtb(uint32_t x, uint32_t y)
+  {
+    return (x & 0xFFFF0000u) | (y >> 16u);
+  }
+
+#endif
+}
+
+void GUI::Blitter::copyRowRGB888(uint8_t *destinationPtr, const uint8_t *sourcePtr, uint32_t numberOfPixels)
+{
+  // source and destination rows can have different alignment, which is handled by library block copy
+  std::memcpy(destinationPtr, sourcePtr, 3u * numberOfPixels);
+}
+
+void GUI::Blitter::fillRowRGB888(uint8_t *destinationPtr, Color color, uint32_t numberOfPixels)
+{
+  constexpr uint32_t PATTERN_SIZE = 12u;
+
+  // one pixel longer than the pattern, so that pattern can start at any byte of the pixel
+  const uint8_t pixels[PATTERN_SIZE + 3u] =
+  {
+    color.blue, color.green, color.red,
+    color.blue, color.green, color.red,
+    color.blue, color.green, color.red,
+    color.blue, color.green, color.red,
+    color.blue, color.green, color.red
+  };
+  uint8_t *destinationEndPtr = destinationPtr + 3u * numberOfPixels;
+  uint32_t pixelByteIdx = 0u;
+
+  while ((0u != (reinterpret_cast<uintptr_t>(destinationPtr) & 0x3u)) && (destinationPtr != destinationEndPtr))
+  {
+    *destinationPtr++ = pixels[pixelByteIdx];
+    pixelByteIdx = (2u == pixelByteIdx) ? 0u : (pixelByteIdx + 1u);
+  }
+
+  uint32_t pattern[PATTERN_SIZE / sizeof(uint32_t)];
+  std::memcpy(pattern, &pixels[pixelByteIdx], PATTERN_SIZE);
+
+  while (static_cast<uint32_t>(destinationEndPtr - destinationPtr) >= PATTERN_SIZE)
+  {
+    uint32_t *destinationWordPtr = reinterpret_cast<uint32_t*>(destinationPtr);
+    destinationWordPtr[0] = pattern[0];
+    destinationWordPtr[1] = pattern[1];
+    destinationWordPtr[2] = pattern[2];
+    destinationPtr += PATTERN_SIZE;
+  }
+
+  // pattern is a whole number of pixels, so tail continues at the same byte of the pixel
+  while (destinationPtr != destinationEndPtr)
+  {
+    *destinationPtr++ = pixels[pixelByteIdx];
+    pixelByteIdx = (2u == pixelByteIdx) ? 0u : (pixelByteIdx + 1u);
+  }
+}
+
+void GUI::Blitter::blendRowARGB8888ToRGB888(uint8_t *destinationPtr, const uint8_t *sourcePtr, uint32_t numberOfPixels)
+{
+  const uint8_t *sourceEndPtr = sourcePtr + 4u * numberOfPixels;
+
+  for (; sourcePtr != sourceEndPtr; sourcePtr += 4u, destinationPtr += 3u)
+  {
+    const uint32_t alpha = sourcePtr[3];
+
+    if (255u == alpha)
+    {
+      destinationPtr[0] = sourcePtr[0];
+      destinationPtr[1] = sourcePtr[1];
+      destinationPtr[2] = sourcePtr[2];
+    }
+    else if (0u != alpha)
+    {
+      uint32_t sourcePixel;
+      std::memcpy(&sourcePixel, sourcePtr, sizeof(sourcePixel));
+      const uint32_t destinationPixel =
+        destinationPtr[0] | (static_cast<uint32_t>(destinationPtr[1]) << 8u) | (static_cast<uint32_t>(destinationPtr[2]) << 16u);
+
+      // lanes are [blue, red] and [green, alpha/unused]
+      const uint32_t sourceBlueRed       = uxtb16(sourcePixel);
+      const uint32_t sourceGreen         = uxtb16(sourcePixel >> 8u);
+      const uint32_t destinationBlueRed  = uxtb16(destinationPixel);
+      const uint32_t destinationGreen    = uxtb16(destinationPixel >> 8u);
+      const uint32_t alphaPair           = alpha | ((255u - alpha) << 16u);
+
+      // each channel is a * s + (255 - a) * d, calculated by one dual multiply-accumulate
+      const uint32_t blue  = smlad(pkhbt(sourceBlueRed, destinationBlueRed), alphaPair, 0u);
+      const uint32_t green = smlad(pkhbt(sourceGreen, destinationGreen), alphaPair, 0u);
+      const uint32_t red   = smlad(pkhtb(destinationBlueRed, sourceBlueRed), alphaPair, 0u);
+
+      destinationPtr[0] = static_cast<uint8_t>(divideBy255(blue));
+      destinationPtr[1] = static_cast<uint8_t>(divideBy255(green));
+      destinationPtr[2] = static_cast<uint8_t>(divideBy255(red));
+    }
+  }
+}
\ No newline at end of file
@@ -1,11 +1,31 @@
 #include "GUIContainer.h"
+#include <cstring>
 
 
 GUI::Container::Container(IArrayList<ObjectInfo> &objectInfoList, IFrameBuffer &frameBuffer):
   m_objectInfoList(objectInfoList),
   m_frameBufferPtr(&frameBuffer),
-  m_currentDrawingObjectIterator(m_objectInfoList.getEndIterator())
-{}
+  m_previousFrameBufferPtr(nullptr),
+  m_currentDrawingObjectIterator(m_objectInfoList.getEndIterator()),
+  m_currentDrawingRegionIterator(m_drawingRegionList.getEndIterator()),
+  m_currentDrawingClipRegion{ .x = 0, .y = 0, .width = 0u, .height = 0u },
+  m_drawCompletedCallback{
+    .functionPtr = nullptr,
+    .argument    = nullptr
+  },
+  m_currentTileRegion{ .x = 0, .y = 0, .width = 0u, .height = 0u },
+  m_currentTileLoadRegionIterator(m_drawingRegionList.getEndIterator()),
+  m_currentTileStoreRegionIterator(m_drawingRegionList.getEndIterator())
+{
+  // nothing has been drawn yet, so the whole frame buffer is damaged
+  invalidateRegion(getFrameBufferRegion());
+}
+
+GUI::Container::Container(IArrayList<ObjectInfo> &objectInfoList, IFrameBuffer &frameBuffer, DMA2D &dma2d):
+  Container(objectInfoList, frameBuffer)
+{
+  m_dma2dPtr = &dma2d;
+}
 
 IFrameBuffer& GUI::Container::getFrameBuffer(void)
 {
@@ -19,11 +39,29 @@ const IFrameBuffer& GUI::Container::getFrameBuffer(void) const
 
 void GUI::Container::setFrameBuffer(IFrameBuffer &frameBuffer)
 {
-  m_frameBufferPtr = &frameBuffer;
-
-  for (auto it = getBeginIterator(); it != getEndIterator(); it++)
+  if (&frameBuffer != m_frameBufferPtr)
   {
-    (*it)->setFrameBuffer(frameBuffer);
+    IFrameBuffer *previousFrameBufferPtr = m_previousFrameBufferPtr;
+
+    // hit-testing grid cells are derived from the frame buffer dimension
+    if (frameBuffer.getDimension() != m_frameBufferPtr->getDimension())
+    {
+      m_isHitTestGridValid = false;
+    }
+
+    m_previousFrameBufferPtr = m_frameBufferPtr;
+    m_frameBufferPtr         = &frameBuffer;
+
+    setFrameBufferOfAllObjects(frameBuffer);
+
+    if (&frameBuffer == previousFrameBufferPtr)
+    {
+      invalidateRegionsDrawnIntoOtherFrameBuffer();
+    }
+    else
+    {
+      invalidateRegion(getFrameBufferRegion());
+    }
   }
 }
 
@@ -97,13 +135,85 @@ GUI::ErrorCode GUI::Container::addObject(IObject *objectPtr, uint32_t zIndex)
       .argument    = this
     };
 
+    const IClippable::DamagedRegionCallbackDescription damagedRegionCallbackDescription =
+    {
+      .functionPtr = objectDamagedRegionCallback,
+      .argument    = this
+    };
+
     objectPtr->setFrameBuffer(getFrameBuffer());
     objectPtr->registerDrawCompletedCallback(callbackDescription);
+    objectPtr->registerDamagedRegionCallback(damagedRegionCallbackDescription);
+
+    invalidateRegion(objectPtr->getRegion());
+    m_isHitTestGridValid = false;
+  }
+
+  return errorCode;
+}
+
+void GUI::Container::invalidateRegion(const Region &region)
+{
+  Region damagedRegion = region.getIntersection(getFrameBufferRegion());
+
+  if (not damagedRegion.isEmpty())
+  {
+    // merge all already damaged regions which overlap with the new one, so the list stays disjoint
+    auto it = m_damagedRegionList.getBeginIterator();
+    while (m_damagedRegionList.getEndIterator() != it)
+    {
+      if (it->doesOverlap(damagedRegion))
+      {
+        damagedRegion = damagedRegion.getUnion(*it);
+        m_damagedRegionList.removeElement(it - m_damagedRegionList.getBeginIterator());
+        it = m_damagedRegionList.getBeginIterator();
+      }
+      else
+      {
+        ++it;
+      }
+    }
+
+    if (m_damagedRegionList.isFull())
+    {
+      mergeIntoDamagedRegionWithTheLeastGrowth(damagedRegion);
+    }
+    else
+    {
+      m_damagedRegionList.addElement(damagedRegion);
+    }
+  }
+}
+
+GUI::ErrorCode GUI::Container::enableTiledRendering(ITileFrameBuffer &tileFrameBuffer)
+{
+  ErrorCode errorCode = ErrorCode::OK;
+
+  if ((tileFrameBuffer.getDimension() != getFrameBuffer().getDimension()) ||
+      (tileFrameBuffer.getColorFormat() != getFrameBuffer().getColorFormat()) ||
+      (0u == tileFrameBuffer.getTileHeight()))
+  {
+    errorCode = ErrorCode::INCOMPATIBLE_TILE_FBUFF;
+  }
+
+  if (ErrorCode::OK == errorCode)
+  {
+    m_tileFrameBufferPtr = &tileFrameBuffer;
   }
 
   return errorCode;
 }
 
+void GUI::Container::disableTiledRendering(void)
+{
+  m_tileFrameBufferPtr = nullptr;
+}
+
+bool GUI::Container::isTiledRenderingEnabled(void) const
+{
+  return (nullptr != m_tileFrameBufferPtr);
+}
+
 GUI::Container::Iterator GUI::Container::getBeginIterator(void)
 {
   return Iterator(m_objectInfoList.getBeginIterator());
@@ -114,9 +224,19 @@ GUI::Container::Iterator GUI::Container::getEndIterator(void)
   return Iterator(m_objectInfoList.getEndIterator());
 }
 
+void GUI::Container::attachFrameProfiler(FrameProfiler &frameProfiler)
+{
+  m_frameProfilerPtr = &frameProfiler;
+}
+
+void GUI::Container::detachFrameProfiler(void)
+{
+  m_frameProfilerPtr = nullptr;
+}
+
 void GUI::Container::draw(DrawHardware drawHardware)
 {
-  if (not isEmpty())
+  if ((not isEmpty()) && (not m_damagedRegionList.isEmpty()))
   {
     startDrawingTransaction(drawHardware);
 
@@ -124,14 +244,66 @@ void GUI::Container::draw(DrawHardware drawHardware)
     {
       case DrawHardware::DMA2D:
       {
-        drawDMA2D();
+        // tile copies are batched together with object draws, so tiling requires the DMA2D command queue
+        if (isTiledRenderingEnabled() && (nullptr != m_dma2dPtr))
+        {
+          drawTiledDMA2D();
+        }
+        else
+        {
+          drawDMA2D();
+        }
+      }
+      break;
+
+      case DrawHardware::HYBRID:
+      {
+        // CPU draws alongside the DMA2D command queue, tiled rendering keeps its pure DMA2D batching
+        if (isTiledRenderingEnabled() && (nullptr != m_dma2dPtr))
+        {
+          m_drawHardwareInUsage = DrawHardware::DMA2D;
+          drawTiledDMA2D();
+        }
+        else if (nullptr != m_dma2dPtr)
+        {
+          drawHybrid();
+        }
+        else
+        {
+          // objects are chained one by one, as with DMA2D
+          m_drawHardwareInUsage = DrawHardware::DMA2D;
+          drawDMA2D();
+        }
+      }
+      break;
+
+      case DrawHardware::AUTO:
+      {
+        // objects are drawn one by one, so that each draw is measured and fed into the object's cost model
+        if (isTiledRenderingEnabled() && (nullptr != m_dma2dPtr))
+        {
+          m_drawHardwareInUsage = DrawHardware::DMA2D;
+          drawTiledDMA2D();
+        }
+        else
+        {
+          drawAuto();
+        }
       }
       break;
 
       default:
       case DrawHardware::CPU:
       {
-        drawCPU();
+        if (isTiledRenderingEnabled())
+        {
+          drawTiledCPU();
+        }
+        else
+        {
+          drawCPU();
+        }
+
         endDrawingTransaction();
         callDrawCompletedCallbackIfRegistered();
      }
@@ -140,27 +312,55 @@ void GUI::Container::draw(DrawHardware drawHardware)
   }
   else
   {
+    // nothing is drawn, so frame buffers do not diverge in this frame
+    m_drawingRegionList = ArrayList<Region, MAX_DAMAGED_REGION_COUNT>();
+    m_lastDrawnRegion   = {};
     callDrawCompletedCallbackIfRegistered();
   }
 }
 
+GUI::Region GUI::Container::getLastDrawnRegion(void) const
+{
+  return m_lastDrawnRegion;
+}
+
 bool GUI::Container::isDrawCompleted(void) const
 {
   return m_isDrawingCompleted;
 }
 
+void GUI::Container::runtimeTask(void)
+{
+  if (not m_isDrawingCompleted)
+  {
+    if (DrawHardware::AUTO == m_drawHardwareInUsage)
+    {
+      continueAutoDrawing();
+    }
+    else if (DrawHardware::HYBRID == m_drawHardwareInUsage)
+    {
+      continueHybridDrawing();
+    }
+    else if ((DrawHardware::DMA2D == m_drawHardwareInUsage) && (nullptr != m_dma2dPtr))
+    {
+      continueDMA2DDrawing();
+    }
+  }
+}
+
 GUI::ErrorCode GUI::Container::getDrawingTime(DrawHardware drawHardware, uint64_t &drawingTimeInUs) const
 {
-  ErrorCode errorCode = ErrorCode::OK;
+  ErrorCode errorCode = ErrorCode::MEASUREMENT_NOT_AVAILABLE;
   uint64_t containerDrawingTimeInUs = 0u;
   uint64_t objectDrawingTimeInUs;
 
   for (auto it = m_objectInfoList.getBeginIterator(); it != m_objectInfoList.getEndIterator(); ++it)
   {
-    if (ErrorCode::OK == errorCode)
+    // object which has never been drawn leaves its drawing time unset, so it is skipped
+    if (ErrorCode::OK == it->objectPtr->getDrawingTime(drawHardware, objectDrawingTimeInUs))
     {
-      errorCode = it->objectPtr->getDrawingTime(drawHardware, objectDrawingTimeInUs);
       containerDrawingTimeInUs += objectDrawingTimeInUs;
+      errorCode = ErrorCode::OK;
     }
   }
 
@@ -186,23 +386,35 @@ void GUI::Container::unregisterDrawCompletedCallback(void)
 GUI::IObject* GUI::Container::getEventTarget(const TouchEvent &touchEvent)
 {
   GUI::IObject *eventTargetPtr = nullptr;
+  const IArrayList<Point> &touchPoints = touchEvent.getTouchPoints();
 
-  if (not touchEvent.getTouchPoints().isEmpty())
+  if (not touchPoints.isEmpty())
   {
-    for (auto it = getBeginIterator(); it != getEndIterator(); it++)
+    uint64_t candidateObjectMask = 0u;
+
+    if (getHitTestGridCandidateObjectMask(touchPoints, candidateObjectMask))
     {
-      if (doesGUIObjectContainAnyOfTouchPoints(**it, touchEvent.getTouchPoints()))
-      {
-        eventTargetPtr = *it;
-      }
+      eventTargetPtr = findEventTargetInHitTestGrid(candidateObjectMask, touchPoints);
+    }
+    else
+    {
+      eventTargetPtr = findEventTargetLinearly(touchPoints);
     }
   }
 
+  m_lastEventTargetPtr = eventTargetPtr;
+
   return eventTargetPtr;
 }
 
 void GUI::Container::dispatchEvent(TouchEvent &touchEvent)
 {
+  if ((nullptr != m_lastEventTargetPtr) && (touchEvent.getEventTargetObject() == m_lastEventTargetPtr))
+  {
+    m_lastEventTargetPtr->notify(touchEvent);
+    return;
+  }
+
   for (auto it = getBeginIterator(); it != getEndIterator(); it++)
   {
     if (touchEvent.getEventTargetObject() == (*it))
@@ -227,6 +439,138 @@ bool GUI::Container::doesGUIObjectContainAnyOfTouchPoints(
   return false;
 }
 
+GUI::IObject* GUI::Container::findEventTargetLinearly(const IArrayList<Point> &touchPoints)
+{
+  GUI::IObject *eventTargetPtr = nullptr;
+
+  for (auto it = getBeginIterator(); it != getEndIterator(); it++)
+  {
+    if (doesGUIObjectContainAnyOfTouchPoints(**it, touchPoints))
+    {
+      eventTargetPtr = *it;
+    }
+  }
+
+  return eventTargetPtr;
+}
+
+GUI::IObject* GUI::Container::findEventTargetInHitTestGrid(
+  uint64_t candidateObjectMask,
+  const IArrayList<Point> &touchPoints)
+{
+  // objects are checked from the highest z-index down, so the first match is the event target
+  while (0u != candidateObjectMask)
+  {
+    const uint32_t objectIdx = 63u - static_cast<uint32_t>(__builtin_clzll(candidateObjectMask));
+    IObject *objectPtr = (m_objectInfoList.getBeginIterator() + objectIdx)->objectPtr;
+
+    if (doesGUIObjectContainAnyOfTouchPoints(*objectPtr, touchPoints))
+    {
+      return objectPtr;
+    }
+
+    candidateObjectMask &= ~(static_cast<uint64_t>(1u) << objectIdx);
+  }
+
+  return nullptr;
+}
+
+bool GUI::Container::getHitTestGridCandidateObjectMask(
+  const IArrayList<Point> &touchPoints,
+  uint64_t &candidateObjectMask)
+{
+  if (m_objectInfoList.getSize() > MAX_HIT_TEST_GRID_OBJECT_COUNT)
+  {
+    return false;
+  }
+
+  if (not m_isHitTestGridValid)
+  {
+    rebuildHitTestGrid();
+  }
+
+  candidateObjectMask = 0u;
+
+  for (auto it = touchPoints.getBeginIterator(); it != touchPoints.getEndIterator(); it++)
+  {
+    uint32_t cellIdx;
+
+    // grid covers only the frame buffer, objects partially outside of it are hit-tested linearly there
+    if (not getHitTestGridCellIdx(*it, cellIdx))
+    {
+      return false;
+    }
+
+    candidateObjectMask |= m_hitTestGrid[cellIdx];
+  }
+
+  return true;
+}
+
+bool GUI::Container::getHitTestGridCellIdx(Point point, uint32_t &cellIdx) const
+{
+  if ((point.x < 0) || (point.y < 0) ||
+      (point.x >= static_cast<int32_t>(getFrameBuffer().getWidth())) ||
+      (point.y >= static_cast<int32_t>(getFrameBuffer().getHeight())))
+  {
+    return false;
+  }
+
+  cellIdx = (point.y / getHitTestGridCellHeight()) * HIT_TEST_GRID_SIZE + (point.x / getHitTestGridCellWidth());
+
+  return true;
+}
+
+void GUI::Container::rebuildHitTestGrid(void)
+{
+  const int32_t frameBufferWidth  = getFrameBuffer().getWidth();
+  const int32_t frameBufferHeight = getFrameBuffer().getHeight();
+  const int32_t cellWidth         = getHitTestGridCellWidth();
+  const int32_t cellHeight        = getHitTestGridCellHeight();
+
+  memset(m_hitTestGrid, 0, sizeof(m_hitTestGrid));
+
+  uint32_t objectIdx = 0u;
+  for (auto it = m_objectInfoList.getBeginIterator(); it != m_objectInfoList.getEndIterator(); ++it, ++objectIdx)
+  {
+    const Region region = it->objectPtr->getRegion();
+
+    // edges are inclusive, as doesContainPoint accepts points lying on them
+    const int32_t regionRight  = static_cast<int32_t>(region.x) + region.width;
+    const int32_t regionBottom = static_cast<int32_t>(region.y) + region.height;
+
+    const int32_t left   = (region.x < 0) ? 0 : region.x;
+    const int32_t top    = (region.y < 0) ? 0 : region.y;
+    const int32_t right  = (regionRight < frameBufferWidth) ? regionRight : (frameBufferWidth - 1);
+    const int32_t bottom = (regionBottom < frameBufferHeight) ? regionBottom : (frameBufferHeight - 1);
+
+    if ((left > right) || (top > bottom))
+    {
+      continue;
+    }
+
+    for (int32_t row = top / cellHeight; row <= (bottom / cellHeight); ++row)
+    {
+      for (int32_t column = left / cellWidth; column <= (right / cellWidth); ++column)
+      {
+        m_hitTestGrid[row * HIT_TEST_GRID_SIZE + column] |= static_cast<uint64_t>(1u) << objectIdx;
+      }
+    }
+  }
+
+  m_isHitTestGridValid = true;
+}
+
+uint16_t GUI::Container::getHitTestGridCellWidth(void) const
+{
+  return (getFrameBuffer().getWidth() + HIT_TEST_GRID_SIZE - 1u) / HIT_TEST_GRID_SIZE;
+}
+
+uint16_t GUI::Container::getHitTestGridCellHeight(void) const
+{
+  return (getFrameBuffer().getHeight() + HIT_TEST_GRID_SIZE - 1u) / HIT_TEST_GRID_SIZE;
+}
+
 GUI::Position GUI::Container::getPositionTopLeftCorner(void) const
 {
   return
@@ -321,83 +665,926 @@ GUI::ErrorCode GUI::Container::insertObjectInfoIntoList(const ObjectInfo &object
 
 void GUI::Container::drawDMA2D(void)
 {
+  m_currentDrawingRegionIterator = m_drawingRegionList.getBeginIterator();
   m_currentDrawingObjectIterator = getBeginIterator();
-  (*m_currentDrawingObjectIterator)->draw(DrawHardware::DMA2D);
+
+  if (nullptr != m_dma2dPtr)
+  {
+    __atomic_store_n(&m_isDMA2DBatchCompleted, false, __ATOMIC_SEQ_CST);
+    drawDMA2DBatches();
+  }
+  else
+  {
+    bool isDrawingStartedSuccessfully = startDrawingOfTheNextObject();
+    if (not isDrawingStartedSuccessfully)
+    {
+      endDrawingTransaction();
+      callDrawCompletedCallbackIfRegistered();
+    }
+  }
 }
 
 void GUI::Container::drawCPU(void)
 {
+  m_currentDrawingRegionIterator = m_drawingRegionList.getBeginIterator();
   m_currentDrawingObjectIterator = getBeginIterator();
-  while (getEndIterator() != m_currentDrawingObjectIterator)
+
+  while (findNextObjectToDraw())
   {
-    (m_currentDrawingObjectIterator++)->draw(DrawHardware::CPU);
+    drawCurrentObject(DrawHardware::CPU);
+    m_currentDrawingObjectIterator++;
   }
 }
 
-void GUI::Container::startDrawingTransaction(DrawHardware drawHardware)
+void GUI::Container::drawAuto(void)
 {
-  m_isDrawingCompleted  = false;
-  m_drawHardwareInUsage = drawHardware;
+  m_currentDrawingRegionIterator = m_drawingRegionList.getBeginIterator();
+  m_currentDrawingObjectIterator = getBeginIterator();
+  __atomic_store_n(&m_isAutoObjectDrawingCompleted, false, __ATOMIC_SEQ_CST);
+
+  drawAutoObjects();
 }
 
-void GUI::Container::endDrawingTransaction(void)
+void GUI::Container::drawAutoObjects(void)
 {
-  m_isDrawingCompleted = true;
+  // objects drawn synchronously are followed in this loop, so they neither nest calls nor run in interrupt
+  while (startDrawingOfTheNextObject())
+  {
+    if (not __atomic_exchange_n(&m_isAutoObjectDrawingCompleted, false, __ATOMIC_SEQ_CST))
+    {
+      // object is drawn by DMA2D, runtimeTask continues once its completion is signaled
+      return;
+    }
+
+    m_currentDrawingObjectIterator++;
+  }
+
+  endDrawingTransaction();
+  callDrawCompletedCallbackIfRegistered();
 }
 
-void GUI::Container::callDrawCompletedCallbackIfRegistered(void)
+void GUI::Container::continueAutoDrawing(void)
 {
-  if (nullptr != m_drawCompletedCallback.functionPtr)
+  if (__atomic_exchange_n(&m_isAutoObjectDrawingCompleted, false, __ATOMIC_SEQ_CST))
   {
-    m_drawCompletedCallback.functionPtr(m_drawCompletedCallback.argument);
+    m_currentDrawingObjectIterator++;
+    drawAutoObjects();
   }
 }
 
-GUI::ErrorCode GUI::Container::mapToErrorCode(IArrayListBase::ErrorCode errorCode)
+void GUI::Container::drawHybrid(void)
 {
-  switch (errorCode)
+  m_currentDrawingRegionIterator = m_drawingRegionList.getBeginIterator();
+  m_currentDrawingObjectIterator = getBeginIterator();
+
+  drawHybridBatches();
+}
+
+void GUI::Container::drawTiledDMA2D(void)
+{
+  startTiledDrawing();
+  __atomic_store_n(&m_isDMA2DBatchCompleted, false, __ATOMIC_SEQ_CST);
+
+  if (prepareNextTileDrawing())
   {
-    case IArrayListBase::ErrorCode::CONTAINER_FULL_ERROR:
-      return ErrorCode::CONTAINER_FULL_ERROR;
+    drawTiledDMA2DBatches();
+  }
+  else
+  {
+    endTiledDrawing();
+    endDrawingTransaction();
+    callDrawCompletedCallbackIfRegistered();
+  }
+}
 
-    case IArrayListBase::ErrorCode::OK:
-    case IArrayListBase::ErrorCode::OUT_OF_RANGE_ERROR:
-    case IArrayListBase::ErrorCode::NULL_POINTER_ERROR:
-    default:
-      return ErrorCode::OK;
+void GUI::Container::drawTiledCPU(void)
+{
+  startTiledDrawing();
+
+  while (prepareNextTileDrawing())
+  {
+    loadCurrentTileFromFrameBufferCPU();
+    drawCPU();
+    storeCurrentTileIntoFrameBufferCPU();
   }
+
+  endTiledDrawing();
 }
 
-bool GUI::Container::startDrawingOfTheNextObjectWithDMA2D(void)
+void GUI::Container::startTiledDrawing(void)
 {
-  bool isDrawingStartedSuccessfully = false;
+  int16_t firstRow = static_cast<int16_t>(getFrameBuffer().getHeight());
 
-  m_currentDrawingObjectIterator++;
-  if (getEndIterator() != m_currentDrawingObjectIterator)
+  m_tiledDrawingRegionList = m_drawingRegionList;
+  for (auto it = m_tiledDrawingRegionList.getBeginIterator(); it != m_tiledDrawingRegionList.getEndIterator(); ++it)
   {
-    (*(m_currentDrawingObjectIterator))->draw(DrawHardware::DMA2D);
-    isDrawingStartedSuccessfully = true;
+    if (it->y < firstRow)
+    {
+      firstRow = it->y;
+    }
   }
 
-  return isDrawingStartedSuccessfully;
+  // empty tile right above the first damaged row, so the first tile starts at that row
+  m_currentTileRegion =
+  {
+    .x      = 0,
+    .y      = firstRow,
+    .width  = getFrameBuffer().getWidth(),
+    .height = 0u
+  };
 }
 
-void GUI::Container::objectDrawingCompletedCallback(void *guiContainerPtr)
+void GUI::Container::endTiledDrawing(void)
 {
-  GUI::Container *containerPtr = reinterpret_cast<GUI::Container*>(guiContainerPtr);
+  setFrameBufferOfAllObjects(getFrameBuffer());
 
-  if (nullptr != containerPtr)
+  // swap chain has to know about whole damaged regions, not only about the last tile
+  m_drawingRegionList = m_tiledDrawingRegionList;
+}
+
+bool GUI::Container::prepareNextTileDrawing(void)
+{
+  do
   {
-    if (DrawHardware::DMA2D == containerPtr->m_drawHardwareInUsage)
+    const int32_t tileFirstRow = m_currentTileRegion.y + m_currentTileRegion.height;
+    const int32_t frameBufferHeight = getFrameBuffer().getHeight();
+
+    if (tileFirstRow >= frameBufferHeight)
     {
-      bool isDrawingStartedSuccessfully = containerPtr->startDrawingOfTheNextObjectWithDMA2D();
-      if (not isDrawingStartedSuccessfully)
+      return false;
+    }
+
+    m_currentTileRegion.y = static_cast<int16_t>(tileFirstRow);
+    m_currentTileRegion.height = static_cast<uint16_t>(
+      (frameBufferHeight - tileFirstRow) < m_tileFrameBufferPtr->getTileHeight() ?
+      (frameBufferHeight - tileFirstRow) : m_tileFrameBufferPtr->getTileHeight());
+
+    m_drawingRegionList = ArrayList<Region, MAX_DAMAGED_REGION_COUNT>();
+    for (auto it = m_tiledDrawingRegionList.getBeginIterator(); it != m_tiledDrawingRegionList.getEndIterator(); ++it)
+    {
+      const Region tileDrawingRegion = it->getIntersection(m_currentTileRegion);
+      if (not tileDrawingRegion.isEmpty())
       {
-        containerPtr->endDrawingTransaction();
-        containerPtr->callDrawCompletedCallbackIfRegistered();
+        m_drawingRegionList.addElement(tileDrawingRegion);
       }
     }
   }
+  while (m_drawingRegionList.isEmpty());
+
+  // objects keep pointer of the frame buffer, so they have to be updated each time the tile is moved
+  m_tileFrameBufferPtr->setTileFirstRow(static_cast<uint16_t>(m_currentTileRegion.y));
+  setFrameBufferOfAllObjects(*m_tileFrameBufferPtr);
+
+  m_currentDrawingRegionIterator   = m_drawingRegionList.getBeginIterator();
+  m_currentDrawingObjectIterator   = getBeginIterator();
+  m_currentTileLoadRegionIterator  = m_drawingRegionList.getBeginIterator();
+  m_currentTileStoreRegionIterator = m_drawingRegionList.getBeginIterator();
+
+  return true;
+}
+
+void GUI::Container::loadCurrentTileFromFrameBufferCPU(void)
+{
+  for (auto it = m_drawingRegionList.getBeginIterator(); it != m_drawingRegionList.getEndIterator(); ++it)
+  {
+    if (isCurrentTileLoadNeeded(*it))
+    {
+      copyRegionCPU(*it, getFrameBuffer(), *m_tileFrameBufferPtr);
+    }
+  }
+}
+
+void GUI::Container::storeCurrentTileIntoFrameBufferCPU(void)
+{
+  for (auto it = m_drawingRegionList.getBeginIterator(); it != m_drawingRegionList.getEndIterator(); ++it)
+  {
+    copyRegionCPU(*it, *m_tileFrameBufferPtr, getFrameBuffer());
+  }
+}
+
+void GUI::Container::drawTiledDMA2DBatches(void)
+{
+  // DMA2D interrupt only signals completion of a batch, so every batch is enqueued here, outside of interrupt
+  while ((not isCurrentTileDrawingCompleted()) || prepareNextTileDrawing())
+  {
+    enqueueTiledDMA2DDrawCommands();
+    executeDMA2DBatch();
+
+    if (m_isDMA2DBatchExecutionPending ||
+        (not __atomic_exchange_n(&m_isDMA2DBatchCompleted, false, __ATOMIC_SEQ_CST)))
+    {
+      // runtimeTask enqueues the next batch once the current one is completed
+      return;
+    }
+
+    endDMA2DBatchProfiling();
+  }
+
+  endTiledDrawing();
+  endDrawingTransaction();
+  callDrawCompletedCallbackIfRegistered();
+}
+
+void GUI::Container::enqueueTiledDMA2DDrawCommands(void)
+{
+  // tile is stored into the frame buffer only after all objects are drawn into it
+  if (enqueueCurrentTileLoadCommands() && enqueueDMA2DDrawCommandsOfRemainingObjects())
+  {
+    enqueueCurrentTileStoreCommands();
+  }
+}
+
+bool GUI::Container::enqueueCurrentTileLoadCommands(void)
+{
+  for (; m_drawingRegionList.getEndIterator() != m_currentTileLoadRegionIterator; ++m_currentTileLoadRegionIterator)
+  {
+    if (isCurrentTileLoadNeeded(*m_currentTileLoadRegionIterator) &&
+        (not enqueueCopyRegionCommand(*m_currentTileLoadRegionIterator, getFrameBuffer(), *m_tileFrameBufferPtr)))
+    {
+      // the rest is enqueued once the current batch is executed
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool GUI::Container::enqueueCurrentTileStoreCommands(void)
+{
+  for (; m_drawingRegionList.getEndIterator() != m_currentTileStoreRegionIterator; ++m_currentTileStoreRegionIterator)
+  {
+    if (not enqueueCopyRegionCommand(*m_currentTileStoreRegionIterator, *m_tileFrameBufferPtr, getFrameBuffer()))
+    {
+      // the rest is enqueued once the current batch is executed
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool GUI::Container::enqueueCopyRegionCommand(
+  const Region &region,
+  const IFrameBuffer &sourceFrameBuffer,
+  IFrameBuffer &destinationFrameBuffer)
+{
+  const DMA2D::Position position =
+  {
+    .x = static_cast<uint16_t>(region.x),
+    .y = static_cast<uint16_t>(region.y)
+  };
+  const DMA2D::Dimension frameBufferDimension =
+  {
+    .width  = getFrameBuffer().getWidth(),
+    .height = getFrameBuffer().getHeight()
+  };
+
+  const DMA2D::CopyBitmapConfig copyBitmapConfig =
+  {
+    .dimension =
+    {
+      .width  = region.width,
+      .height = region.height
+    },
+    .sourceRectanglePosition = position,
+    .sourceBufferConfig =
+    {
+      .colorFormat     = mapToDMA2DInputColorFormat(sourceFrameBuffer.getColorFormat()),
+      .bufferDimension = frameBufferDimension,
+      .bufferPtr       = sourceFrameBuffer.getPointer()
+    },
+    .destinationRectanglePosition = position,
+    .destinationBufferConfig =
+    {
+      .colorFormat     = mapToDMA2DOutputColorFormat(destinationFrameBuffer.getColorFormat()),
+      .bufferDimension = frameBufferDimension,
+      .bufferPtr       = destinationFrameBuffer.getPointer()
+    },
+    .drawCompletedCallback =
+    {
+      .functionPtr = nullptr,
+      .argument    = nullptr
+    }
+  };
+
+  return (DMA2D::ErrorCode::OK == m_dma2dPtr->enqueueCopyBitmap(copyBitmapConfig));
+}
+
+bool GUI::Container::isCurrentTileDrawingCompleted(void)
+{
+  return (m_drawingRegionList.getEndIterator() == m_currentTileLoadRegionIterator) &&
+         (not findNextObjectToDraw()) &&
+         (m_drawingRegionList.getEndIterator() == m_currentTileStoreRegionIterator);
+}
+
+bool GUI::Container::isCurrentTileLoadNeeded(const Region &region)
+{
+  // tile memory holds content of the previous tile, so parts not overdrawn by objects have to be loaded
+  return not isRegionCoveredByOpaqueObject(region);
+}
+
+bool GUI::Container::isRegionCoveredByOpaqueObject(const Region &region)
+{
+  for (auto it = getBeginIterator(); it != getEndIterator(); it++)
+  {
+    if ((*it)->isOpaque() && region.getDifference((*it)->getRegion()).isEmpty())
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void GUI::Container::setFrameBufferOfAllObjects(IFrameBuffer &frameBuffer)
+{
+  for (auto it = getBeginIterator(); it != getEndIterator(); it++)
+  {
+    (*it)->setFrameBuffer(frameBuffer);
+  }
+}
+
+void GUI::Container::startDrawingTransaction(DrawHardware drawHardware)
+{
+  m_isDrawingCompleted  = false;
+  m_drawHardwareInUsage = drawHardware;
+
+  // regions damaged while drawing is ongoing are going to be redrawn at the next draw call
+  m_drawingRegionList = m_damagedRegionList;
+  m_damagedRegionList = ArrayList<Region, MAX_DAMAGED_REGION_COUNT>();
+
+  // tiled rendering later narrows m_drawingRegionList to the current tile, so the bounding box is taken here
+  m_lastDrawnRegion = {};
+  for (auto it = m_drawingRegionList.getBeginIterator(); it != m_drawingRegionList.getEndIterator(); ++it)
+  {
+    m_lastDrawnRegion = m_lastDrawnRegion.getUnion(*it);
+  }
+
+  if (nullptr != m_frameProfilerPtr)
+  {
+    m_frameProfilerPtr->startFrame();
+  }
+}
+
+void GUI::Container::endDrawingTransaction(void)
+{
+  resetClipRegionOfAllObjects();
+  m_isDrawingCompleted = true;
+
+  if (nullptr != m_frameProfilerPtr)
+  {
+    m_frameProfilerPtr->endFrame();
+  }
+}
+
+bool GUI::Container::findNextObjectToDraw(void)
+{
+  while (m_drawingRegionList.getEndIterator() != m_currentDrawingRegionIterator)
+  {
+    while (getEndIterator() != m_currentDrawingObjectIterator)
+    {
+      m_currentDrawingClipRegion = calculateVisibleRegionOfCurrentObject();
+      if (not m_currentDrawingClipRegion.isEmpty())
+      {
+        return true;
+      }
+
+      m_currentDrawingObjectIterator++;
+    }
+
+    ++m_currentDrawingRegionIterator;
+    m_currentDrawingObjectIterator = getBeginIterator();
+  }
+
+  return false;
+}
+
+GUI::Region GUI::Container::calculateVisibleRegionOfCurrentObject(void)
+{
+  Region visibleRegion = (*m_currentDrawingObjectIterator)->getRegion().getIntersection(*m_currentDrawingRegionIterator);
+
+  // objects are sorted by z-index, so every object after the current one is drawn on top of it
+  Iterator it = m_currentDrawingObjectIterator;
+  for (it++; (getEndIterator() != it) && (not visibleRegion.isEmpty()); it++)
+  {
+    if ((*it)->isOpaque())
+    {
+      visibleRegion = visibleRegion.getDifference((*it)->getRegion());
+    }
+  }
+
+  return visibleRegion;
+}
+
+void GUI::Container::drawCurrentObject(DrawHardware drawHardware)
+{
+  IObject *objectPtr = *m_currentDrawingObjectIterator;
+  const uint32_t zIndex = m_currentDrawingObjectIterator.getZIndex();
+
+  if (DrawHardware::CPU == drawHardware)
+  {
+    drawObjectWithCPU(objectPtr, zIndex, m_currentDrawingClipRegion);
+  }
+  else if (nullptr != m_frameProfilerPtr)
+  {
+    // drawing is completed in the object's draw completed callback, which may come before the draw call returns
+    const uint32_t objectDrawingId =
+      m_frameProfilerPtr->startObjectDrawing(objectPtr, zIndex, m_currentDrawingClipRegion.getArea());
+
+    objectPtr->setClipRegion(m_currentDrawingClipRegion);
+    objectPtr->draw(drawHardware);
+
+    m_frameProfilerPtr->returnFromObjectDrawing(objectDrawingId);
+  }
+  else
+  {
+    objectPtr->setClipRegion(m_currentDrawingClipRegion);
+    objectPtr->draw(drawHardware);
+  }
+}
+
+void GUI::Container::drawObjectWithCPU(IObject *objectPtr, uint32_t zIndex, const Region &clipRegion)
+{
+  objectPtr->setClipRegion(clipRegion);
+
+  if (nullptr != m_frameProfilerPtr)
+  {
+    const uint64_t startTimestamp = m_frameProfilerPtr->getTimestamp();
+
+    objectPtr->draw(DrawHardware::CPU);
+
+    m_frameProfilerPtr->addCPUDrawing(objectPtr, zIndex, startTimestamp, clipRegion.getArea());
+  }
+  else
+  {
+    objectPtr->draw(DrawHardware::CPU);
+  }
+}
+
+void GUI::Container::resetClipRegionOfAllObjects(void)
+{
+  for (auto it = getBeginIterator(); it != getEndIterator(); it++)
+  {
+    (*it)->resetClipRegion();
+  }
+}
+
+void GUI::Container::invalidateRegionsDrawnIntoOtherFrameBuffer(void)
+{
+  // frame buffer was up to date before the last draw call, which was done into the other frame buffer
+  for (auto it = m_drawingRegionList.getBeginIterator(); it != m_drawingRegionList.getEndIterator(); it++)
+  {
+    invalidateRegion(*it);
+  }
+}
+
+GUI::Region GUI::Container::getFrameBufferRegion(void) const
+{
+  return
+  {
+    .x      = 0,
+    .y      = 0,
+    .width  = getFrameBuffer().getWidth(),
+    .height = getFrameBuffer().getHeight()
+  };
+}
+
+void GUI::Container::mergeIntoDamagedRegionWithTheLeastGrowth(const Region &region)
+{
+  auto bestIt = m_damagedRegionList.getBeginIterator();
+  uint32_t bestGrowth = UINT32_MAX;
+
+  for (auto it = m_damagedRegionList.getBeginIterator(); it != m_damagedRegionList.getEndIterator(); ++it)
+  {
+    const uint32_t growth = it->getUnion(region).getArea() - it->getArea();
+    if (growth < bestGrowth)
+    {
+      bestGrowth = growth;
+      bestIt     = it;
+    }
+  }
+
+  // merged region can now overlap with other damaged regions, so insert it again from scratch
+  const Region mergedRegion = bestIt->getUnion(region);
+  m_damagedRegionList.removeElement(bestIt - m_damagedRegionList.getBeginIterator());
+  invalidateRegion(mergedRegion);
+}
+
+void GUI::Container::callDrawCompletedCallbackIfRegistered(void)
+{
+  if (nullptr != m_drawCompletedCallback.functionPtr)
+  {
+    m_drawCompletedCallback.functionPtr(m_drawCompletedCallback.argument);
+  }
+}
+
+void GUI::Container::copyRegionCPU(
+  const Region &region,
+  const IFrameBuffer &sourceFrameBuffer,
+  IFrameBuffer &destinationFrameBuffer)
+{
+  const uint32_t pixelSize = IFrameBuffer::getColorFormatPixelSize(sourceFrameBuffer.getColorFormat());
+  const uint32_t rowSize   = sourceFrameBuffer.getWidth() * pixelSize;
+  const uint8_t *sourcePtr = reinterpret_cast<const uint8_t*>(sourceFrameBuffer.getPointer());
+  uint8_t *destinationPtr  = reinterpret_cast<uint8_t*>(destinationFrameBuffer.getPointer());
+
+  for (int32_t row = region.y; row < (region.y + region.height); ++row)
+  {
+    const uint32_t offset = row * rowSize + region.x * pixelSize;
+    memcpy(destinationPtr + offset, sourcePtr + offset, region.width * pixelSize);
+  }
+}
+
+GUI::ErrorCode GUI::Container::mapToErrorCode(IArrayListBase::ErrorCode errorCode)
+{
+  switch (errorCode)
+  {
+    case IArrayListBase::ErrorCode::CONTAINER_FULL_ERROR:
+      return ErrorCode::CONTAINER_FULL_ERROR;
+
+    case IArrayListBase::ErrorCode::OK:
+    case IArrayListBase::ErrorCode::OUT_OF_RANGE_ERROR:
+    case IArrayListBase::ErrorCode::NULL_POINTER_ERROR:
+    default:
+      return ErrorCode::OK;
+  }
+}
+
+DMA2D::InputColorFormat GUI::Container::mapToDMA2DInputColorFormat(IFrameBuffer::ColorFormat colorFormat)
+{
+  switch (colorFormat)
+  {
+    case IFrameBuffer::ColorFormat::ARGB8888:
+      return DMA2D::InputColorFormat::ARGB8888;
+
+    case IFrameBuffer::ColorFormat::RGB565:
+      return DMA2D::InputColorFormat::RGB565;
+
+    case IFrameBuffer::ColorFormat::RGB888:
+    default:
+      return DMA2D::InputColorFormat::RGB888;
+  }
+}
+
+DMA2D::OutputColorFormat GUI::Container::mapToDMA2DOutputColorFormat(IFrameBuffer::ColorFormat colorFormat)
+{
+  switch (colorFormat)
+  {
+    case IFrameBuffer::ColorFormat::ARGB8888:
+      return DMA2D::OutputColorFormat::ARGB8888;
+
+    case IFrameBuffer::ColorFormat::RGB565:
+      return DMA2D::OutputColorFormat::RGB565;
+
+    case IFrameBuffer::ColorFormat::RGB888:
+    default:
+      return DMA2D::OutputColorFormat::RGB888;
+  }
+}
+
+bool GUI::Container::startDrawingOfTheNextObject(void)
+{
+  bool isDrawingStartedSuccessfully = false;
+
+  if (findNextObjectToDraw())
+  {
+    drawCurrentObject(m_drawHardwareInUsage);
+    isDrawingStartedSuccessfully = true;
+  }
+
+  return isDrawingStartedSuccessfully;
+}
+
+bool GUI::Container::enqueueDMA2DDrawCommandsOfRemainingObjects(void)
+{
+  while (findNextObjectToDraw())
+  {
+    IObject *objectPtr = *m_currentDrawingObjectIterator;
+
+    // enqueued command is a copy of the object's DMA2D config, so clipping has to be set before enqueueing
+    objectPtr->setClipRegion(m_currentDrawingClipRegion);
+    const ErrorCode errorCode = objectPtr->enqueueDMA2DDrawCommands();
+    if (ErrorCode::DMA2D_COMMAND_QUEUE_FULL == errorCode)
+    {
+      // the rest is enqueued once the current batch is executed
+      return false;
+    }
+
+    if (ErrorCode::DMA2D_UNSUPPORTED_OPERATION == errorCode)
+    {
+      if (0u != m_dma2dPtr->getNumberOfEnqueuedCommands())
+      {
+        // object is drawn by CPU on top of the already enqueued commands, so they have to be executed first
+        return false;
+      }
+
+      drawObjectWithCPU(objectPtr, m_currentDrawingObjectIterator.getZIndex(), m_currentDrawingClipRegion);
+    }
+    else if (nullptr != m_frameProfilerPtr)
+    {
+      m_frameProfilerPtr->addDMA2DBatchObject(
+        objectPtr,
+        m_currentDrawingObjectIterator.getZIndex(),
+        m_currentDrawingClipRegion.getArea());
+    }
+
+    m_currentDrawingObjectIterator++;
+  }
+
+  return true;
+}
+
+void GUI::Container::drawDMA2DBatches(void)
+{
+  // DMA2D interrupt only signals completion of a batch, so every batch is enqueued here, outside of interrupt
+  while (findNextObjectToDraw())
+  {
+    enqueueDMA2DDrawCommandsOfRemainingObjects();
+    executeDMA2DBatch();
+
+    if (m_isDMA2DBatchExecutionPending ||
+        (not __atomic_exchange_n(&m_isDMA2DBatchCompleted, false, __ATOMIC_SEQ_CST)))
+    {
+      // runtimeTask enqueues the next batch once the current one is completed
+      return;
+    }
+
+    endDMA2DBatchProfiling();
+  }
+
+  endDrawingTransaction();
+  callDrawCompletedCallbackIfRegistered();
+}
+
+void GUI::Container::continueDMA2DDrawing(void)
+{
+  if (m_isDMA2DBatchExecutionPending)
+  {
+    executeDMA2DBatch();
+  }
+
+  if ((not m_isDMA2DBatchExecutionPending) &&
+      __atomic_exchange_n(&m_isDMA2DBatchCompleted, false, __ATOMIC_SEQ_CST))
+  {
+    endDMA2DBatchProfiling();
+
+    if (isTiledRenderingEnabled())
+    {
+      drawTiledDMA2DBatches();
+    }
+    else
+    {
+      drawDMA2DBatches();
+    }
+  }
+}
+
+void GUI::Container::executeDMA2DBatch(void)
+{
+  const DMA2D::ErrorCode errorCode = executeDMA2DCommandQueue(dma2dCommandQueueCompletedCallback);
+
+  // enqueued commands are kept while DMA2D is busy, so runtimeTask executes them once it is released
+  m_isDMA2DBatchExecutionPending = (DMA2D::ErrorCode::OK != errorCode);
+}
+
+DMA2D::ErrorCode GUI::Container::executeDMA2DCommandQueue(void (*queueCompletedCallbackFunctionPtr)(void*))
+{
+  const DMA2D::CallbackDescription commandQueueCompletedCallback =
+  {
+    .functionPtr = queueCompletedCallbackFunctionPtr,
+    .argument    = this
+  };
+
+  if (nullptr != m_frameProfilerPtr)
+  {
+    m_frameProfilerPtr->startDMA2DBatch();
+  }
+
+  return m_dma2dPtr->executeCommandQueue(commandQueueCompletedCallback);
+}
+
+void GUI::Container::endDMA2DBatchProfiling(void)
+{
+  if (nullptr != m_frameProfilerPtr)
+  {
+    m_frameProfilerPtr->endDMA2DBatch();
+  }
+}
+
+void GUI::Container::drawHybridBatches(void)
+{
+  // DMA2D interrupt only signals completion of its part, so every batch is started here, outside of interrupt
+  while (findNextObjectToDraw())
+  {
+    prepareHybridBatch();
+
+    __atomic_store_n(&m_isHybridDMA2DPartCompleted, false, __ATOMIC_SEQ_CST);
+    executeHybridDMA2DPart();
+    drawHybridCPUPart();
+
+    if (not __atomic_exchange_n(&m_isHybridDMA2DPartCompleted, false, __ATOMIC_SEQ_CST))
+    {
+      // runtimeTask starts the next batch once DMA2D part is completed
+      return;
+    }
+  }
+
+  endDrawingTransaction();
+  callDrawCompletedCallbackIfRegistered();
+}
+
+void GUI::Container::continueHybridDrawing(void)
+{
+  if (m_isHybridDMA2DPartExecutionPending)
+  {
+    executeHybridDMA2DPart();
+  }
+
+  if ((not m_isHybridDMA2DPartExecutionPending) &&
+      __atomic_exchange_n(&m_isHybridDMA2DPartCompleted, false, __ATOMIC_SEQ_CST))
+  {
+    drawHybridBatches();
+  }
+}
+
+void GUI::Container::executeHybridDMA2DPart(void)
+{
+  const DMA2D::ErrorCode errorCode = executeDMA2DCommandQueue(dma2dHybridCommandQueueCompletedCallback);
+
+  // enqueued commands are kept while DMA2D is busy, so runtimeTask executes them once it is released
+  m_isHybridDMA2DPartExecutionPending = (DMA2D::ErrorCode::OK != errorCode);
+}
+
+void GUI::Container::prepareHybridBatch(void)
+{
+  m_hybridDMA2DRegionList = ArrayList<Region, DMA2D::COMMAND_QUEUE_CAPACITY>();
+  m_hybridCPUDrawInfoList = ArrayList<HybridCPUDrawInfo, MAX_HYBRID_CPU_OBJECT_COUNT>();
+
+  // objects are visited in z-order, so the batch ends at the first object which depends on the other part
+  while (findNextObjectToDraw())
+  {
+    IObject *objectPtr = *m_currentDrawingObjectIterator;
+    bool isEnqueuedIntoDMA2DPart = false;
+
+    if (HYBRID_DMA2D_MIN_VISIBLE_AREA <= m_currentDrawingClipRegion.getArea())
+    {
+      // DMA2D part runs concurrently with CPU part, so it must not cover objects below it drawn by CPU
+      if (m_hybridDMA2DRegionList.isFull() || doesRegionOverlapHybridCPUPart(m_currentDrawingClipRegion))
+      {
+        break;
+      }
+
+      objectPtr->setClipRegion(m_currentDrawingClipRegion);
+      const ErrorCode errorCode = objectPtr->enqueueDMA2DDrawCommands();
+      if (ErrorCode::DMA2D_COMMAND_QUEUE_FULL == errorCode)
+      {
+        break;
+      }
+
+      isEnqueuedIntoDMA2DPart = (ErrorCode::DMA2D_UNSUPPORTED_OPERATION != errorCode);
+      if (isEnqueuedIntoDMA2DPart)
+      {
+        m_hybridDMA2DRegionList.addElement(m_currentDrawingClipRegion);
+
+        if (nullptr != m_frameProfilerPtr)
+        {
+          m_frameProfilerPtr->addDMA2DBatchObject(
+            objectPtr,
+            m_currentDrawingObjectIterator.getZIndex(),
+            m_currentDrawingClipRegion.getArea());
+        }
+      }
+    }
+
+    if (not isEnqueuedIntoDMA2DPart)
+    {
+      // CPU part runs concurrently with DMA2D part, so it must not touch any pixel written by DMA2D
+      if (m_hybridCPUDrawInfoList.isFull() || doesRegionOverlapHybridDMA2DPart(m_currentDrawingClipRegion))
+      {
+        break;
+      }
+
+      const HybridCPUDrawInfo hybridCPUDrawInfo =
+      {
+        .objectPtr  = objectPtr,
+        .zIndex     = m_currentDrawingObjectIterator.getZIndex(),
+        .clipRegion = m_currentDrawingClipRegion
+      };
+      m_hybridCPUDrawInfoList.addElement(hybridCPUDrawInfo);
+    }
+
+    m_currentDrawingObjectIterator++;
+  }
+}
+
+void GUI::Container::drawHybridCPUPart(void)
+{
+  for (auto it = m_hybridCPUDrawInfoList.getBeginIterator(); it != m_hybridCPUDrawInfoList.getEndIterator(); ++it)
+  {
+    drawObjectWithCPU(it->objectPtr, it->zIndex, it->clipRegion);
+  }
+}
+
+bool GUI::Container::doesRegionOverlapHybridDMA2DPart(const Region &region) const
+{
+  for (auto it = m_hybridDMA2DRegionList.getBeginIterator(); it != m_hybridDMA2DRegionList.getEndIterator(); ++it)
+  {
+    if (region.doesOverlap(*it))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool GUI::Container::doesRegionOverlapHybridCPUPart(const Region &region) const
+{
+  for (auto it = m_hybridCPUDrawInfoList.getBeginIterator(); it != m_hybridCPUDrawInfoList.getEndIterator(); ++it)
+  {
+    if (region.doesOverlap(it->clipRegion))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void GUI::Container::objectDrawingCompletedCallback(void *guiContainerPtr)
+{
+  GUI::Container *containerPtr = reinterpret_cast<GUI::Container*>(guiContainerPtr);
+
+  if (nullptr != containerPtr)
+  {
+    if ((DrawHardware::AUTO == containerPtr->m_drawHardwareInUsage) && (not containerPtr->m_isDrawingCompleted))
+    {
+      if (nullptr != containerPtr->m_frameProfilerPtr)
+      {
+        containerPtr->m_frameProfilerPtr->endObjectDrawing();
+      }
+
+      // callback may come from DMA2D interrupt, so the next object is drawn by drawAutoObjects or runtimeTask
+      __atomic_store_n(&containerPtr->m_isAutoObjectDrawingCompleted, true, __ATOMIC_SEQ_CST);
+    }
+
+    // with command queue, objects drawn with DMA2D are not chained through their draw completed callbacks
+    const bool areObjectsChained =
+      (DrawHardware::DMA2D == containerPtr->m_drawHardwareInUsage) && (nullptr == containerPtr->m_dma2dPtr);
+
+    if (areObjectsChained && (not containerPtr->m_isDrawingCompleted))
+    {
+      if (nullptr != containerPtr->m_frameProfilerPtr)
+      {
+        containerPtr->m_frameProfilerPtr->endObjectDrawing();
+      }
+
+      containerPtr->m_currentDrawingObjectIterator++;
+
+      bool isDrawingStartedSuccessfully = containerPtr->startDrawingOfTheNextObject();
+      if (not isDrawingStartedSuccessfully)
+      {
+        containerPtr->endDrawingTransaction();
+        containerPtr->callDrawCompletedCallbackIfRegistered();
+      }
+    }
+  }
+}
+
+void GUI::Container::dma2dCommandQueueCompletedCallback(void *guiContainerPtr)
+{
+  GUI::Container *containerPtr = reinterpret_cast<GUI::Container*>(guiContainerPtr);
+
+  if (nullptr != containerPtr)
+  {
+    // objects and tiles left to be drawn may need CPU, so they are enqueued from runtimeTask
+    __atomic_store_n(&containerPtr->m_isDMA2DBatchCompleted, true, __ATOMIC_SEQ_CST);
+  }
+}
+
+void GUI::Container::dma2dHybridCommandQueueCompletedCallback(void *guiContainerPtr)
+{
+  GUI::Container *containerPtr = reinterpret_cast<GUI::Container*>(guiContainerPtr);
+
+  if (nullptr != containerPtr)
+  {
+    containerPtr->endDMA2DBatchProfiling();
+
+    __atomic_store_n(&containerPtr->m_isHybridDMA2DPartCompleted, true, __ATOMIC_SEQ_CST);
+  }
+}
+
+void GUI::Container::objectDamagedRegionCallback(void *guiContainerPtr, const Region &region)
+{
+  GUI::Container *containerPtr = reinterpret_cast<GUI::Container*>(guiContainerPtr);
+
+  if (nullptr != containerPtr)
+  {
+    containerPtr->invalidateRegion(region);
+
+    // object has been moved or resized
+    containerPtr->m_isHitTestGridValid = false;
+  }
 }
 
 GUI::Container::Iterator::Iterator(IArrayList<ObjectInfo>::Iterator objectInfoListIterator):
@@ -0,0 +1,128 @@
+#include "GUIDrawCostModel.h"
+
+
+void GUI::DrawCostModel::reset(void)
+{
+  *this = DrawCostModel();
+}
+
+void GUI::DrawCostModel::update(DrawHardware drawHardware, uint64_t visiblePartArea, uint64_t drawingTimeInUs)
+{
+  if (DISTINCT_DRAW_HARDWARE_COUNT <= static_cast<uint8_t>(drawHardware))
+  {
+    return;
+  }
+
+  Statistics &statistics = m_statistics[static_cast<uint8_t>(drawHardware)];
+  const float area        = static_cast<float>(visiblePartArea);
+  const float drawingTime = static_cast<float>(drawingTimeInUs);
+
+  if (0u == statistics.sampleCount)
+  {
+    statistics.meanArea        = area;
+    statistics.meanDrawingTime = drawingTime;
+  }
+  else
+  {
+    const float areaDeviation        = area - statistics.meanArea;
+    const float drawingTimeDeviation = drawingTime - statistics.meanDrawingTime;
+
+    statistics.meanArea        += SMOOTHING_FACTOR * areaDeviation;
+    statistics.meanDrawingTime += SMOOTHING_FACTOR * drawingTimeDeviation;
+    statistics.areaVariance =
+      (1.0f - SMOOTHING_FACTOR) * (statistics.areaVariance + SMOOTHING_FACTOR * areaDeviation * areaDeviation);
+    statistics.areaDrawingTimeCovariance =
+      (1.0f - SMOOTHING_FACTOR) *
+      (statistics.areaDrawingTimeCovariance + SMOOTHING_FACTOR * areaDeviation * drawingTimeDeviation);
+  }
+
+  if (UINT32_MAX != statistics.sampleCount)
+  {
+    ++statistics.sampleCount;
+  }
+}
+
+bool GUI::DrawCostModel::isCalibrated(DrawHardware drawHardware) const
+{
+  const Statistics *statisticsPtr = getStatistics(drawHardware);
+
+  return (nullptr != statisticsPtr) && (0u != statisticsPtr->sampleCount);
+}
+
+float GUI::DrawCostModel::getSetupCostInUs(DrawHardware drawHardware) const
+{
+  const Statistics *statisticsPtr = getStatistics(drawHardware);
+  if (nullptr == statisticsPtr)
+  {
+    return 0.0f;
+  }
+
+  const float setupCost = statisticsPtr->meanDrawingTime - getCostPerPixelInUs(drawHardware) * statisticsPtr->meanArea;
+
+  return (0.0f < setupCost) ? setupCost : 0.0f;
+}
+
+float GUI::DrawCostModel::getCostPerPixelInUs(DrawHardware drawHardware) const
+{
+  const Statistics *statisticsPtr = getStatistics(drawHardware);
+  if ((nullptr == statisticsPtr) || (0.0f >= statisticsPtr->meanArea))
+  {
+    return 0.0f;
+  }
+
+  // without spread of sizes, or with negative fitted setup cost, the whole drawing time is attributed to pixels
+  const float averageCostPerPixel = statisticsPtr->meanDrawingTime / statisticsPtr->meanArea;
+  if (MIN_AREA_VARIANCE > statisticsPtr->areaVariance)
+  {
+    return averageCostPerPixel;
+  }
+
+  const float costPerPixel = statisticsPtr->areaDrawingTimeCovariance / statisticsPtr->areaVariance;
+  if ((0.0f > costPerPixel) || (costPerPixel > averageCostPerPixel))
+  {
+    return averageCostPerPixel;
+  }
+
+  return costPerPixel;
+}
+
+float GUI::DrawCostModel::estimateDrawingTimeInUs(DrawHardware drawHardware, uint64_t visiblePartArea) const
+{
+  return getSetupCostInUs(drawHardware) + getCostPerPixelInUs(drawHardware) * static_cast<float>(visiblePartArea);
+}
+
+GUI::DrawHardware GUI::DrawCostModel::selectDrawHardware(uint64_t visiblePartArea)
+{
+  if (not isCalibrated(DrawHardware::CPU))
+  {
+    return DrawHardware::CPU;
+  }
+
+  if (not isCalibrated(DrawHardware::DMA2D))
+  {
+    return DrawHardware::DMA2D;
+  }
+
+  // on equal cost CPU is preferred, as it does not wait for DMA2D interrupt
+  const DrawHardware cheaperDrawHardware =
+    (estimateDrawingTimeInUs(DrawHardware::DMA2D, visiblePartArea) < estimateDrawingTimeInUs(DrawHardware::CPU, visiblePartArea)) ?
+    DrawHardware::DMA2D : DrawHardware::CPU;
+
+  m_selectionCounter = (m_selectionCounter + 1u) % EXPLORATION_PERIOD;
+  if (0u == m_selectionCounter)
+  {
+    return (DrawHardware::CPU == cheaperDrawHardware) ? DrawHardware::DMA2D : DrawHardware::CPU;
+  }
+
+  return cheaperDrawHardware;
+}
+
+const GUI::DrawCostModel::Statistics* GUI::DrawCostModel::getStatistics(DrawHardware drawHardware) const
+{
+  if (DISTINCT_DRAW_HARDWARE_COUNT <= static_cast<uint8_t>(drawHardware))
+  {
+    return nullptr;
+  }
+
+  return &m_statistics[static_cast<uint8_t>(drawHardware)];
+}
\ No newline at end of file
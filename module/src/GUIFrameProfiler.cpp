@@ -0,0 +1,381 @@
+#include "GUIFrameProfiler.h"
+
+
+GUI::FrameProfiler::FrameProfiler(SysTick &sysTick):
+  m_sysTick(sysTick)
+{
+  reset();
+}
+
+void GUI::FrameProfiler::reset(void)
+{
+  m_isFrameOngoing           = false;
+  m_frameStartTimestamp      = 0u;
+  m_currentFrameProfile      = FrameProfile();
+  m_lastFrameProfile         = FrameProfile();
+  m_frameObjectCount         = 0u;
+  m_ongoingObjectDrawingInfo = ObjectDrawingInfo();
+  m_lastObjectDrawingId      = 0u;
+  m_dma2dBatchStartTimestamp = 0u;
+  m_dma2dBatchObjectCount    = 0u;
+  m_frameHistoryNextIndex    = 0u;
+  m_frameHistorySize         = 0u;
+}
+
+void GUI::FrameProfiler::startFrame(void)
+{
+  m_isFrameOngoing        = true;
+  m_frameStartTimestamp   = getTimestamp();
+  m_currentFrameProfile   = FrameProfile();
+  m_frameObjectCount      = 0u;
+  m_dma2dBatchObjectCount = 0u;
+}
+
+void GUI::FrameProfiler::endFrame(void)
+{
+  if (m_isFrameOngoing)
+  {
+    m_currentFrameProfile.totalTimeInUs = saturateToUint32(m_sysTick.getElapsedTimeInUs(m_frameStartTimestamp));
+
+    selectTopObjects();
+    storeFrameIntoHistory();
+
+    m_lastFrameProfile = m_currentFrameProfile;
+    m_isFrameOngoing   = false;
+  }
+}
+
+bool GUI::FrameProfiler::isFrameOngoing(void) const
+{
+  return m_isFrameOngoing;
+}
+
+void GUI::FrameProfiler::addCPUDrawing(
+  const IObject *objectPtr,
+  uint32_t zIndex,
+  uint64_t startTimestamp,
+  uint32_t pixelCount)
+{
+  if (m_isFrameOngoing)
+  {
+    const uint32_t drawingTimeInUs = saturateToUint32(m_sysTick.getElapsedTimeInUs(startTimestamp));
+
+    m_currentFrameProfile.cpuTimeInUs += drawingTimeInUs;
+    m_currentFrameProfile.pixelCount  += pixelCount;
+
+    const ObjectProfile objectProfile =
+    {
+      .objectPtr       = objectPtr,
+      .zIndex          = zIndex,
+      .drawingTimeInUs = drawingTimeInUs,
+      .pixelCount      = pixelCount
+    };
+    addObjectProfile(objectProfile);
+  }
+}
+
+uint32_t GUI::FrameProfiler::startObjectDrawing(const IObject *objectPtr, uint32_t zIndex, uint32_t pixelCount)
+{
+  // zero marks that no object drawing is ongoing
+  m_lastObjectDrawingId = (UINT32_MAX == m_lastObjectDrawingId) ? 1u : (m_lastObjectDrawingId + 1u);
+
+  m_ongoingObjectDrawingInfo =
+  {
+    .objectProfile =
+    {
+      .objectPtr       = objectPtr,
+      .zIndex          = zIndex,
+      .drawingTimeInUs = 0u,
+      .pixelCount      = pixelCount
+    },
+    .id              = m_lastObjectDrawingId,
+    .startTimestamp  = getTimestamp(),
+    .returnTimestamp = 0u,
+    .isReturned      = false
+  };
+
+  return m_lastObjectDrawingId;
+}
+
+void GUI::FrameProfiler::returnFromObjectDrawing(uint32_t objectDrawingId)
+{
+  // object drawn by CPU is completed before its draw call returns, then there is nothing to wait for
+  if ((0u != m_ongoingObjectDrawingInfo.id) && (objectDrawingId == m_ongoingObjectDrawingInfo.id))
+  {
+    m_ongoingObjectDrawingInfo.returnTimestamp = getTimestamp();
+    m_ongoingObjectDrawingInfo.isReturned      = true;
+  }
+}
+
+void GUI::FrameProfiler::endObjectDrawing(void)
+{
+  if ((0u != m_ongoingObjectDrawingInfo.id) && m_isFrameOngoing)
+  {
+    ObjectProfile &objectProfile = m_ongoingObjectDrawingInfo.objectProfile;
+
+    objectProfile.drawingTimeInUs =
+      saturateToUint32(m_sysTick.getElapsedTimeInUs(m_ongoingObjectDrawingInfo.startTimestamp));
+
+    // after the draw call returns, CPU only waits for DMA2D to complete the drawing
+    const uint32_t waitingTimeInUs = m_ongoingObjectDrawingInfo.isReturned ?
+      saturateToUint32(m_sysTick.getElapsedTimeInUs(m_ongoingObjectDrawingInfo.returnTimestamp)) : 0u;
+
+    m_currentFrameProfile.dma2dTimeInUs += waitingTimeInUs;
+    m_currentFrameProfile.cpuTimeInUs   += objectProfile.drawingTimeInUs - waitingTimeInUs;
+    m_currentFrameProfile.pixelCount    += objectProfile.pixelCount;
+
+    addObjectProfile(objectProfile);
+  }
+
+  m_ongoingObjectDrawingInfo.id = 0u;
+}
+
+void GUI::FrameProfiler::addDMA2DBatchObject(const IObject *objectPtr, uint32_t zIndex, uint32_t pixelCount)
+{
+  if (m_isFrameOngoing && (DMA2D::COMMAND_QUEUE_CAPACITY > m_dma2dBatchObjectCount))
+  {
+    m_dma2dBatchObjectProfiles[m_dma2dBatchObjectCount++] =
+    {
+      .objectPtr       = objectPtr,
+      .zIndex          = zIndex,
+      .drawingTimeInUs = 0u,
+      .pixelCount      = pixelCount
+    };
+  }
+}
+
+void GUI::FrameProfiler::startDMA2DBatch(void)
+{
+  m_dma2dBatchStartTimestamp = getTimestamp();
+}
+
+void GUI::FrameProfiler::endDMA2DBatch(void)
+{
+  if (m_isFrameOngoing)
+  {
+    const uint32_t batchTimeInUs = saturateToUint32(m_sysTick.getElapsedTimeInUs(m_dma2dBatchStartTimestamp));
+    uint64_t batchPixelCount = 0u;
+
+    for (uint32_t i = 0u; i < m_dma2dBatchObjectCount; ++i)
+    {
+      batchPixelCount += m_dma2dBatchObjectProfiles[i].pixelCount;
+    }
+
+    m_currentFrameProfile.dma2dTimeInUs += batchTimeInUs;
+    m_currentFrameProfile.pixelCount    += saturateToUint32(batchPixelCount);
+
+    // DMA2D time of single command is not measurable, batch time is split in proportion to pixel counts
+    for (uint32_t i = 0u; i < m_dma2dBatchObjectCount; ++i)
+    {
+      ObjectProfile &objectProfile = m_dma2dBatchObjectProfiles[i];
+
+      objectProfile.drawingTimeInUs =
+        static_cast<uint32_t>((static_cast<uint64_t>(batchTimeInUs) * objectProfile.pixelCount) / batchPixelCount);
+      addObjectProfile(objectProfile);
+    }
+  }
+
+  m_dma2dBatchObjectCount = 0u;
+}
+
+uint64_t GUI::FrameProfiler::getTimestamp(void) const
+{
+  return m_sysTick.getTicks();
+}
+
+const GUI::FrameProfiler::FrameProfile& GUI::FrameProfiler::getLastFrameProfile(void) const
+{
+  return m_lastFrameProfile;
+}
+
+GUI::FrameProfiler::Statistics GUI::FrameProfiler::getStatistics(Metric metric) const
+{
+  Statistics statistics =
+  {
+    .frameCount = m_frameHistorySize,
+    .min        = 0u,
+    .average    = 0u,
+    .max        = 0u,
+    .p99        = 0u
+  };
+
+  if ((0u == m_frameHistorySize) || (Metric::COUNT <= metric))
+  {
+    return statistics;
+  }
+
+  // history is short and statistics are read only on demand, so insertion sort of its copy is good enough
+  uint32_t sortedValues[FRAME_HISTORY_LENGTH];
+  uint64_t sum = 0u;
+
+  for (uint32_t i = 0u; i < m_frameHistorySize; ++i)
+  {
+    const uint32_t value = m_frameHistory[static_cast<uint8_t>(metric)][i];
+    uint32_t j = i;
+
+    for (; (j > 0u) && (sortedValues[j - 1u] > value); --j)
+    {
+      sortedValues[j] = sortedValues[j - 1u];
+    }
+
+    sortedValues[j] = value;
+    sum += value;
+  }
+
+  // nearest-rank percentile
+  const uint32_t p99Rank = (99u * m_frameHistorySize + 99u) / 100u;
+
+  statistics.min     = sortedValues[0];
+  statistics.average = static_cast<uint32_t>(sum / m_frameHistorySize);
+  statistics.max     = sortedValues[m_frameHistorySize - 1u];
+  statistics.p99     = sortedValues[p99Rank - 1u];
+
+  return statistics;
+}
+
+void GUI::FrameProfiler::dump(USARTLogger &usartLogger, IStringBuilder &stringBuilder) const
+{
+  // line by line, so that a short string builder is enough
+  stringBuilder.reset();
+  stringBuilder.append("frames: ");
+  stringBuilder.append(m_frameHistorySize);
+  stringBuilder.append("\r\n");
+  usartLogger.write(stringBuilder);
+
+  appendStatisticsLine(stringBuilder, "total [us]", Metric::TOTAL_TIME);
+  usartLogger.write(stringBuilder);
+
+  appendStatisticsLine(stringBuilder, "dma2d [us]", Metric::DMA2D_TIME);
+  usartLogger.write(stringBuilder);
+
+  appendStatisticsLine(stringBuilder, "cpu [us]", Metric::CPU_TIME);
+  usartLogger.write(stringBuilder);
+
+  appendStatisticsLine(stringBuilder, "pixels", Metric::PIXEL_COUNT);
+  usartLogger.write(stringBuilder);
+
+  for (uint32_t i = 0u; i < m_lastFrameProfile.topObjectCount; ++i)
+  {
+    appendObjectLine(stringBuilder, i + 1u, m_lastFrameProfile.topObjects[i]);
+    usartLogger.write(stringBuilder);
+  }
+}
+
+void GUI::FrameProfiler::addObjectProfile(const ObjectProfile &objectProfile)
+{
+  // object drawn several times in a frame, e.g. for several damaged regions, is accounted once
+  for (uint32_t i = 0u; i < m_frameObjectCount; ++i)
+  {
+    if ((objectProfile.objectPtr == m_frameObjectProfiles[i].objectPtr) &&
+        (objectProfile.zIndex == m_frameObjectProfiles[i].zIndex))
+    {
+      m_frameObjectProfiles[i].drawingTimeInUs += objectProfile.drawingTimeInUs;
+      m_frameObjectProfiles[i].pixelCount      += objectProfile.pixelCount;
+      return;
+    }
+  }
+
+  if (MAX_FRAME_OBJECT_COUNT > m_frameObjectCount)
+  {
+    m_frameObjectProfiles[m_frameObjectCount++] = objectProfile;
+    return;
+  }
+
+  uint32_t cheapestIndex = 0u;
+  for (uint32_t i = 1u; i < m_frameObjectCount; ++i)
+  {
+    if (m_frameObjectProfiles[i].drawingTimeInUs < m_frameObjectProfiles[cheapestIndex].drawingTimeInUs)
+    {
+      cheapestIndex = i;
+    }
+  }
+
+  if (objectProfile.drawingTimeInUs > m_frameObjectProfiles[cheapestIndex].drawingTimeInUs)
+  {
+    m_frameObjectProfiles[cheapestIndex] = objectProfile;
+  }
+}
+
+void GUI::FrameProfiler::selectTopObjects(void)
+{
+  uint32_t &topObjectCount = m_currentFrameProfile.topObjectCount;
+
+  // insertion into short sorted list, the cheapest object falls out of it
+  topObjectCount = 0u;
+  for (uint32_t i = 0u; i < m_frameObjectCount; ++i)
+  {
+    const ObjectProfile &objectProfile = m_frameObjectProfiles[i];
+    uint32_t j = (TOP_OBJECT_COUNT > topObjectCount) ? topObjectCount++ : TOP_OBJECT_COUNT;
+
+    for (; (j > 0u) && (m_currentFrameProfile.topObjects[j - 1u].drawingTimeInUs < objectProfile.drawingTimeInUs); --j)
+    {
+      if (TOP_OBJECT_COUNT > j)
+      {
+        m_currentFrameProfile.topObjects[j] = m_currentFrameProfile.topObjects[j - 1u];
+      }
+    }
+
+    if (TOP_OBJECT_COUNT > j)
+    {
+      m_currentFrameProfile.topObjects[j] = objectProfile;
+    }
+  }
+}
+
+void GUI::FrameProfiler::storeFrameIntoHistory(void)
+{
+  const uint32_t index = m_frameHistoryNextIndex;
+
+  m_frameHistory[static_cast<uint8_t>(Metric::TOTAL_TIME)][index]  = m_currentFrameProfile.totalTimeInUs;
+  m_frameHistory[static_cast<uint8_t>(Metric::DMA2D_TIME)][index]  = m_currentFrameProfile.dma2dTimeInUs;
+  m_frameHistory[static_cast<uint8_t>(Metric::CPU_TIME)][index]    = m_currentFrameProfile.cpuTimeInUs;
+  m_frameHistory[static_cast<uint8_t>(Metric::PIXEL_COUNT)][index] = m_currentFrameProfile.pixelCount;
+
+  m_frameHistoryNextIndex = (index + 1u) % FRAME_HISTORY_LENGTH;
+  if (FRAME_HISTORY_LENGTH > m_frameHistorySize)
+  {
+    ++m_frameHistorySize;
+  }
+}
+
+void GUI::FrameProfiler::appendStatisticsLine(
+  IStringBuilder &stringBuilder,
+  const char *metricName,
+  Metric metric) const
+{
+  const Statistics statistics = getStatistics(metric);
+
+  stringBuilder.reset();
+  stringBuilder.append(metricName);
+  stringBuilder.append(": min ");
+  stringBuilder.append(statistics.min);
+  stringBuilder.append(" avg ");
+  stringBuilder.append(statistics.average);
+  stringBuilder.append(" max ");
+  stringBuilder.append(statistics.max);
+  stringBuilder.append(" p99 ");
+  stringBuilder.append(statistics.p99);
+  stringBuilder.append("\r\n");
+}
+
+void GUI::FrameProfiler::appendObjectLine(
+  IStringBuilder &stringBuilder,
+  uint32_t rank,
+  const ObjectProfile &objectProfile) const
+{
+  stringBuilder.reset();
+  stringBuilder.append("top ");
+  stringBuilder.append(rank);
+  stringBuilder.append(": z ");
+  stringBuilder.append(objectProfile.zIndex);
+  stringBuilder.append(" ");
+  stringBuilder.append(objectProfile.drawingTimeInUs);
+  stringBuilder.append(" us ");
+  stringBuilder.append(objectProfile.pixelCount);
+  stringBuilder.append(" px\r\n");
+}
+
+uint32_t GUI::FrameProfiler::saturateToUint32(uint64_t value)
+{
+  return (UINT32_MAX < value) ? UINT32_MAX : static_cast<uint32_t>(value);
+}
\ No newline at end of file
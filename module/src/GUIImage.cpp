@@ -1,8 +1,13 @@
 #include "GUIImage.h"
+#include "GUIBlitter.h"
+#include <cstring>
 
 
+GUI::DrawCostModel GUI::Image::s_drawCostModel[DISTINCT_COLOR_FORMAT_COUNT];
+
 GUI::Image::Image(DMA2D &dma2d, SysTick &sysTick, IFrameBuffer &frameBuffer):
   RectangleBase(sysTick, frameBuffer),
+  m_isBitmapOpaque(false),
   m_dma2d(dma2d)
 {}
 
@@ -15,6 +20,7 @@ GUI::ErrorCode GUI::Image::init(const ImageDescription &imageDescription)
 
   RectangleBase::init(imageDescription.baseDescription);
   m_bitmapDescription = imageDescription.bitmapDescription;
+  m_isBitmapOpaque     = isBitmapOpaque(m_bitmapDescription);
   buildCopyBitmapConfig();
   buildBlendBitmapConfig();
 
@@ -31,35 +37,48 @@ void GUI::Image::setFrameBuffer(IFrameBuffer &frameBuffer)
 void GUI::Image::moveToPosition(const Position &position)
 {
   RectangleBase::moveToPosition(position);
+  updateBitmapConfigsVisiblePart();
+}
 
-  const DMA2D::Dimension visiblePartDimension = mapToDMA2DDimension(getVisiblePartDimension());
-  const DMA2D::Position bitmapVisiblePartCopyPosition = mapToDMA2DPosition(getBitmapVisiblePartCopyPosition());
-  const DMA2D::Position imageVisiblePartPosition = mapToDMA2DPosition(getVisiblePartPosition(GUI::Position::Tag::TOP_LEFT_CORNER));
+void GUI::Image::setClipRegion(const Region &clipRegion)
+{
+  RectangleBase::setClipRegion(clipRegion);
+  updateBitmapConfigsVisiblePart();
+}
 
-  m_copyBitmapConfig.dimension                    = visiblePartDimension;
-  m_copyBitmapConfig.sourceRectanglePosition      = bitmapVisiblePartCopyPosition;
-  m_copyBitmapConfig.destinationRectanglePosition = imageVisiblePartPosition;
+void GUI::Image::resetClipRegion(void)
+{
+  RectangleBase::resetClipRegion();
+  updateBitmapConfigsVisiblePart();
+}
 
-  m_blendBitmapConfig.dimension                    = visiblePartDimension;
-  m_blendBitmapConfig.foregroundRectanglePosition  = bitmapVisiblePartCopyPosition;
-  m_blendBitmapConfig.backgroundRectanglePosition  = imageVisiblePartPosition;
-  m_blendBitmapConfig.destinationRectanglePosition = imageVisiblePartPosition;
+bool GUI::Image::isOpaque(void) const
+{
+  return m_isBitmapOpaque;
+}
+
+GUI::DrawCostModel& GUI::Image::getDrawCostModel(void) const
+{
+  return s_drawCostModel[static_cast<uint8_t>(getBitmapColorFormat()) % DISTINCT_COLOR_FORMAT_COUNT];
+}
+
+void GUI::Image::setBitmap(const BitmapDescription &bitmapDescription)
+{
+  m_bitmapDescription = bitmapDescription;
+  m_isBitmapOpaque    = isBitmapOpaque(m_bitmapDescription);
+  buildCopyBitmapConfig();
+  buildBlendBitmapConfig();
+  reportDamagedRegion(getRegion());
 }
 
 GUI::Position GUI::Image::getBitmapVisiblePartCopyPosition(void) const
 {
   const Position topLeftCornerPosition = getPosition(Position::Tag::TOP_LEFT_CORNER);
+  const Position visiblePartTopLeftCornerPosition = getVisiblePartPosition(Position::Tag::TOP_LEFT_CORNER);
   Position visiblePartCopyPosition = m_bitmapDescription.copyPosition;
 
-  if (0 > topLeftCornerPosition.x)
-  {
-    visiblePartCopyPosition.x -= topLeftCornerPosition.x;
-  }
-
-  if (0 > topLeftCornerPosition.y)
-  {
-    visiblePartCopyPosition.y -= topLeftCornerPosition.y;
-  }
+  visiblePartCopyPosition.x += (visiblePartTopLeftCornerPosition.x - topLeftCornerPosition.x);
+  visiblePartCopyPosition.y += (visiblePartTopLeftCornerPosition.y - topLeftCornerPosition.y);
 
   visiblePartCopyPosition.x = saturateValue(
     visiblePartCopyPosition.x,
@@ -79,17 +98,75 @@ void GUI::Image::drawDMA2D(void)
   switch (m_bitmapDescription.colorFormat)
   {
     case ColorFormat::ARGB8888:
-      drawDMA2DFromBitmapARGB8888ToFrameBufferRGB888();
+      drawDMA2DFromBitmapARGB8888();
+      break;
+
+    case ColorFormat::RGB888:
+      drawDMA2DFromBitmapRGB888();
+      break;
+
+    case ColorFormat::L8:
+    case ColorFormat::L4:
+    {
+      if (m_isBitmapOpaque)
+      {
+        m_dma2d.copyBitmap(m_copyBitmapConfig);
+      }
+      else
+      {
+        m_dma2d.blendBitmap(m_blendBitmapConfig);
+      }
+    }
+    break;
+
+    default:
+      // do nothing
+      break;
+  }
+}
+
+GUI::ErrorCode GUI::Image::enqueueDMA2DCommands(void)
+{
+  DMA2D::ErrorCode errorCode = DMA2D::ErrorCode::OK;
+
+  switch (m_bitmapDescription.colorFormat)
+  {
+    case ColorFormat::ARGB8888:
+      errorCode = m_dma2d.enqueueBlendBitmap(m_blendBitmapConfig);
       break;
 
     case ColorFormat::RGB888:
-      drawDMA2DFromBitmapRGB888ToFrameBufferRGB888();
+      errorCode = m_dma2d.enqueueCopyBitmap(m_copyBitmapConfig);
       break;
 
+    case ColorFormat::L8:
+    case ColorFormat::L4:
+    {
+      if (not canBitmapVisiblePartBeReadByDMA2D())
+      {
+        return ErrorCode::DMA2D_UNSUPPORTED_OPERATION;
+      }
+
+      errorCode = m_isBitmapOpaque ?
+        m_dma2d.enqueueCopyBitmap(m_copyBitmapConfig) :
+        m_dma2d.enqueueBlendBitmap(m_blendBitmapConfig);
+    }
+    break;
+
+    case ColorFormat::RLE:
+      return ErrorCode::DMA2D_UNSUPPORTED_OPERATION;
+
     default:
       // do nothing
       break;
   }
+
+  return mapToErrorCode(errorCode);
+}
+
+bool GUI::Image::canBeDrawnByDMA2D(void) const
+{
+  return (ColorFormat::RLE != m_bitmapDescription.colorFormat) && canBitmapVisiblePartBeReadByDMA2D();
 }
 
 void GUI::Image::drawCPU(void)
@@ -97,11 +174,20 @@ void GUI::Image::drawCPU(void)
   switch (m_bitmapDescription.colorFormat)
   {
     case ColorFormat::ARGB8888:
-      drawCPUFromBitmapARGB8888ToFrameBufferRGB888();
+      drawCPUFromBitmapARGB8888();
       break;
 
     case ColorFormat::RGB888:
-      drawCPUFromBitmapRGB888ToFrameBufferRGB888();
+      drawCPUFromBitmapRGB888();
+      break;
+
+    case ColorFormat::L8:
+    case ColorFormat::L4:
+      drawCPUFromBitmapIndexed();
+      break;
+
+    case ColorFormat::RLE:
+      drawCPUFromBitmapRLE();
       break;
 
     default:
@@ -110,16 +196,88 @@ void GUI::Image::drawCPU(void)
   }
 }
 
-void GUI::Image::drawDMA2DFromBitmapRGB888ToFrameBufferRGB888(void)
+void GUI::Image::drawDMA2DFromBitmapRGB888(void)
 {
   m_dma2d.copyBitmap(m_copyBitmapConfig);
 }
 
-void GUI::Image::drawDMA2DFromBitmapARGB8888ToFrameBufferRGB888(void)
+void GUI::Image::drawDMA2DFromBitmapARGB8888(void)
 {
   m_dma2d.blendBitmap(m_blendBitmapConfig);
 }
 
+void GUI::Image::drawCPUFromBitmapRGB888(void)
+{
+  switch (m_frameBufferPtr->getColorFormat())
+  {
+    case IFrameBuffer::ColorFormat::RGB565:
+      drawCPUFromBitmapRGB888ToFrameBufferRGB565();
+      break;
+
+    case IFrameBuffer::ColorFormat::RGB888:
+      drawCPUFromBitmapRGB888ToFrameBufferRGB888();
+      break;
+
+    default:
+      // do nothing
+      break;
+  }
+}
+
+void GUI::Image::drawCPUFromBitmapARGB8888(void)
+{
+  switch (m_frameBufferPtr->getColorFormat())
+  {
+    case IFrameBuffer::ColorFormat::RGB565:
+      drawCPUFromBitmapARGB8888ToFrameBufferRGB565();
+      break;
+
+    case IFrameBuffer::ColorFormat::RGB888:
+      drawCPUFromBitmapARGB8888ToFrameBufferRGB888();
+      break;
+
+    default:
+      // do nothing
+      break;
+  }
+}
+
+void GUI::Image::drawCPUFromBitmapIndexed(void)
+{
+  switch (m_frameBufferPtr->getColorFormat())
+  {
+    case IFrameBuffer::ColorFormat::RGB565:
+      drawCPUFromBitmapIndexedToFrameBufferRGB565();
+      break;
+
+    case IFrameBuffer::ColorFormat::RGB888:
+      drawCPUFromBitmapIndexedToFrameBufferRGB888();
+      break;
+
+    default:
+      // do nothing
+      break;
+  }
+}
+
+void GUI::Image::drawCPUFromBitmapRLE(void)
+{
+  switch (m_frameBufferPtr->getColorFormat())
+  {
+    case IFrameBuffer::ColorFormat::RGB565:
+      drawCPUFromBitmapRLEToFrameBufferRGB565();
+      break;
+
+    case IFrameBuffer::ColorFormat::RGB888:
+      drawCPUFromBitmapRLEToFrameBufferRGB888();
+      break;
+
+    default:
+      // do nothing
+      break;
+  }
+}
+
 void GUI::Image::drawCPUFromBitmapRGB888ToFrameBufferRGB888(void)
 {
   constexpr uint32_t PIXEL_SIZE = 3u;
@@ -128,33 +286,126 @@ void GUI::Image::drawCPUFromBitmapRGB888ToFrameBufferRGB888(void)
   const Position fbuffEndPosition   = getVisiblePartPosition(Position::Tag::BOTTOM_RIGHT_CORNER);
   const uint32_t fbuffRowWidth          = PIXEL_SIZE * m_frameBufferPtr->getWidth();
   const uint32_t fbuffColumnStartOffset = PIXEL_SIZE * fbuffStartPosition.x;
-  const uint32_t fbuffColumnEndOffset   = PIXEL_SIZE * fbuffEndPosition.x;
-  uint8_t *frameBufferPtr = reinterpret_cast<uint8_t*>(m_frameBufferPtr->getPointer());
+  const uint32_t numberOfPixelsInRow    = fbuffEndPosition.x - fbuffStartPosition.x + 1u;
+  uint8_t *fbuffRowPtr = reinterpret_cast<uint8_t*>(m_frameBufferPtr->getPointer()) +
+    fbuffStartPosition.y * fbuffRowWidth + fbuffColumnStartOffset;
 
   const Position bitmapCopyPosition      = getBitmapVisiblePartCopyPosition();
   const uint32_t bitmapRowWidth          = PIXEL_SIZE * m_bitmapDescription.dimension.width;
   const uint32_t bitmapColumnStartOffset = PIXEL_SIZE * bitmapCopyPosition.x;
+  const uint8_t *bitmapRowPtr = reinterpret_cast<const uint8_t*>(m_bitmapDescription.bitmapPtr) +
+    bitmapCopyPosition.y * bitmapRowWidth + bitmapColumnStartOffset;
+
+  for (int32_t fbuffRowIdx = fbuffStartPosition.y; fbuffRowIdx <= fbuffEndPosition.y; ++fbuffRowIdx)
+  {
+    Blitter::copyRowRGB888(fbuffRowPtr, bitmapRowPtr, numberOfPixelsInRow);
+    fbuffRowPtr  += fbuffRowWidth;
+    bitmapRowPtr += bitmapRowWidth;
+  }
+}
+
+void GUI::Image::drawCPUFromBitmapARGB8888ToFrameBufferRGB888(void)
+{
+  constexpr uint32_t FRAME_BUFFER_PIXEL_SIZE = 3u;
+  constexpr uint32_t BITMAP_PIXEL_SIZE       = 4u;
+
+  const Position fbuffStartPosition = getVisiblePartPosition(Position::Tag::TOP_LEFT_CORNER);
+  const Position fbuffEndPosition   = getVisiblePartPosition(Position::Tag::BOTTOM_RIGHT_CORNER);
+  const uint32_t fbuffRowWidth          = FRAME_BUFFER_PIXEL_SIZE * m_frameBufferPtr->getWidth();
+  const uint32_t fbuffColumnStartOffset = FRAME_BUFFER_PIXEL_SIZE * fbuffStartPosition.x;
+  const uint32_t numberOfPixelsInRow    = fbuffEndPosition.x - fbuffStartPosition.x + 1u;
+  uint8_t *fbuffRowPtr = reinterpret_cast<uint8_t*>(m_frameBufferPtr->getPointer()) +
+    fbuffStartPosition.y * fbuffRowWidth + fbuffColumnStartOffset;
+
+  const Position bitmapCopyPosition      = getBitmapVisiblePartCopyPosition();
+  const uint32_t bitmapRowWidth          = BITMAP_PIXEL_SIZE * m_bitmapDescription.dimension.width;
+  const uint32_t bitmapColumnStartOffset = BITMAP_PIXEL_SIZE * bitmapCopyPosition.x;
+  const uint8_t *bitmapRowPtr = reinterpret_cast<const uint8_t*>(m_bitmapDescription.bitmapPtr) +
+    bitmapCopyPosition.y * bitmapRowWidth + bitmapColumnStartOffset;
+
+  for (int32_t fbuffRowIdx = fbuffStartPosition.y; fbuffRowIdx <= fbuffEndPosition.y; ++fbuffRowIdx)
+  {
+    Blitter::blendRowARGB8888ToRGB888(fbuffRowPtr, bitmapRowPtr, numberOfPixelsInRow);
+    fbuffRowPtr  += fbuffRowWidth;
+    bitmapRowPtr += bitmapRowWidth;
+  }
+}
+
+void GUI::Image::drawCPUFromBitmapRGB888ToFrameBufferRGB565(void)
+{
+  constexpr uint32_t BITMAP_PIXEL_SIZE = 3u;
+
+  const Position fbuffStartPosition = getVisiblePartPosition(Position::Tag::TOP_LEFT_CORNER);
+  const Position fbuffEndPosition   = getVisiblePartPosition(Position::Tag::BOTTOM_RIGHT_CORNER);
+  const uint32_t fbuffRowWidth      = m_frameBufferPtr->getWidth();
+  uint16_t *frameBufferPtr = reinterpret_cast<uint16_t*>(m_frameBufferPtr->getPointer());
+
+  const Position bitmapCopyPosition      = getBitmapVisiblePartCopyPosition();
+  const uint32_t bitmapRowWidth          = BITMAP_PIXEL_SIZE * m_bitmapDescription.dimension.width;
+  const uint32_t bitmapColumnStartOffset = BITMAP_PIXEL_SIZE * bitmapCopyPosition.x;
   const uint8_t *bitmapPtr = reinterpret_cast<const uint8_t*>(m_bitmapDescription.bitmapPtr);
 
   uint16_t bitmapRowIdx = bitmapCopyPosition.y;
   for (uint16_t fbuffRowIdx = fbuffStartPosition.y; fbuffRowIdx <= fbuffEndPosition.y; ++fbuffRowIdx, ++bitmapRowIdx)
   {
-    const uint32_t fbuffColumnStartIdx = fbuffRowIdx * fbuffRowWidth + fbuffColumnStartOffset;
-    const uint32_t fbuffColumnEndIdx   = fbuffRowIdx * fbuffRowWidth + fbuffColumnEndOffset;
+    const uint32_t fbuffColumnStartIdx = fbuffRowIdx * fbuffRowWidth + fbuffStartPosition.x;
+    const uint32_t fbuffColumnEndIdx   = fbuffRowIdx * fbuffRowWidth + fbuffEndPosition.x;
     uint32_t bitmapColumnIdx = bitmapRowIdx * bitmapRowWidth + bitmapColumnStartOffset;
-    for (uint32_t fbuffColumnIdx = fbuffColumnStartIdx; fbuffColumnIdx <= fbuffColumnEndIdx;)
+    for (uint32_t fbuffColumnIdx = fbuffColumnStartIdx; fbuffColumnIdx <= fbuffColumnEndIdx; ++fbuffColumnIdx)
     {
-      frameBufferPtr[fbuffColumnIdx++] = bitmapPtr[bitmapColumnIdx++];
-      frameBufferPtr[fbuffColumnIdx++] = bitmapPtr[bitmapColumnIdx++];
-      frameBufferPtr[fbuffColumnIdx++] = bitmapPtr[bitmapColumnIdx++];
+      const Color color =
+      {
+        .red   = bitmapPtr[bitmapColumnIdx + 2u],
+        .green = bitmapPtr[bitmapColumnIdx + 1u],
+        .blue  = bitmapPtr[bitmapColumnIdx]
+      };
+
+      frameBufferPtr[fbuffColumnIdx] = color.toRGB565();
+      bitmapColumnIdx += BITMAP_PIXEL_SIZE;
     }
   }
 }
 
-void GUI::Image::drawCPUFromBitmapARGB8888ToFrameBufferRGB888(void)
+void GUI::Image::drawCPUFromBitmapARGB8888ToFrameBufferRGB565(void)
+{
+  constexpr uint32_t BITMAP_PIXEL_SIZE = 4u;
+
+  const Position fbuffStartPosition = getVisiblePartPosition(Position::Tag::TOP_LEFT_CORNER);
+  const Position fbuffEndPosition   = getVisiblePartPosition(Position::Tag::BOTTOM_RIGHT_CORNER);
+  const uint32_t fbuffRowWidth      = m_frameBufferPtr->getWidth();
+  uint16_t *frameBufferPtr = reinterpret_cast<uint16_t*>(m_frameBufferPtr->getPointer());
+
+  const Position bitmapCopyPosition      = getBitmapVisiblePartCopyPosition();
+  const uint32_t bitmapRowWidth          = BITMAP_PIXEL_SIZE * m_bitmapDescription.dimension.width;
+  const uint32_t bitmapColumnStartOffset = BITMAP_PIXEL_SIZE * bitmapCopyPosition.x;
+  const uint8_t *bitmapPtr = reinterpret_cast<const uint8_t*>(m_bitmapDescription.bitmapPtr);
+
+  uint16_t bitmapRowIdx = bitmapCopyPosition.y;
+  for (uint16_t fbuffRowIdx = fbuffStartPosition.y; fbuffRowIdx <= fbuffEndPosition.y; ++fbuffRowIdx, ++bitmapRowIdx)
+  {
+    const uint32_t fbuffColumnStartIdx = fbuffRowIdx * fbuffRowWidth + fbuffStartPosition.x;
+    const uint32_t fbuffColumnEndIdx   = fbuffRowIdx * fbuffRowWidth + fbuffEndPosition.x;
+    uint32_t bitmapColumnIdx = bitmapRowIdx * bitmapRowWidth + bitmapColumnStartOffset;
+    for (uint32_t fbuffColumnIdx = fbuffColumnStartIdx; fbuffColumnIdx <= fbuffColumnEndIdx; ++fbuffColumnIdx)
+    {
+      const uint32_t alpha = bitmapPtr[bitmapColumnIdx + 3u];
+      const Color background = Color::fromRGB565(frameBufferPtr[fbuffColumnIdx]);
+      const Color color =
+      {
+        .red   = static_cast<uint8_t>((alpha * bitmapPtr[bitmapColumnIdx + 2u] + (255u - alpha) * background.red) / 255u),
+        .green = static_cast<uint8_t>((alpha * bitmapPtr[bitmapColumnIdx + 1u] + (255u - alpha) * background.green) / 255u),
+        .blue  = static_cast<uint8_t>((alpha * bitmapPtr[bitmapColumnIdx] + (255u - alpha) * background.blue) / 255u)
+      };
+
+      frameBufferPtr[fbuffColumnIdx] = color.toRGB565();
+      bitmapColumnIdx += BITMAP_PIXEL_SIZE;
+    }
+  }
+}
+
+void GUI::Image::drawCPUFromBitmapIndexedToFrameBufferRGB888(void)
 {
   constexpr uint32_t FRAME_BUFFER_PIXEL_SIZE = 3u;
-  constexpr uint32_t BITMAP_PIXEL_SIZE       = 4u;
 
   const Position fbuffStartPosition = getVisiblePartPosition(Position::Tag::TOP_LEFT_CORNER);
   const Position fbuffEndPosition   = getVisiblePartPosition(Position::Tag::BOTTOM_RIGHT_CORNER);
@@ -163,37 +414,244 @@ void GUI::Image::drawCPUFromBitmapARGB8888ToFrameBufferRGB888(void)
   const uint32_t fbuffColumnEndOffset   = FRAME_BUFFER_PIXEL_SIZE * fbuffEndPosition.x;
   uint8_t *frameBufferPtr = reinterpret_cast<uint8_t*>(m_frameBufferPtr->getPointer());
 
-  const Position bitmapCopyPosition      = getBitmapVisiblePartCopyPosition();
-  const uint32_t bitmapRowWidth          = BITMAP_PIXEL_SIZE * m_bitmapDescription.dimension.width;
-  const uint32_t bitmapColumnStartOffset = BITMAP_PIXEL_SIZE * bitmapCopyPosition.x;
-  const uint8_t *bitmapPtr = reinterpret_cast<const uint8_t*>(m_bitmapDescription.bitmapPtr);
+  const Position bitmapCopyPosition = getBitmapVisiblePartCopyPosition();
+  const uint32_t bitmapRowWidth     = m_bitmapDescription.dimension.width;
+  const uint32_t *clutPtr           = m_bitmapDescription.clutPtr;
 
   uint16_t bitmapRowIdx = bitmapCopyPosition.y;
   for (uint16_t fbuffRowIdx = fbuffStartPosition.y; fbuffRowIdx <= fbuffEndPosition.y; ++fbuffRowIdx, ++bitmapRowIdx)
   {
     const uint32_t fbuffColumnStartIdx = fbuffRowIdx * fbuffRowWidth + fbuffColumnStartOffset;
     const uint32_t fbuffColumnEndIdx   = fbuffRowIdx * fbuffRowWidth + fbuffColumnEndOffset;
-    uint32_t bitmapColumnIdx = bitmapRowIdx * bitmapRowWidth + bitmapColumnStartOffset;
-    for (uint32_t fbuffColumnIdx = fbuffColumnStartIdx; fbuffColumnIdx <= fbuffColumnEndIdx;)
+    uint32_t bitmapPixelIdx = bitmapRowIdx * bitmapRowWidth + bitmapCopyPosition.x;
+    for (uint32_t fbuffColumnIdx = fbuffColumnStartIdx; fbuffColumnIdx <= fbuffColumnEndIdx; ++bitmapPixelIdx)
     {
-      const uint32_t alpha = bitmapPtr[bitmapColumnIdx + 3];
+      const uint32_t color = clutPtr[getBitmapColorIndex(bitmapPixelIdx)];
+      const uint32_t alpha = (color >> 24u) & 0xFFu;
 
-      frameBufferPtr[fbuffColumnIdx] = (alpha * bitmapPtr[bitmapColumnIdx++] + (255u - alpha) * frameBufferPtr[fbuffColumnIdx]) / 255u;
+      frameBufferPtr[fbuffColumnIdx] = (alpha * (color & 0xFFu) + (255u - alpha) * frameBufferPtr[fbuffColumnIdx]) / 255u;
       ++fbuffColumnIdx;
-      frameBufferPtr[fbuffColumnIdx] = (alpha * bitmapPtr[bitmapColumnIdx++] + (255u - alpha) * frameBufferPtr[fbuffColumnIdx]) / 255u;
+      frameBufferPtr[fbuffColumnIdx] = (alpha * ((color >> 8u) & 0xFFu) + (255u - alpha) * frameBufferPtr[fbuffColumnIdx]) / 255u;
       ++fbuffColumnIdx;
-      frameBufferPtr[fbuffColumnIdx] = (alpha * bitmapPtr[bitmapColumnIdx++] + (255u - alpha) * frameBufferPtr[fbuffColumnIdx]) / 255u;
+      frameBufferPtr[fbuffColumnIdx] = (alpha * ((color >> 16u) & 0xFFu) + (255u - alpha) * frameBufferPtr[fbuffColumnIdx]) / 255u;
       ++fbuffColumnIdx;
+    }
+  }
+}
+
+void GUI::Image::drawCPUFromBitmapIndexedToFrameBufferRGB565(void)
+{
+  const Position fbuffStartPosition = getVisiblePartPosition(Position::Tag::TOP_LEFT_CORNER);
+  const Position fbuffEndPosition   = getVisiblePartPosition(Position::Tag::BOTTOM_RIGHT_CORNER);
+  const uint32_t fbuffRowWidth      = m_frameBufferPtr->getWidth();
+  uint16_t *frameBufferPtr = reinterpret_cast<uint16_t*>(m_frameBufferPtr->getPointer());
+
+  const Position bitmapCopyPosition = getBitmapVisiblePartCopyPosition();
+  const uint32_t bitmapRowWidth     = m_bitmapDescription.dimension.width;
+  const uint32_t *clutPtr           = m_bitmapDescription.clutPtr;
+
+  uint16_t bitmapRowIdx = bitmapCopyPosition.y;
+  for (uint16_t fbuffRowIdx = fbuffStartPosition.y; fbuffRowIdx <= fbuffEndPosition.y; ++fbuffRowIdx, ++bitmapRowIdx)
+  {
+    const uint32_t fbuffColumnStartIdx = fbuffRowIdx * fbuffRowWidth + fbuffStartPosition.x;
+    const uint32_t fbuffColumnEndIdx   = fbuffRowIdx * fbuffRowWidth + fbuffEndPosition.x;
+    uint32_t bitmapPixelIdx = bitmapRowIdx * bitmapRowWidth + bitmapCopyPosition.x;
+    for (uint32_t fbuffColumnIdx = fbuffColumnStartIdx; fbuffColumnIdx <= fbuffColumnEndIdx; ++fbuffColumnIdx, ++bitmapPixelIdx)
+    {
+      const uint32_t clutColor = clutPtr[getBitmapColorIndex(bitmapPixelIdx)];
+      const uint32_t alpha = (clutColor >> 24u) & 0xFFu;
+      const Color background = Color::fromRGB565(frameBufferPtr[fbuffColumnIdx]);
+      const Color color =
+      {
+        .red   = static_cast<uint8_t>((alpha * ((clutColor >> 16u) & 0xFFu) + (255u - alpha) * background.red) / 255u),
+        .green = static_cast<uint8_t>((alpha * ((clutColor >> 8u) & 0xFFu) + (255u - alpha) * background.green) / 255u),
+        .blue  = static_cast<uint8_t>((alpha * (clutColor & 0xFFu) + (255u - alpha) * background.blue) / 255u)
+      };
+
+      frameBufferPtr[fbuffColumnIdx] = color.toRGB565();
+    }
+  }
+}
+
+void GUI::Image::drawCPUFromBitmapRLEToFrameBufferRGB888(void)
+{
+  constexpr uint32_t FRAME_BUFFER_PIXEL_SIZE = 3u;
+
+  const Position fbuffStartPosition = getVisiblePartPosition(Position::Tag::TOP_LEFT_CORNER);
+  const Position fbuffEndPosition   = getVisiblePartPosition(Position::Tag::BOTTOM_RIGHT_CORNER);
+  const uint32_t fbuffRowWidth      = m_frameBufferPtr->getWidth();
+  uint8_t *frameBufferPtr = reinterpret_cast<uint8_t*>(m_frameBufferPtr->getPointer());
+
+  const Position bitmapCopyPosition = getBitmapVisiblePartCopyPosition();
+  const uint16_t bitmapWidth        = m_bitmapDescription.dimension.width;
+  const int32_t bitmapColumnStart   = bitmapCopyPosition.x;
+  const int32_t bitmapColumnEnd     = bitmapColumnStart + (fbuffEndPosition.x - fbuffStartPosition.x);
+  const int32_t fbuffColumnOffset   = fbuffStartPosition.x - bitmapColumnStart;
+  const uint8_t *rlePtr = skipRLEBitmapRows(
+    reinterpret_cast<const uint8_t*>(m_bitmapDescription.bitmapPtr),
+    bitmapCopyPosition.y);
+
+  for (uint16_t fbuffRowIdx = fbuffStartPosition.y; fbuffRowIdx <= fbuffEndPosition.y; ++fbuffRowIdx)
+  {
+    const int32_t fbuffRowStartIdx = fbuffRowIdx * fbuffRowWidth + fbuffColumnOffset;
+    int32_t bitmapColumnIdx = 0;
+    while (bitmapColumnIdx < bitmapWidth)
+    {
+      const RLERunType runType   = getRLERunType(*rlePtr);
+      const uint16_t runLength   = getRLERunLength(*rlePtr);
+      const uint8_t runPixelSize = getRLERunPixelSize(runType);
+      const uint8_t *runPixelsPtr = rlePtr + 1u;
+      const int32_t runVisibleStart = (bitmapColumnIdx > bitmapColumnStart) ? bitmapColumnIdx : bitmapColumnStart;
+      const int32_t runEnd          = bitmapColumnIdx + runLength - 1;
+      const int32_t runVisibleEnd   = (runEnd < bitmapColumnEnd) ? runEnd : bitmapColumnEnd;
+
+      if ((RLERunType::OPAQUE == runType) && (runVisibleStart <= runVisibleEnd))
+      {
+        std::memcpy(&frameBufferPtr[FRAME_BUFFER_PIXEL_SIZE * (fbuffRowStartIdx + runVisibleStart)],
+          &runPixelsPtr[runPixelSize * (runVisibleStart - bitmapColumnIdx)],
+          FRAME_BUFFER_PIXEL_SIZE * (runVisibleEnd - runVisibleStart + 1));
+      }
+      else if (RLERunType::BLENDED == runType)
+      {
+        for (int32_t columnIdx = runVisibleStart; columnIdx <= runVisibleEnd; ++columnIdx)
+        {
+          const uint8_t *pixelPtr = &runPixelsPtr[runPixelSize * (columnIdx - bitmapColumnIdx)];
+          uint8_t *fbuffPixelPtr  = &frameBufferPtr[FRAME_BUFFER_PIXEL_SIZE * (fbuffRowStartIdx + columnIdx)];
+          const uint32_t alpha    = pixelPtr[3];
+
+          fbuffPixelPtr[0] = (alpha * pixelPtr[0] + (255u - alpha) * fbuffPixelPtr[0]) / 255u;
+          fbuffPixelPtr[1] = (alpha * pixelPtr[1] + (255u - alpha) * fbuffPixelPtr[1]) / 255u;
+          fbuffPixelPtr[2] = (alpha * pixelPtr[2] + (255u - alpha) * fbuffPixelPtr[2]) / 255u;
+        }
+      }
+
+      rlePtr = runPixelsPtr + runPixelSize * runLength;
+      bitmapColumnIdx += runLength;
+    }
+  }
+}
 
-      // skip alpha
-      ++bitmapColumnIdx;
+void GUI::Image::drawCPUFromBitmapRLEToFrameBufferRGB565(void)
+{
+  const Position fbuffStartPosition = getVisiblePartPosition(Position::Tag::TOP_LEFT_CORNER);
+  const Position fbuffEndPosition   = getVisiblePartPosition(Position::Tag::BOTTOM_RIGHT_CORNER);
+  const uint32_t fbuffRowWidth      = m_frameBufferPtr->getWidth();
+  uint16_t *frameBufferPtr = reinterpret_cast<uint16_t*>(m_frameBufferPtr->getPointer());
+
+  const Position bitmapCopyPosition = getBitmapVisiblePartCopyPosition();
+  const uint16_t bitmapWidth        = m_bitmapDescription.dimension.width;
+  const int32_t bitmapColumnStart   = bitmapCopyPosition.x;
+  const int32_t bitmapColumnEnd     = bitmapColumnStart + (fbuffEndPosition.x - fbuffStartPosition.x);
+  const int32_t fbuffColumnOffset   = fbuffStartPosition.x - bitmapColumnStart;
+  const uint8_t *rlePtr = skipRLEBitmapRows(
+    reinterpret_cast<const uint8_t*>(m_bitmapDescription.bitmapPtr),
+    bitmapCopyPosition.y);
+
+  for (uint16_t fbuffRowIdx = fbuffStartPosition.y; fbuffRowIdx <= fbuffEndPosition.y; ++fbuffRowIdx)
+  {
+    const int32_t fbuffRowStartIdx = fbuffRowIdx * fbuffRowWidth + fbuffColumnOffset;
+    int32_t bitmapColumnIdx = 0;
+    while (bitmapColumnIdx < bitmapWidth)
+    {
+      const RLERunType runType   = getRLERunType(*rlePtr);
+      const uint16_t runLength   = getRLERunLength(*rlePtr);
+      const uint8_t runPixelSize = getRLERunPixelSize(runType);
+      const uint8_t *runPixelsPtr = rlePtr + 1u;
+      const int32_t runVisibleStart = (bitmapColumnIdx > bitmapColumnStart) ? bitmapColumnIdx : bitmapColumnStart;
+      const int32_t runEnd          = bitmapColumnIdx + runLength - 1;
+      const int32_t runVisibleEnd   = (runEnd < bitmapColumnEnd) ? runEnd : bitmapColumnEnd;
+
+      if (RLERunType::TRANSPARENT != runType)
+      {
+        for (int32_t columnIdx = runVisibleStart; columnIdx <= runVisibleEnd; ++columnIdx)
+        {
+          const uint8_t *pixelPtr = &runPixelsPtr[runPixelSize * (columnIdx - bitmapColumnIdx)];
+          uint16_t &fbuffPixel    = frameBufferPtr[fbuffRowStartIdx + columnIdx];
+          Color color =
+          {
+            .red   = pixelPtr[2],
+            .green = pixelPtr[1],
+            .blue  = pixelPtr[0]
+          };
+
+          if (RLERunType::BLENDED == runType)
+          {
+            const uint32_t alpha = pixelPtr[3];
+            const Color background = Color::fromRGB565(fbuffPixel);
+            color.red   = static_cast<uint8_t>((alpha * color.red + (255u - alpha) * background.red) / 255u);
+            color.green = static_cast<uint8_t>((alpha * color.green + (255u - alpha) * background.green) / 255u);
+            color.blue  = static_cast<uint8_t>((alpha * color.blue + (255u - alpha) * background.blue) / 255u);
+          }
+
+          fbuffPixel = color.toRGB565();
+        }
+      }
+
+      rlePtr = runPixelsPtr + runPixelSize * runLength;
+      bitmapColumnIdx += runLength;
     }
   }
 }
 
+const uint8_t* GUI::Image::skipRLEBitmapRows(const uint8_t *rlePtr, uint16_t numberOfRows) const
+{
+  for (uint16_t rowIdx = 0u; rowIdx < numberOfRows; ++rowIdx)
+  {
+    uint16_t bitmapColumnIdx = 0u;
+    while (bitmapColumnIdx < m_bitmapDescription.dimension.width)
+    {
+      const uint16_t runLength = getRLERunLength(*rlePtr);
+      rlePtr += 1u + getRLERunPixelSize(getRLERunType(*rlePtr)) * runLength;
+      bitmapColumnIdx += runLength;
+    }
+  }
+
+  return rlePtr;
+}
+
+inline GUI::Image::RLERunType GUI::Image::getRLERunType(uint8_t runHeader)
+{
+  return static_cast<RLERunType>(runHeader >> 6u);
+}
+
+inline uint16_t GUI::Image::getRLERunLength(uint8_t runHeader)
+{
+  return static_cast<uint16_t>(runHeader & 0x3Fu) + 1u;
+}
+
+inline uint8_t GUI::Image::getRLERunPixelSize(RLERunType runType)
+{
+  switch (runType)
+  {
+    case RLERunType::OPAQUE:
+      return 3u;
+
+    case RLERunType::BLENDED:
+      return 4u;
+
+    case RLERunType::TRANSPARENT:
+    default:
+      return 0u;
+  }
+}
+
+inline uint8_t GUI::Image::getBitmapColorIndex(uint32_t pixelIdx) const
+{
+  const uint8_t *bitmapPtr = reinterpret_cast<const uint8_t*>(m_bitmapDescription.bitmapPtr);
+
+  if (ColorFormat::L4 == m_bitmapDescription.colorFormat)
+  {
+    const uint8_t colorIndexes = bitmapPtr[pixelIdx / 2u];
+    return (0u == (pixelIdx % 2u)) ? (colorIndexes & 0x0Fu) : (colorIndexes >> 4u);
+  }
+
+  return bitmapPtr[pixelIdx];
+}
+
 inline bool GUI::Image::isFrameBufferColorFormatSupported(void) const
 {
-  return (IFrameBuffer::ColorFormat::RGB888 == m_frameBufferPtr->getColorFormat());
+  return (IFrameBuffer::ColorFormat::RGB888 == m_frameBufferPtr->getColorFormat()) ||
+         (IFrameBuffer::ColorFormat::RGB565 == m_frameBufferPtr->getColorFormat());
 }
 
 bool GUI::Image::isImageVisibleOnTheScreen(void) const
@@ -211,14 +669,15 @@ void GUI::Image::buildCopyBitmapConfig(void)
     .sourceRectanglePosition = mapToDMA2DPosition(getBitmapVisiblePartCopyPosition()),
     .sourceBufferConfig =
     {
-      .colorFormat     = DMA2D::InputColorFormat::RGB888,
+      .colorFormat     = mapToDMA2DInputColorFormat(m_bitmapDescription.colorFormat),
       .bufferDimension = mapToDMA2DDimension(m_bitmapDescription.dimension),
-      .bufferPtr       = m_bitmapDescription.bitmapPtr
+      .bufferPtr       = m_bitmapDescription.bitmapPtr,
+      .clutConfig      = buildCLUTConfig(m_bitmapDescription)
     },
     .destinationRectanglePosition = mapToDMA2DPosition(getVisiblePartPosition(GUI::Position::Tag::TOP_LEFT_CORNER)),
     .destinationBufferConfig =
     {
-      .colorFormat     = DMA2D::OutputColorFormat::RGB888,
+      .colorFormat     = mapToDMA2DOutputColorFormat(m_frameBufferPtr->getColorFormat()),
       .bufferDimension = mapToDMA2DDimension(m_frameBufferPtr->getDimension()),
       .bufferPtr       = m_frameBufferPtr->getPointer()
     },
@@ -238,21 +697,22 @@ void GUI::Image::buildBlendBitmapConfig(void)
     .foregroundRectanglePosition = mapToDMA2DPosition(getBitmapVisiblePartCopyPosition()),
     .foregroundBufferConfig =
     {
-      .colorFormat     = DMA2D::InputColorFormat::ARGB8888,
+      .colorFormat     = mapToDMA2DInputColorFormat(m_bitmapDescription.colorFormat),
       .bufferDimension = mapToDMA2DDimension(m_bitmapDescription.dimension),
-      .bufferPtr       = m_bitmapDescription.bitmapPtr
+      .bufferPtr       = m_bitmapDescription.bitmapPtr,
+      .clutConfig      = buildCLUTConfig(m_bitmapDescription)
     },
     .backgroundRectanglePosition = mapToDMA2DPosition(getVisiblePartPosition(GUI::Position::Tag::TOP_LEFT_CORNER)),
     .backgroundBufferConfig =
     {
-      .colorFormat     = DMA2D::InputColorFormat::RGB888,
+      .colorFormat     = mapToDMA2DInputColorFormat(m_frameBufferPtr->getColorFormat()),
       .bufferDimension = mapToDMA2DDimension(m_frameBufferPtr->getDimension()),
       .bufferPtr       = m_frameBufferPtr->getPointer()
     },
     .destinationRectanglePosition = mapToDMA2DPosition(getVisiblePartPosition(GUI::Position::Tag::TOP_LEFT_CORNER)),
     .destinationBufferConfig =
     {
-      .colorFormat     = DMA2D::OutputColorFormat::RGB888,
+      .colorFormat     = mapToDMA2DOutputColorFormat(m_frameBufferPtr->getColorFormat()),
       .bufferDimension = mapToDMA2DDimension(m_frameBufferPtr->getDimension()),
       .bufferPtr       = m_frameBufferPtr->getPointer()
     },
@@ -264,6 +724,69 @@ void GUI::Image::buildBlendBitmapConfig(void)
   };
 }
 
+bool GUI::Image::canBitmapVisiblePartBeReadByDMA2D(void) const
+{
+  // L4 start address and line offset can not point into the middle of a byte
+  if (ColorFormat::L4 == m_bitmapDescription.colorFormat)
+  {
+    const uint32_t visiblePartWidth = m_copyBitmapConfig.dimension.width;
+    const uint32_t lineOffset       = m_bitmapDescription.dimension.width - visiblePartWidth;
+
+    return 0u == ((m_copyBitmapConfig.sourceRectanglePosition.x | visiblePartWidth | lineOffset) & 0x1u);
+  }
+
+  return true;
+}
+
+void GUI::Image::updateBitmapConfigsVisiblePart(void)
+{
+  const DMA2D::Dimension visiblePartDimension = mapToDMA2DDimension(getVisiblePartDimension());
+  const DMA2D::Position bitmapVisiblePartCopyPosition = mapToDMA2DPosition(getBitmapVisiblePartCopyPosition());
+  const DMA2D::Position imageVisiblePartPosition = mapToDMA2DPosition(getVisiblePartPosition(GUI::Position::Tag::TOP_LEFT_CORNER));
+
+  m_copyBitmapConfig.dimension                    = visiblePartDimension;
+  m_copyBitmapConfig.sourceRectanglePosition      = bitmapVisiblePartCopyPosition;
+  m_copyBitmapConfig.destinationRectanglePosition = imageVisiblePartPosition;
+
+  m_blendBitmapConfig.dimension                    = visiblePartDimension;
+  m_blendBitmapConfig.foregroundRectanglePosition  = bitmapVisiblePartCopyPosition;
+  m_blendBitmapConfig.backgroundRectanglePosition  = imageVisiblePartPosition;
+  m_blendBitmapConfig.destinationRectanglePosition = imageVisiblePartPosition;
+}
+
+bool GUI::Image::isBitmapOpaque(const BitmapDescription &bitmapDescription)
+{
+  if (isIndexedColorFormat(bitmapDescription.colorFormat))
+  {
+    for (uint16_t i = 0u; i < bitmapDescription.clutSize; ++i)
+    {
+      if (0xFF000000u != (bitmapDescription.clutPtr[i] & 0xFF000000u))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  return (ColorFormat::RGB888 == bitmapDescription.colorFormat);
+}
+
+bool GUI::Image::isIndexedColorFormat(ColorFormat colorFormat)
+{
+  return (ColorFormat::L8 == colorFormat) || (ColorFormat::L4 == colorFormat);
+}
+
+DMA2D::CLUTConfiguration GUI::Image::buildCLUTConfig(const BitmapDescription &bitmapDescription)
+{
+  return
+  {
+    .colorFormat = DMA2D::CLUTColorFormat::ARGB8888,
+    .size        = isIndexedColorFormat(bitmapDescription.colorFormat) ? bitmapDescription.clutSize : static_cast<uint16_t>(0u),
+    .clutPtr     = bitmapDescription.clutPtr
+  };
+}
+
 DMA2D::Position GUI::Image::mapToDMA2DPosition(Position position)
 {
   return
@@ -289,4 +812,65 @@ DMA2D::Dimension GUI::Image::mapToDMA2DDimension(Dimension dimension)
     .width  = dimension.width,
     .height = dimension.height
   };
+}
+
+DMA2D::InputColorFormat GUI::Image::mapToDMA2DInputColorFormat(ColorFormat colorFormat)
+{
+  switch (colorFormat)
+  {
+    case ColorFormat::ARGB8888:
+      return DMA2D::InputColorFormat::ARGB8888;
+
+    case ColorFormat::L8:
+      return DMA2D::InputColorFormat::L8;
+
+    case ColorFormat::L4:
+      return DMA2D::InputColorFormat::L4;
+
+    case ColorFormat::RGB888:
+    default:
+      return DMA2D::InputColorFormat::RGB888;
+  }
+}
+
+DMA2D::InputColorFormat GUI::Image::mapToDMA2DInputColorFormat(IFrameBuffer::ColorFormat colorFormat)
+{
+  switch (colorFormat)
+  {
+    case IFrameBuffer::ColorFormat::RGB565:
+      return DMA2D::InputColorFormat::RGB565;
+
+    case IFrameBuffer::ColorFormat::RGB888:
+    default:
+      return DMA2D::InputColorFormat::RGB888;
+  }
+}
+
+DMA2D::OutputColorFormat GUI::Image::mapToDMA2DOutputColorFormat(IFrameBuffer::ColorFormat colorFormat)
+{
+  switch (colorFormat)
+  {
+    case IFrameBuffer::ColorFormat::RGB565:
+      return DMA2D::OutputColorFormat::RGB565;
+
+    case IFrameBuffer::ColorFormat::RGB888:
+    default:
+      return DMA2D::OutputColorFormat::RGB888;
+  }
+}
+
+GUI::ErrorCode GUI::Image::mapToErrorCode(DMA2D::ErrorCode errorCode)
+{
+  switch (errorCode)
+  {
+    case DMA2D::ErrorCode::COMMAND_QUEUE_FULL:
+      return ErrorCode::DMA2D_COMMAND_QUEUE_FULL;
+
+    case DMA2D::ErrorCode::BUSY:
+      return ErrorCode::DMA2D_TRANSACTION_ONGOING;
+
+    case DMA2D::ErrorCode::OK:
+    default:
+      return ErrorCode::OK;
+  }
 }
\ No newline at end of file
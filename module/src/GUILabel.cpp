@@ -0,0 +1,480 @@
+#include "GUILabel.h"
+#include "GUIBlitter.h"
+
+
+GUI::DrawCostModel GUI::Label::s_drawCostModel;
+
+GUI::Label::Label(DMA2D &dma2d, SysTick &sysTick, IFrameBuffer &frameBuffer):
+  RectangleBase(sysTick, frameBuffer),
+  m_fontPtr(nullptr),
+  m_text{},
+  m_color{},
+  m_glyphBlitCount(0u),
+  m_dma2d(dma2d)
+{}
+
+GUI::ErrorCode GUI::Label::init(const LabelDescription &labelDescription)
+{
+  if (nullptr == labelDescription.fontPtr)
+  {
+    return ErrorCode::ARGUMENT_NULL_POINTER;
+  }
+
+  if (not isFrameBufferColorFormatSupported())
+  {
+    return ErrorCode::UNSUPPORTED_FBUFF_COLOR_FORMAT;
+  }
+
+  RectangleBase::init(labelDescription.baseDescription);
+  m_fontPtr = labelDescription.fontPtr;
+  m_color   = labelDescription.color;
+  setText(labelDescription.text);
+  buildBlendBitmapConfig();
+
+  return ErrorCode::OK;
+}
+
+void GUI::Label::setFrameBuffer(IFrameBuffer &frameBuffer)
+{
+  RectangleBase::setFrameBuffer(frameBuffer);
+  buildBlendBitmapConfig();
+}
+
+bool GUI::Label::isOpaque(void) const
+{
+  return false;
+}
+
+void GUI::Label::setText(const char *text)
+{
+  bool isTextChanged = false;
+  uint8_t charIdx = 0u;
+
+  if (nullptr != text)
+  {
+    for (; (charIdx < MAX_TEXT_LENGTH) && ('\0' != text[charIdx]); ++charIdx)
+    {
+      isTextChanged |= (m_text[charIdx] != text[charIdx]);
+      m_text[charIdx] = text[charIdx];
+    }
+  }
+
+  isTextChanged |= ('\0' != m_text[charIdx]);
+  m_text[charIdx] = '\0';
+
+  if (isTextChanged)
+  {
+    reportDamagedRegion(getRegion());
+  }
+}
+
+GUI::Color GUI::Label::getColor(void) const
+{
+  return m_color;
+}
+
+void GUI::Label::setColor(Color color)
+{
+  if (m_color != color)
+  {
+    m_color = color;
+    m_blendBitmapConfig.foregroundBufferConfig.color = mapToDMA2DColor(m_color);
+    reportDamagedRegion(getRegion());
+  }
+}
+
+uint16_t GUI::Label::getTextWidth(void) const
+{
+  uint16_t textWidth = 0u;
+
+  for (const char *characterPtr = m_text; '\0' != *characterPtr; ++characterPtr)
+  {
+    const Glyph *glyphPtr = findGlyph(*characterPtr);
+    if (nullptr != glyphPtr)
+    {
+      textWidth += glyphPtr->advance;
+    }
+  }
+
+  return textWidth;
+}
+
+GUI::DrawCostModel& GUI::Label::getDrawCostModel(void) const
+{
+  return s_drawCostModel;
+}
+
+void GUI::Label::drawCPU(void)
+{
+  layoutVisibleGlyphs();
+
+  switch (m_frameBufferPtr->getColorFormat())
+  {
+    case IFrameBuffer::ColorFormat::RGB565:
+      drawCPUToFrameBufferRGB565();
+      break;
+
+    case IFrameBuffer::ColorFormat::RGB888:
+      drawCPUToFrameBufferRGB888();
+      break;
+
+    default:
+      // do nothing
+      break;
+  }
+}
+
+void GUI::Label::drawDMA2D(void)
+{
+  // glyphs are blended as one command queue, so drawing is completed once the last glyph is blended
+  if ((0u == m_dma2d.getNumberOfEnqueuedCommands()) && (ErrorCode::OK == enqueueDMA2DCommands()))
+  {
+    m_dma2d.executeCommandQueue({ .functionPtr = callbackDMA2DDrawCompleted, .argument = this });
+  }
+  else
+  {
+    // DMA2D is not able to blend these glyphs, so they are drawn by CPU and drawing is completed immediately
+    drawCPU();
+    callbackDMA2DDrawCompleted(this);
+  }
+}
+
+GUI::ErrorCode GUI::Label::enqueueDMA2DCommands(void)
+{
+  layoutVisibleGlyphs();
+
+  if (not canGlyphBlitsBeDrawnByDMA2D())
+  {
+    return ErrorCode::DMA2D_UNSUPPORTED_OPERATION;
+  }
+
+  // all glyphs are enqueued or none of them, so the label is never drawn partially
+  if ((DMA2D::COMMAND_QUEUE_CAPACITY - m_dma2d.getNumberOfEnqueuedCommands()) < m_glyphBlitCount)
+  {
+    return ErrorCode::DMA2D_COMMAND_QUEUE_FULL;
+  }
+
+  for (uint8_t blitIdx = 0u; blitIdx < m_glyphBlitCount; ++blitIdx)
+  {
+    const GlyphBlit &glyphBlit = m_glyphBlits[blitIdx];
+    const DMA2D::Position regionPosition = mapToDMA2DPosition(
+      { .x = glyphBlit.region.x, .y = glyphBlit.region.y, .tag = Position::Tag::TOP_LEFT_CORNER });
+
+    m_blendBitmapConfig.dimension                    = { .width = glyphBlit.region.width, .height = glyphBlit.region.height };
+    m_blendBitmapConfig.foregroundRectanglePosition  = mapToDMA2DPosition(glyphBlit.atlasPosition);
+    m_blendBitmapConfig.backgroundRectanglePosition  = regionPosition;
+    m_blendBitmapConfig.destinationRectanglePosition = regionPosition;
+
+    const DMA2D::ErrorCode errorCode = m_dma2d.enqueueBlendBitmap(m_blendBitmapConfig);
+    if (DMA2D::ErrorCode::OK != errorCode)
+    {
+      return mapToErrorCode(errorCode);
+    }
+  }
+
+  return ErrorCode::OK;
+}
+
+void GUI::Label::drawCPUToFrameBufferRGB888(void)
+{
+  constexpr uint32_t FBUFF_PIXEL_SIZE = 3u;
+
+  const uint32_t fbuffRowWidth = FBUFF_PIXEL_SIZE * m_frameBufferPtr->getWidth();
+  uint8_t *frameBufferPtr = reinterpret_cast<uint8_t*>(m_frameBufferPtr->getPointer());
+
+  for (uint8_t blitIdx = 0u; blitIdx < m_glyphBlitCount; ++blitIdx)
+  {
+    const GlyphBlit &glyphBlit = m_glyphBlits[blitIdx];
+
+    for (uint16_t rowIdx = 0u; rowIdx < glyphBlit.region.height; ++rowIdx)
+    {
+      uint8_t *pixelPtr = frameBufferPtr + (glyphBlit.region.y + rowIdx) * fbuffRowWidth +
+        FBUFF_PIXEL_SIZE * glyphBlit.region.x;
+
+      for (uint16_t columnIdx = 0u; columnIdx < glyphBlit.region.width; ++columnIdx, pixelPtr += FBUFF_PIXEL_SIZE)
+      {
+        const uint32_t alpha = getGlyphAlpha(glyphBlit.atlasPosition.x + columnIdx, glyphBlit.atlasPosition.y + rowIdx);
+        if (0u != alpha)
+        {
+          pixelPtr[0] = static_cast<uint8_t>(Blitter::divideBy255(alpha * m_color.blue  + (255u - alpha) * pixelPtr[0]));
+          pixelPtr[1] = static_cast<uint8_t>(Blitter::divideBy255(alpha * m_color.green + (255u - alpha) * pixelPtr[1]));
+          pixelPtr[2] = static_cast<uint8_t>(Blitter::divideBy255(alpha * m_color.red   + (255u - alpha) * pixelPtr[2]));
+        }
+      }
+    }
+  }
+}
+
+void GUI::Label::drawCPUToFrameBufferRGB565(void)
+{
+  const uint32_t fbuffRowWidth = m_frameBufferPtr->getWidth();
+  uint16_t *frameBufferPtr = reinterpret_cast<uint16_t*>(m_frameBufferPtr->getPointer());
+
+  for (uint8_t blitIdx = 0u; blitIdx < m_glyphBlitCount; ++blitIdx)
+  {
+    const GlyphBlit &glyphBlit = m_glyphBlits[blitIdx];
+
+    for (uint16_t rowIdx = 0u; rowIdx < glyphBlit.region.height; ++rowIdx)
+    {
+      uint16_t *pixelPtr = frameBufferPtr + (glyphBlit.region.y + rowIdx) * fbuffRowWidth + glyphBlit.region.x;
+
+      for (uint16_t columnIdx = 0u; columnIdx < glyphBlit.region.width; ++columnIdx, ++pixelPtr)
+      {
+        const uint32_t alpha = getGlyphAlpha(glyphBlit.atlasPosition.x + columnIdx, glyphBlit.atlasPosition.y + rowIdx);
+        if (0u != alpha)
+        {
+          const Color background = Color::fromRGB565(*pixelPtr);
+          const Color color =
+          {
+            .red   = static_cast<uint8_t>(Blitter::divideBy255(alpha * m_color.red   + (255u - alpha) * background.red)),
+            .green = static_cast<uint8_t>(Blitter::divideBy255(alpha * m_color.green + (255u - alpha) * background.green)),
+            .blue  = static_cast<uint8_t>(Blitter::divideBy255(alpha * m_color.blue  + (255u - alpha) * background.blue))
+          };
+
+          *pixelPtr = color.toRGB565();
+        }
+      }
+    }
+  }
+}
+
+uint8_t GUI::Label::layoutVisibleGlyphs(void)
+{
+  m_glyphBlitCount = 0u;
+
+  if (nullptr == m_fontPtr)
+  {
+    return m_glyphBlitCount;
+  }
+
+  const Position labelPosition = getPosition(Position::Tag::TOP_LEFT_CORNER);
+  const Region visibleRegion = getVisiblePartRegion();
+
+  int32_t penX = labelPosition.x;
+
+  for (const char *characterPtr = m_text; '\0' != *characterPtr; ++characterPtr)
+  {
+    const Glyph *glyphPtr = findGlyph(*characterPtr);
+    if (nullptr == glyphPtr)
+    {
+      continue;
+    }
+
+    const Region glyphRegion =
+    {
+      .x      = static_cast<int16_t>(penX),
+      .y      = labelPosition.y,
+      .width  = glyphPtr->width,
+      .height = m_fontPtr->atlasDimension.height
+    };
+    const Region glyphVisibleRegion = glyphRegion.getIntersection(visibleRegion);
+
+    if (not glyphVisibleRegion.isEmpty())
+    {
+      m_glyphBlits[m_glyphBlitCount++] =
+      {
+        .atlasPosition =
+        {
+          .x   = static_cast<int16_t>(glyphPtr->x + glyphVisibleRegion.x - glyphRegion.x),
+          .y   = static_cast<int16_t>(glyphVisibleRegion.y - glyphRegion.y),
+          .tag = Position::Tag::TOP_LEFT_CORNER
+        },
+        .region = glyphVisibleRegion
+      };
+    }
+
+    penX += glyphPtr->advance;
+  }
+
+  return m_glyphBlitCount;
+}
+
+bool GUI::Label::canGlyphBlitsBeDrawnByDMA2D(void) const
+{
+  if (m_glyphBlitCount > DMA2D::COMMAND_QUEUE_CAPACITY)
+  {
+    return false;
+  }
+
+  // A4 line offset and start address can not point into the middle of a byte
+  if (GlyphFormat::A4 == m_fontPtr->glyphFormat)
+  {
+    for (uint8_t blitIdx = 0u; blitIdx < m_glyphBlitCount; ++blitIdx)
+    {
+      if (0u != ((m_glyphBlits[blitIdx].atlasPosition.x | m_glyphBlits[blitIdx].region.width) & 0x1u))
+      {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+inline uint8_t GUI::Label::getGlyphAlpha(uint16_t x, uint16_t y) const
+{
+  const uint8_t *atlasPtr = reinterpret_cast<const uint8_t*>(m_fontPtr->atlasPtr);
+  const uint32_t pixelIdx = x + y * static_cast<uint32_t>(m_fontPtr->atlasDimension.width);
+
+  if (GlyphFormat::A4 == m_fontPtr->glyphFormat)
+  {
+    const uint8_t alphas = atlasPtr[pixelIdx / 2u];
+    const uint8_t alpha  = (0u == (pixelIdx % 2u)) ? (alphas & 0x0Fu) : (alphas >> 4u);
+    return static_cast<uint8_t>((alpha << 4u) | alpha);
+  }
+
+  return atlasPtr[pixelIdx];
+}
+
+const GUI::Label::Glyph* GUI::Label::findGlyph(char character) const
+{
+  const int32_t glyphIdx = static_cast<int32_t>(character) - m_fontPtr->firstCharacter;
+
+  if ((glyphIdx < 0) || (glyphIdx >= m_fontPtr->glyphCount))
+  {
+    return nullptr;
+  }
+
+  return &(m_fontPtr->glyphPtr[glyphIdx]);
+}
+
+void GUI::Label::buildBlendBitmapConfig(void)
+{
+  if (nullptr == m_fontPtr)
+  {
+    return;
+  }
+
+  m_blendBitmapConfig =
+  {
+    .dimension = { .width = 0u, .height = 0u },
+    .foregroundRectanglePosition = { .x = 0u, .y = 0u },
+    .foregroundBufferConfig =
+    {
+      .colorFormat     = mapToDMA2DInputColorFormat(m_fontPtr->glyphFormat),
+      .bufferDimension = mapToDMA2DDimension(m_fontPtr->atlasDimension),
+      .bufferPtr       = m_fontPtr->atlasPtr,
+      .clutConfig      = { .colorFormat = DMA2D::CLUTColorFormat::ARGB8888, .size = 0u, .clutPtr = nullptr },
+      .color           = mapToDMA2DColor(m_color)
+    },
+    .backgroundRectanglePosition = { .x = 0u, .y = 0u },
+    .backgroundBufferConfig =
+    {
+      .colorFormat     = mapToDMA2DInputColorFormat(m_frameBufferPtr->getColorFormat()),
+      .bufferDimension = mapToDMA2DDimension(m_frameBufferPtr->getDimension()),
+      .bufferPtr       = m_frameBufferPtr->getPointer()
+    },
+    .destinationRectanglePosition = { .x = 0u, .y = 0u },
+    .destinationBufferConfig =
+    {
+      .colorFormat     = mapToDMA2DOutputColorFormat(m_frameBufferPtr->getColorFormat()),
+      .bufferDimension = mapToDMA2DDimension(m_frameBufferPtr->getDimension()),
+      .bufferPtr       = m_frameBufferPtr->getPointer()
+    },
+    .drawCompletedCallback =
+    {
+      .functionPtr = callbackDMA2DDrawCompleted,
+      .argument    = this
+    }
+  };
+}
+
+inline bool GUI::Label::isFrameBufferColorFormatSupported(void) const
+{
+  return (IFrameBuffer::ColorFormat::RGB888 == m_frameBufferPtr->getColorFormat()) ||
+         (IFrameBuffer::ColorFormat::RGB565 == m_frameBufferPtr->getColorFormat());
+}
+
+DMA2D::InputColorFormat GUI::Label::mapToDMA2DInputColorFormat(GlyphFormat glyphFormat)
+{
+  switch (glyphFormat)
+  {
+    case GlyphFormat::A4:
+      return DMA2D::InputColorFormat::A4;
+
+    case GlyphFormat::A8:
+    default:
+      return DMA2D::InputColorFormat::A8;
+  }
+}
+
+DMA2D::InputColorFormat GUI::Label::mapToDMA2DInputColorFormat(IFrameBuffer::ColorFormat colorFormat)
+{
+  switch (colorFormat)
+  {
+    case IFrameBuffer::ColorFormat::RGB565:
+      return DMA2D::InputColorFormat::RGB565;
+
+    case IFrameBuffer::ColorFormat::RGB888:
+    default:
+      return DMA2D::InputColorFormat::RGB888;
+  }
+}
+
+DMA2D::OutputColorFormat GUI::Label::mapToDMA2DOutputColorFormat(IFrameBuffer::ColorFormat colorFormat)
+{
+  switch (colorFormat)
+  {
+    case IFrameBuffer::ColorFormat::RGB565:
+      return DMA2D::OutputColorFormat::RGB565;
+
+    case IFrameBuffer::ColorFormat::RGB888:
+    default:
+      return DMA2D::OutputColorFormat::RGB888;
+  }
+}
+
+DMA2D::Position GUI::Label::mapToDMA2DPosition(Position position)
+{
+  return
+  {
+    .x = static_cast<uint16_t>(position.x),
+    .y = static_cast<uint16_t>(position.y)
+  };
+}
+
+DMA2D::Dimension GUI::Label::mapToDMA2DDimension(Dimension dimension)
+{
+  return
+  {
+    .width  = dimension.width,
+    .height = dimension.height
+  };
+}
+
+DMA2D::Dimension GUI::Label::mapToDMA2DDimension(IFrameBuffer::Dimension dimension)
+{
+  return
+  {
+    .width  = dimension.width,
+    .height = dimension.height
+  };
+}
+
+DMA2D::Color GUI::Label::mapToDMA2DColor(Color color)
+{
+  // FGCOLR always holds 8 bit components, PFC converts them together with the alpha of each glyph pixel
+  return
+  {
+    .alpha = 0u,
+    .red   = color.red,
+    .green = color.green,
+    .blue  = color.blue
+  };
+}
+
+GUI::ErrorCode GUI::Label::mapToErrorCode(DMA2D::ErrorCode errorCode)
+{
+  switch (errorCode)
+  {
+    case DMA2D::ErrorCode::COMMAND_QUEUE_FULL:
+      return ErrorCode::DMA2D_COMMAND_QUEUE_FULL;
+
+    case DMA2D::ErrorCode::BUSY:
+      return ErrorCode::DMA2D_TRANSACTION_ONGOING;
+
+    case DMA2D::ErrorCode::OK:
+    default:
+      return ErrorCode::OK;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,302 @@
+#include "GUIPanel.h"
+
+
+GUI::Panel::Panel(IArrayList<ObjectInfo> &objectInfoList, SysTick &sysTick, IFrameBuffer &frameBuffer):
+  RectangleBase(sysTick, frameBuffer),
+  m_objectInfoList(objectInfoList)
+{}
+
+uint32_t GUI::Panel::getCapacity(void) const
+{
+  return m_objectInfoList.getCapacity();
+}
+
+uint32_t GUI::Panel::getSize(void) const
+{
+  return m_objectInfoList.getSize();
+}
+
+bool GUI::Panel::isEmpty(void) const
+{
+  return m_objectInfoList.isEmpty();
+}
+
+GUI::IObject* GUI::Panel::getObject(uint32_t zIndex)
+{
+  for (auto it = m_objectInfoList.getBeginIterator(); it != m_objectInfoList.getEndIterator(); ++it)
+  {
+    if (zIndex == it->zIndex)
+    {
+      return it->objectPtr;
+    }
+  }
+
+  return nullptr;
+}
+
+GUI::ErrorCode GUI::Panel::addObject(IObject *objectPtr, uint32_t zIndex)
+{
+  ErrorCode errorCode = ErrorCode::OK;
+
+  if (nullptr == objectPtr)
+  {
+    errorCode = ErrorCode::ARGUMENT_NULL_POINTER;
+  }
+
+  if (ErrorCode::OK == errorCode)
+  {
+    ObjectInfo objectInfo =
+    {
+      .objectPtr = objectPtr,
+      .zIndex    = zIndex
+    };
+
+    errorCode = insertObjectInfoIntoList(objectInfo);
+  }
+
+  if (ErrorCode::OK == errorCode)
+  {
+    const IDrawable::CallbackDescription callbackDescription =
+    {
+      .functionPtr = objectDrawingCompletedCallback,
+      .argument    = this
+    };
+
+    const IClippable::DamagedRegionCallbackDescription damagedRegionCallbackDescription =
+    {
+      .functionPtr = objectDamagedRegionCallback,
+      .argument    = this
+    };
+
+    const Position panelPosition  = getPosition(Position::Tag::TOP_LEFT_CORNER);
+    Position objectPosition = objectPtr->getPosition(Position::Tag::TOP_LEFT_CORNER);
+    objectPosition.x += panelPosition.x;
+    objectPosition.y += panelPosition.y;
+
+    objectPtr->setFrameBuffer(getFrameBuffer());
+    objectPtr->registerDrawCompletedCallback(callbackDescription);
+    objectPtr->registerDamagedRegionCallback(damagedRegionCallbackDescription);
+
+    m_isMovingObjects = true;
+    objectPtr->moveToPosition(objectPosition);
+    m_isMovingObjects = false;
+
+    reportDamagedRegion(objectPtr->getRegion().getIntersection(getRegion()));
+  }
+
+  return errorCode;
+}
+
+void GUI::Panel::setFrameBuffer(IFrameBuffer &frameBuffer)
+{
+  RectangleBase::setFrameBuffer(frameBuffer);
+
+  for (auto it = m_objectInfoList.getBeginIterator(); it != m_objectInfoList.getEndIterator(); ++it)
+  {
+    it->objectPtr->setFrameBuffer(frameBuffer);
+  }
+}
+
+void GUI::Panel::moveToPosition(const Position &position)
+{
+  const Position oldPosition = getPosition(Position::Tag::TOP_LEFT_CORNER);
+
+  RectangleBaseDescription newDescription =
+  {
+    .dimension = getDimension(),
+    .position  = position
+  };
+  recalculatePositionToBeTopLeftCorner(newDescription);
+
+  const int16_t deltaX = newDescription.position.x - oldPosition.x;
+  const int16_t deltaY = newDescription.position.y - oldPosition.y;
+
+  // objects stay inside of the panel, so the damage is fully covered by the old and the new panel region
+  m_isMovingObjects = true;
+  for (auto it = m_objectInfoList.getBeginIterator(); it != m_objectInfoList.getEndIterator(); ++it)
+  {
+    Position objectPosition = it->objectPtr->getPosition(Position::Tag::TOP_LEFT_CORNER);
+    objectPosition.x += deltaX;
+    objectPosition.y += deltaY;
+
+    it->objectPtr->moveToPosition(objectPosition);
+  }
+  m_isMovingObjects = false;
+
+  RectangleBase::moveToPosition(position);
+}
+
+bool GUI::Panel::isOpaque(void) const
+{
+  return false;
+}
+
+void GUI::Panel::notify(const TouchEvent &touchEvent)
+{
+  const IArrayList<Point> &touchPoints = touchEvent.getTouchPoints();
+
+  // objects with higher z-index are on top
+  for (uint32_t objectIdx = getSize(); objectIdx > 0u; --objectIdx)
+  {
+    IObject *objectPtr = getObjectAtIdx(objectIdx - 1u);
+
+    if (doesObjectContainAnyOfTouchPoints(*objectPtr, touchPoints))
+    {
+      objectPtr->notify(touchEvent);
+      return;
+    }
+  }
+
+  RectangleBase::notify(touchEvent);
+}
+
+void GUI::Panel::drawCPU(void)
+{
+  const Region visibleRegion = getVisiblePartRegion();
+
+  for (; m_nextObjectIdx < getSize(); ++m_nextObjectIdx)
+  {
+    IObject *objectPtr = getObjectAtIdx(m_nextObjectIdx);
+
+    objectPtr->setClipRegion(visibleRegion);
+    objectPtr->draw(DrawHardware::CPU);
+  }
+
+  m_nextObjectIdx = 0u;
+}
+
+void GUI::Panel::drawDMA2D(void)
+{
+  m_isDrawingObjectsDMA2D = true;
+  drawNextObjectDMA2D();
+}
+
+GUI::ErrorCode GUI::Panel::enqueueDMA2DCommands(void)
+{
+  const Region visibleRegion = getVisiblePartRegion();
+  uint32_t enqueuedObjectCount = 0u;
+
+  for (; m_nextObjectIdx < getSize(); ++m_nextObjectIdx)
+  {
+    IObject *objectPtr = getObjectAtIdx(m_nextObjectIdx);
+
+    objectPtr->setClipRegion(visibleRegion);
+    const ErrorCode errorCode = objectPtr->enqueueDMA2DDrawCommands();
+
+    if (ErrorCode::DMA2D_UNSUPPORTED_OPERATION == errorCode)
+    {
+      // commands enqueued so far have to be executed first, the rest of the panel is then drawn with CPU
+      return (0u == enqueuedObjectCount) ? errorCode : ErrorCode::DMA2D_COMMAND_QUEUE_FULL;
+    }
+    else if (ErrorCode::OK != errorCode)
+    {
+      // enqueuing continues from this object once the queue is executed
+      return errorCode;
+    }
+
+    ++enqueuedObjectCount;
+  }
+
+  m_nextObjectIdx = 0u;
+
+  return ErrorCode::OK;
+}
+
+void GUI::Panel::drawNextObjectDMA2D(void)
+{
+  if (m_nextObjectIdx < getSize())
+  {
+    IObject *objectPtr = getObjectAtIdx(m_nextObjectIdx++);
+
+    // object drawn synchronously continues the chain from its draw completed callback
+    objectPtr->setClipRegion(getVisiblePartRegion());
+    objectPtr->draw(DrawHardware::DMA2D);
+  }
+  else
+  {
+    m_isDrawingObjectsDMA2D = false;
+    m_nextObjectIdx         = 0u;
+
+    callbackDMA2DDrawCompleted(this);
+  }
+}
+
+GUI::IObject* GUI::Panel::getObjectAtIdx(uint32_t objectIdx) const
+{
+  return (m_objectInfoList.getBeginIterator() + objectIdx)->objectPtr;
+}
+
+bool GUI::Panel::doesObjectContainAnyOfTouchPoints(const IObject &object, const IArrayList<Point> &touchPoints) const
+{
+  for (auto it = touchPoints.getBeginIterator(); it != touchPoints.getEndIterator(); it++)
+  {
+    if (doesContainPoint(*it) && object.doesContainPoint(*it))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+GUI::ErrorCode GUI::Panel::insertObjectInfoIntoList(const ObjectInfo &objectInfo)
+{
+  ErrorCode errorCode = ErrorCode::OK;
+
+  auto iterator = m_objectInfoList.getBeginIterator();
+  while ((m_objectInfoList.getEndIterator() != iterator) && (iterator->zIndex < objectInfo.zIndex))
+  {
+    ++iterator;
+  }
+
+  if (m_objectInfoList.getEndIterator() == iterator)
+  {
+    errorCode = mapToErrorCode(m_objectInfoList.addElement(objectInfo));
+  }
+  else if (objectInfo.zIndex == iterator->zIndex)
+  {
+    errorCode = ErrorCode::Z_INDEX_ALREADY_IN_USAGE;
+  }
+  else
+  {
+    errorCode = mapToErrorCode(m_objectInfoList.addElement(iterator - m_objectInfoList.getBeginIterator(), objectInfo));
+  }
+
+  return errorCode;
+}
+
+GUI::ErrorCode GUI::Panel::mapToErrorCode(IArrayListBase::ErrorCode errorCode)
+{
+  switch (errorCode)
+  {
+    case IArrayListBase::ErrorCode::CONTAINER_FULL_ERROR:
+      return ErrorCode::CONTAINER_FULL_ERROR;
+
+    case IArrayListBase::ErrorCode::OK:
+    case IArrayListBase::ErrorCode::OUT_OF_RANGE_ERROR:
+    case IArrayListBase::ErrorCode::NULL_POINTER_ERROR:
+    default:
+      return ErrorCode::OK;
+  }
+}
+
+void GUI::Panel::objectDrawingCompletedCallback(void *guiPanelPtr)
+{
+  GUI::Panel *panelPtr = reinterpret_cast<GUI::Panel*>(guiPanelPtr);
+
+  if ((nullptr != panelPtr) && panelPtr->m_isDrawingObjectsDMA2D)
+  {
+    panelPtr->drawNextObjectDMA2D();
+  }
+}
+
+void GUI::Panel::objectDamagedRegionCallback(void *guiPanelPtr, const Region &region)
+{
+  GUI::Panel *panelPtr = reinterpret_cast<GUI::Panel*>(guiPanelPtr);
+
+  if ((nullptr != panelPtr) && (not panelPtr->m_isMovingObjects))
+  {
+    // nothing of the object is drawn outside of the panel
+    panelPtr->reportDamagedRegion(region.getIntersection(panelPtr->getRegion()));
+  }
+}
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include "GUIRectangle.h"
+#include "GUIBlitter.h"
 
 
+GUI::DrawCostModel GUI::Rectangle::s_drawCostModel;
+
 GUI::Rectangle::Rectangle(DMA2D &dma2d, SysTick &sysTick, IFrameBuffer &frameBuffer):
   RectangleBase(sysTick, frameBuffer),
   m_dma2d(dma2d)
@@ -19,38 +22,100 @@ void GUI::Rectangle::setFrameBuffer(IFrameBuffer &frameBuffer)
   buildFillRectangleConfig();
 }
 
+bool GUI::Rectangle::isOpaque(void) const
+{
+  return true;
+}
+
 GUI::Color GUI::Rectangle::getColor(void) const
 {
   return m_color;
 }
 
+void GUI::Rectangle::setColor(Color color)
+{
+  if (m_color != color)
+  {
+    m_color = color;
+    m_fillRectangleConfig.color = mapToDMA2DColor(m_color, m_frameBufferPtr->getColorFormat());
+    reportDamagedRegion(getRegion());
+  }
+}
+
+GUI::DrawCostModel& GUI::Rectangle::getDrawCostModel(void) const
+{
+  return s_drawCostModel;
+}
+
 void GUI::Rectangle::moveToPosition(const Position &position)
 {
   RectangleBase::moveToPosition(position);
-  m_fillRectangleConfig.position  = mapToDMA2DPosition(getVisiblePartPosition(Position::Tag::TOP_LEFT_CORNER));
-  m_fillRectangleConfig.dimension = mapToDMA2DDimension(getVisiblePartDimension());
+  updateFillRectangleConfigVisiblePart();
+}
+
+void GUI::Rectangle::setClipRegion(const Region &clipRegion)
+{
+  RectangleBase::setClipRegion(clipRegion);
+  updateFillRectangleConfigVisiblePart();
+}
+
+void GUI::Rectangle::resetClipRegion(void)
+{
+  RectangleBase::resetClipRegion();
+  updateFillRectangleConfigVisiblePart();
 }
 
 void GUI::Rectangle::drawCPU(void)
+{
+  switch (m_frameBufferPtr->getColorFormat())
+  {
+    case IFrameBuffer::ColorFormat::RGB565:
+      drawCPUToFrameBufferRGB565();
+      break;
+
+    case IFrameBuffer::ColorFormat::RGB888:
+    case IFrameBuffer::ColorFormat::ARGB8888:
+    default:
+      drawCPUToFrameBufferRGB888();
+      break;
+  }
+}
+
+void GUI::Rectangle::drawCPUToFrameBufferRGB888(void)
 {
   const Position startPosition = getVisiblePartPosition(Position::Tag::TOP_LEFT_CORNER);
   const Position endPosition   = getVisiblePartPosition(Position::Tag::BOTTOM_RIGHT_CORNER);
   const uint32_t rowWidth      = m_frameBufferPtr->getSize() / m_frameBufferPtr->getHeight();
   const uint8_t pixelSize      = IFrameBuffer::getColorFormatPixelSize(m_frameBufferPtr->getColorFormat());
-  const uint32_t columnStartOffset = pixelSize * startPosition.x;
-  const uint32_t columnEndOffset   = pixelSize * endPosition.x;
+  const uint32_t columnStartOffset   = pixelSize * startPosition.x;
+  const uint32_t numberOfPixelsInRow = endPosition.x - startPosition.x + 1u;
 
-  uint8_t *frameBufferPtr = reinterpret_cast<uint8_t*>(m_frameBufferPtr->getPointer());
+  uint8_t *rowPtr = reinterpret_cast<uint8_t*>(m_frameBufferPtr->getPointer()) +
+    startPosition.y * rowWidth + columnStartOffset;
+
+  for (int32_t rowIdx = startPosition.y; rowIdx <= endPosition.y; ++rowIdx)
+  {
+    Blitter::fillRowRGB888(rowPtr, m_color, numberOfPixelsInRow);
+    rowPtr += rowWidth;
+  }
+}
+
+void GUI::Rectangle::drawCPUToFrameBufferRGB565(void)
+{
+  const Position startPosition = getVisiblePartPosition(Position::Tag::TOP_LEFT_CORNER);
+  const Position endPosition   = getVisiblePartPosition(Position::Tag::BOTTOM_RIGHT_CORNER);
+  const uint32_t rowWidth      = m_frameBufferPtr->getWidth();
+  const uint16_t pixel         = m_color.toRGB565();
+
+  uint16_t *frameBufferPtr = reinterpret_cast<uint16_t*>(m_frameBufferPtr->getPointer());
 
   for (uint16_t rowIdx = startPosition.y; rowIdx <= endPosition.y; ++rowIdx)
   {
-    const uint32_t columnStartIdx = rowIdx * rowWidth + columnStartOffset;
-    const uint32_t columnEndIdx   = rowIdx * rowWidth + columnEndOffset;
-    for (uint32_t columnIdx = columnStartIdx; columnIdx <= columnEndIdx;)
+    const uint32_t columnStartIdx = rowIdx * rowWidth + startPosition.x;
+    const uint32_t columnEndIdx   = rowIdx * rowWidth + endPosition.x;
+    for (uint32_t columnIdx = columnStartIdx; columnIdx <= columnEndIdx; ++columnIdx)
     {
-      frameBufferPtr[columnIdx++] = m_color.blue;
-      frameBufferPtr[columnIdx++] = m_color.green;
-      frameBufferPtr[columnIdx++] = m_color.red;
+      frameBufferPtr[columnIdx] = pixel;
     }
   }
 }
@@ -60,11 +125,16 @@ void GUI::Rectangle::drawDMA2D(void)
   m_dma2d.fillRectangle(m_fillRectangleConfig);
 }
 
+GUI::ErrorCode GUI::Rectangle::enqueueDMA2DCommands(void)
+{
+  return mapToErrorCode(m_dma2d.enqueueFillRectangle(m_fillRectangleConfig));
+}
+
 void GUI::Rectangle::buildFillRectangleConfig(void)
 {
   m_fillRectangleConfig =
   {
-    .color     = mapToDMA2DColor(m_color),
+    .color     = mapToDMA2DColor(m_color, m_frameBufferPtr->getColorFormat()),
     .dimension = mapToDMA2DDimension(getVisiblePartDimension()),
     .position  = mapToDMA2DPosition(getVisiblePartPosition(Position::Tag::TOP_LEFT_CORNER)),
     .destinationBufferConfig =
@@ -81,6 +151,12 @@ void GUI::Rectangle::buildFillRectangleConfig(void)
   };
 }
 
+void GUI::Rectangle::updateFillRectangleConfigVisiblePart(void)
+{
+  m_fillRectangleConfig.position  = mapToDMA2DPosition(getVisiblePartPosition(Position::Tag::TOP_LEFT_CORNER));
+  m_fillRectangleConfig.dimension = mapToDMA2DDimension(getVisiblePartDimension());
+}
+
 DMA2D::OutputColorFormat GUI::Rectangle::mapToDMA2DOutputColorFormat(IFrameBuffer::ColorFormat colorFormat)
 {
   switch (colorFormat)
@@ -88,6 +164,9 @@ DMA2D::OutputColorFormat GUI::Rectangle::mapToDMA2DOutputColorFormat(IFrameBuffe
     case IFrameBuffer::ColorFormat::ARGB8888:
       return DMA2D::OutputColorFormat::ARGB8888;
 
+    case IFrameBuffer::ColorFormat::RGB565:
+      return DMA2D::OutputColorFormat::RGB565;
+
     case IFrameBuffer::ColorFormat::RGB888:
     default:
       return DMA2D::OutputColorFormat::RGB888;
@@ -121,13 +200,45 @@ DMA2D::Dimension GUI::Rectangle::mapToDMA2DDimension(IFrameBuffer::Dimension dim
   };
 }
 
-DMA2D::Color GUI::Rectangle::mapToDMA2DColor(Color color)
+DMA2D::Color GUI::Rectangle::mapToDMA2DColor(Color color, IFrameBuffer::ColorFormat colorFormat)
 {
-  return
+  switch (colorFormat)
   {
-    .alpha = 0u,
-    .red   = color.red,
-    .green = color.green,
-    .blue  = color.blue
-  };
+    // DMA2D expects each component to fit into its bit field of the output pixel
+    case IFrameBuffer::ColorFormat::RGB565:
+      return
+      {
+        .alpha = 0u,
+        .red   = static_cast<uint8_t>(color.red >> 3u),
+        .green = static_cast<uint8_t>(color.green >> 2u),
+        .blue  = static_cast<uint8_t>(color.blue >> 3u)
+      };
+
+    case IFrameBuffer::ColorFormat::ARGB8888:
+    case IFrameBuffer::ColorFormat::RGB888:
+    default:
+      return
+      {
+        .alpha = 0u,
+        .red   = color.red,
+        .green = color.green,
+        .blue  = color.blue
+      };
+  }
+}
+
+GUI::ErrorCode GUI::Rectangle::mapToErrorCode(DMA2D::ErrorCode errorCode)
+{
+  switch (errorCode)
+  {
+    case DMA2D::ErrorCode::COMMAND_QUEUE_FULL:
+      return ErrorCode::DMA2D_COMMAND_QUEUE_FULL;
+
+    case DMA2D::ErrorCode::BUSY:
+      return ErrorCode::DMA2D_TRANSACTION_ONGOING;
+
+    case DMA2D::ErrorCode::OK:
+    default:
+      return ErrorCode::OK;
+  }
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include "GUIRectangleBase.h"
 
 
+GUI::DrawCostModel GUI::RectangleBase::s_drawCostModel;
+
 GUI::RectangleBase::RectangleBase(SysTick &sysTick, IFrameBuffer &frameBuffer):
   m_sysTick(sysTick),
   m_frameBufferPtr(&frameBuffer),
@@ -18,6 +20,16 @@ GUI::RectangleBase::RectangleBase(SysTick &sysTick, IFrameBuffer &frameBuffer):
     .functionPtr = nullptr,
     .argument    = nullptr
   },
+  m_damagedRegionCallback{
+    .functionPtr = nullptr,
+    .argument    = nullptr
+  },
+  m_clipRegion{
+    .x      = 0,
+    .y      = 0,
+    .width  = 0u,
+    .height = 0u
+  },
   m_touchEventCallback{
     .functionPtr = nullptr,
     .argument    = nullptr
@@ -26,8 +38,13 @@ GUI::RectangleBase::RectangleBase(SysTick &sysTick, IFrameBuffer &frameBuffer):
 
 void GUI::RectangleBase::init(const RectangleBaseDescription &rectangleDescription)
 {
+  const Region oldRegion = getRegion();
+
   m_rectangleBaseDescription = rectangleDescription;
   recalculatePositionToBeTopLeftCorner(m_rectangleBaseDescription);
+
+  reportDamagedRegion(oldRegion);
+  reportDamagedRegion(getRegion());
 }
 
 IFrameBuffer& GUI::RectangleBase::getFrameBuffer(void)
@@ -78,14 +95,72 @@ GUI::Position GUI::RectangleBase::getPosition(Position::Tag positionTag) const
 
 void GUI::RectangleBase::moveToPosition(const Position &position)
 {
+  const Region oldRegion = getRegion();
+
   m_rectangleBaseDescription.position = position;
   recalculatePositionToBeTopLeftCorner(m_rectangleBaseDescription);
+
+  if (oldRegion != getRegion())
+  {
+    reportDamagedRegion(oldRegion);
+    reportDamagedRegion(getRegion());
+  }
+}
+
+GUI::Region GUI::RectangleBase::getRegion(void) const
+{
+  return
+  {
+    .x      = m_rectangleBaseDescription.position.x,
+    .y      = m_rectangleBaseDescription.position.y,
+    .width  = m_rectangleBaseDescription.dimension.width,
+    .height = m_rectangleBaseDescription.dimension.height
+  };
+}
+
+GUI::Region GUI::RectangleBase::getClipRegion(void) const
+{
+  const Region frameBufferRegion =
+  {
+    .x      = 0,
+    .y      = 0,
+    .width  = m_frameBufferPtr->getWidth(),
+    .height = m_frameBufferPtr->getHeight()
+  };
+
+  return m_isClipRegionSet ? frameBufferRegion.getIntersection(m_clipRegion) : frameBufferRegion;
+}
+
+void GUI::RectangleBase::setClipRegion(const Region &clipRegion)
+{
+  m_clipRegion      = clipRegion;
+  m_isClipRegionSet = true;
+}
+
+void GUI::RectangleBase::resetClipRegion(void)
+{
+  m_isClipRegionSet = false;
+}
+
+void GUI::RectangleBase::registerDamagedRegionCallback(const DamagedRegionCallbackDescription &callbackDescription)
+{
+  m_damagedRegionCallback = callbackDescription;
+}
+
+void GUI::RectangleBase::unregisterDamagedRegionCallback(void)
+{
+  m_damagedRegionCallback =
+  {
+    .functionPtr = nullptr,
+    .argument    = nullptr
+  };
 }
 
 void GUI::RectangleBase::draw(DrawHardware drawHardware)
 {
   if (isVisibleOnTheScreen())
   {
+    drawHardware = resolveDrawHardware(drawHardware);
     startDrawingTransaction(drawHardware);
 
     switch (drawHardware)
@@ -112,6 +187,18 @@ void GUI::RectangleBase::draw(DrawHardware drawHardware)
   }
 }
 
+GUI::ErrorCode GUI::RectangleBase::enqueueDMA2DDrawCommands(void)
+{
+  ErrorCode errorCode = ErrorCode::OK;
+
+  if (isVisibleOnTheScreen())
+  {
+    errorCode = enqueueDMA2DCommands();
+  }
+
+  return errorCode;
+}
+
 bool GUI::RectangleBase::isDrawCompleted(void) const
 {
   return m_isDrawingCompleted;
@@ -119,9 +206,16 @@ bool GUI::RectangleBase::isDrawCompleted(void) const
 
 GUI::ErrorCode GUI::RectangleBase::getDrawingTime(DrawHardware drawHardware, uint64_t &drawingTimeInUs) const
 {
-  const DrawingDurationInfo *drawingDurationInfoPtr = &m_drawingDurationInfo[static_cast<uint8_t>(drawHardware)];
   ErrorCode errorCode = GUI::ErrorCode::MEASUREMENT_NOT_AVAILABLE;
 
+  // drawing time is measured only per single draw hardware
+  if (DISTINCT_DRAW_HARDWARE_COUNT <= static_cast<uint8_t>(drawHardware))
+  {
+    return errorCode;
+  }
+
+  const DrawingDurationInfo *drawingDurationInfoPtr = &m_drawingDurationInfo[static_cast<uint8_t>(drawHardware)];
+
   if (drawingDurationInfoPtr->isDrawnAtLeastOnce)
   {
     drawingTimeInUs = calculateDrawingTime(drawingDurationInfoPtr);
@@ -169,44 +263,26 @@ void GUI::RectangleBase::unregisterTouchEventCallback(void)
 
 uint16_t GUI::RectangleBase::getVisiblePartWidth(void) const
 {
-  const int16_t frameBufferWidth = static_cast<int16_t>(m_frameBufferPtr->getWidth());
-  const Position topLeftCornerPosition = getPosition(Position::Tag::TOP_LEFT_CORNER);
-  const Position bottomRightCornerPosition = getPosition(Position::Tag::BOTTOM_RIGHT_CORNER);
-  int16_t visiblePartWidth = static_cast<int16_t>(m_rectangleBaseDescription.dimension.width);
-
-  if (0 > topLeftCornerPosition.x)
-  {
-    visiblePartWidth += topLeftCornerPosition.x;
-  }
-  else if (frameBufferWidth <= bottomRightCornerPosition.x)
-  {
-    visiblePartWidth = frameBufferWidth - topLeftCornerPosition.x;
-  }
-
-  visiblePartWidth = saturateValue(visiblePartWidth, static_cast<int16_t>(0), frameBufferWidth);
+  const Region clipRegion = getClipRegion();
+  const int32_t left  = saturateValue(static_cast<int32_t>(m_rectangleBaseDescription.position.x),
+    static_cast<int32_t>(clipRegion.x), clipRegion.getRight());
+  const int32_t right = saturateValue(
+    static_cast<int32_t>(m_rectangleBaseDescription.position.x) + m_rectangleBaseDescription.dimension.width,
+    static_cast<int32_t>(clipRegion.x), clipRegion.getRight());
 
-  return static_cast<uint16_t>(visiblePartWidth);
+  return static_cast<uint16_t>(right - left);
 }
 
 uint16_t GUI::RectangleBase::getVisiblePartHeight(void) const
 {
-  const int16_t frameBufferHeight = static_cast<int16_t>(m_frameBufferPtr->getHeight());
-  const Position topLeftCornerPosition = getPosition(Position::Tag::TOP_LEFT_CORNER);
-  const Position bottomRightCornerPosition = getPosition(Position::Tag::BOTTOM_RIGHT_CORNER);
-  int16_t visiblePartHeight = static_cast<int16_t>(m_rectangleBaseDescription.dimension.height);
-
-  if (0 > topLeftCornerPosition.y)
-  {
-    visiblePartHeight += topLeftCornerPosition.y;
-  }
-  else if (frameBufferHeight <= bottomRightCornerPosition.y)
-  {
-    visiblePartHeight = frameBufferHeight - topLeftCornerPosition.y;
-  }
-
-  visiblePartHeight = saturateValue(visiblePartHeight, static_cast<int16_t>(0), frameBufferHeight);
+  const Region clipRegion = getClipRegion();
+  const int32_t top    = saturateValue(static_cast<int32_t>(m_rectangleBaseDescription.position.y),
+    static_cast<int32_t>(clipRegion.y), clipRegion.getBottom());
+  const int32_t bottom = saturateValue(
+    static_cast<int32_t>(m_rectangleBaseDescription.position.y) + m_rectangleBaseDescription.dimension.height,
+    static_cast<int32_t>(clipRegion.y), clipRegion.getBottom());
 
-  return static_cast<uint16_t>(visiblePartHeight);
+  return static_cast<uint16_t>(bottom - top);
 }
 
 GUI::Dimension GUI::RectangleBase::getVisiblePartDimension(void) const
@@ -225,14 +301,20 @@ uint64_t GUI::RectangleBase::getVisiblePartArea(void) const
 
 GUI::Position GUI::RectangleBase::getVisiblePartPosition(Position::Tag positionTag) const
 {
+  const Region clipRegion = getClipRegion();
   Position position = getPosition(positionTag);
 
-  position.x = saturateValue(position.x, static_cast<int16_t>(0), static_cast<int16_t>(m_frameBufferPtr->getWidth() - 1u));
-  position.y = saturateValue(position.y, static_cast<int16_t>(0), static_cast<int16_t>(m_frameBufferPtr->getHeight() - 1u));
+  position.x = saturateValue(position.x, clipRegion.x, static_cast<int16_t>(clipRegion.getRight() - 1));
+  position.y = saturateValue(position.y, clipRegion.y, static_cast<int16_t>(clipRegion.getBottom() - 1));
 
   return position;
 }
 
+GUI::Region GUI::RectangleBase::getVisiblePartRegion(void) const
+{
+  return getRegion().getIntersection(getClipRegion());
+}
+
 inline GUI::Position GUI::RectangleBase::getPositionTopLeftCorner(void) const
 {
   return m_rectangleBaseDescription.position;
@@ -275,6 +357,43 @@ bool GUI::RectangleBase::isVisibleOnTheScreen(void) const
   return (0u != getVisiblePartWidth()) && (0u != getVisiblePartHeight());
 }
 
+GUI::DrawHardware GUI::RectangleBase::resolveDrawHardware(DrawHardware drawHardware) const
+{
+  switch (drawHardware)
+  {
+    case DrawHardware::AUTO:
+      drawHardware = getDrawCostModel().selectDrawHardware(getVisiblePartArea());
+      break;
+
+    // single object has nothing to split between CPU and DMA2D
+    case DrawHardware::HYBRID:
+      drawHardware = DrawHardware::DMA2D;
+      break;
+
+    default:
+      // leave it as it is
+      break;
+  }
+
+  // drawing is then measured as CPU drawing, so the DMA2D cost model never learns CPU drawing times
+  if ((DrawHardware::DMA2D == drawHardware) && (not canBeDrawnByDMA2D()))
+  {
+    drawHardware = DrawHardware::CPU;
+  }
+
+  return drawHardware;
+}
+
+bool GUI::RectangleBase::canBeDrawnByDMA2D(void) const
+{
+  return true;
+}
+
+GUI::DrawCostModel& GUI::RectangleBase::getDrawCostModel(void) const
+{
+  return s_drawCostModel;
+}
+
 void GUI::RectangleBase::startDrawingTransaction(DrawHardware drawHardware)
 {
   DrawingDurationInfo *drawingDurationInfoPtr = &m_drawingDurationInfo[static_cast<uint8_t>(drawHardware)];
@@ -292,6 +411,11 @@ void GUI::RectangleBase::endDrawingTransaction(DrawHardware drawHardware)
     m_sysTick.getElapsedTimeInUs(drawingDurationInfoPtr->drawStartTimestamp);
   drawingDurationInfoPtr->isDrawnAtLeastOnce = true;
   m_isDrawingCompleted                       = true;
+
+  getDrawCostModel().update(
+    drawHardware,
+    drawingDurationInfoPtr->lastDrawingVisiblePartArea,
+    drawingDurationInfoPtr->lastDrawingDurationInUs);
 }
 
 uint64_t GUI::RectangleBase::calculateDrawingTime(const DrawingDurationInfo *drawingDurationInfoPtr) const
@@ -311,6 +435,14 @@ void GUI::RectangleBase::callDrawCompletedCallbackIfRegistered(void)
   }
 }
 
+void GUI::RectangleBase::reportDamagedRegion(const Region &region)
+{
+  if ((nullptr != m_damagedRegionCallback.functionPtr) && (not region.isEmpty()))
+  {
+    m_damagedRegionCallback.functionPtr(m_damagedRegionCallback.argument, region);
+  }
+}
+
 void GUI::RectangleBase::recalculatePositionToBeTopLeftCorner(RectangleBaseDescription &rectangleDescription)
 {
   switch (rectangleDescription.position.tag)
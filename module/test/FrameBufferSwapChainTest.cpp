@@ -0,0 +1,94 @@
+#include "FrameBufferSwapChain.h"
+#include "FrameBuffer.h"
+#include "LTDCMock.h"
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <cstdint>
+
+
+using namespace ::testing;
+
+
+class AFrameBufferSwapChain : public Test
+{
+public:
+
+  NiceMock<LTDCMock> ltdcMock;
+  FrameBuffer<10u, 10u, IFrameBuffer::ColorFormat::RGB888> frameBuffer1;
+  FrameBuffer<10u, 10u, IFrameBuffer::ColorFormat::RGB888> frameBuffer2;
+  FrameBufferSwapChain frameBufferSwapChain = FrameBufferSwapChain(ltdcMock, frameBuffer1, frameBuffer2);
+
+  void setLTDCReloadOngoingStateTo(bool isReloadOngoing);
+};
+
+void AFrameBufferSwapChain::setLTDCReloadOngoingStateTo(bool isReloadOngoing)
+{
+  ON_CALL(ltdcMock, isReloadOngoing())
+    .WillByDefault(Return(isReloadOngoing));
+}
+
+
+TEST_F(AFrameBufferSwapChain, FirstFrameBufferIsFrontBufferAndSecondOneIsBackBufferAfterConstruction)
+{
+  ASSERT_THAT(frameBufferSwapChain.getFrontBuffer(), Eq(std::ref(frameBuffer1)));
+  ASSERT_THAT(frameBufferSwapChain.getBackBuffer(), Eq(std::ref(frameBuffer2)));
+}
+
+TEST_F(AFrameBufferSwapChain, PresentSwapsFrontAndBackBuffer)
+{
+  const FrameBufferSwapChain::ErrorCode errorCode = frameBufferSwapChain.present();
+
+  ASSERT_THAT(errorCode, Eq(FrameBufferSwapChain::ErrorCode::OK));
+  ASSERT_THAT(frameBufferSwapChain.getFrontBuffer(), Eq(std::ref(frameBuffer2)));
+  ASSERT_THAT(frameBufferSwapChain.getBackBuffer(), Eq(std::ref(frameBuffer1)));
+}
+
+TEST_F(AFrameBufferSwapChain, PresentSetsLTDCLayerFrameBufferAddressToBackBufferAndThenReloadsItOnVerticalBlank)
+{
+  InSequence sequence;
+  EXPECT_CALL(ltdcMock, setFrameBufferAddress(LTDC::Layer::LAYER1, frameBuffer2.getPointer()))
+    .Times(1u);
+  EXPECT_CALL(ltdcMock, reloadOnVerticalBlank())
+    .Times(1u);
+
+  frameBufferSwapChain.present();
+}
+
+TEST_F(AFrameBufferSwapChain, PresentWithImmediateReloadModeSetsLTDCLayerFrameBufferAddressToBackBufferAndThenReloadsItImmediately)
+{
+  InSequence sequence;
+  EXPECT_CALL(ltdcMock, setFrameBufferAddress(LTDC::Layer::LAYER1, frameBuffer2.getPointer()))
+    .Times(1u);
+  EXPECT_CALL(ltdcMock, reloadImmediately())
+    .Times(1u);
+  EXPECT_CALL(ltdcMock, reloadOnVerticalBlank())
+    .Times(0u);
+
+  frameBufferSwapChain.present(FrameBufferSwapChain::ReloadMode::IMMEDIATE);
+}
+
+TEST_F(AFrameBufferSwapChain, PresentFailsIfPreviouslyPresentedFrameBufferIsStillNotLatchedByLTDC)
+{
+  setLTDCReloadOngoingStateTo(true);
+  EXPECT_CALL(ltdcMock, setFrameBufferAddress(_, _))
+    .Times(0u);
+
+  const FrameBufferSwapChain::ErrorCode errorCode = frameBufferSwapChain.present();
+
+  ASSERT_THAT(errorCode, Eq(FrameBufferSwapChain::ErrorCode::PRESENT_ALREADY_PENDING));
+  ASSERT_THAT(frameBufferSwapChain.getFrontBuffer(), Eq(std::ref(frameBuffer1)));
+}
+
+TEST_F(AFrameBufferSwapChain, IsBackBufferAvailableReturnsFalseWhileLTDCReloadIsOngoing)
+{
+  setLTDCReloadOngoingStateTo(true);
+
+  ASSERT_THAT(frameBufferSwapChain.isBackBufferAvailable(), Eq(false));
+}
+
+TEST_F(AFrameBufferSwapChain, IsBackBufferAvailableReturnsTrueWhenLTDCReloadIsFinished)
+{
+  setLTDCReloadOngoingStateTo(false);
+
+  ASSERT_THAT(frameBufferSwapChain.isBackBufferAvailable(), Eq(true));
+}
\ No newline at end of file
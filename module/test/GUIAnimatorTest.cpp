@@ -0,0 +1,246 @@
+#include "GUIAnimator.h"
+#include "GUIRectangle.h"
+#include "FrameBuffer.h"
+#include "DMA2DMock.h"
+#include "SysTickMock.h"
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <cstdint>
+
+
+using namespace ::testing;
+
+
+class AGUIAnimator : public Test
+{
+public:
+
+  NiceMock<DMA2DMock> dma2dMock;
+  NiceMock<SysTickMock> sysTickMock;
+  FrameBuffer<50u, 50u, IFrameBuffer::ColorFormat::RGB888> frameBuffer;
+  GUI::Rectangle guiRectangle = GUI::Rectangle(dma2dMock, sysTickMock, frameBuffer);
+  GUI::Animator animator = GUI::Animator(sysTickMock);
+
+  uint64_t ticks = 0u;
+
+  const GUI::Position startPosition = { .x = 0, .y = 10, .tag = GUI::Position::Tag::TOP_LEFT_CORNER };
+  const GUI::Position endPosition   = { .x = 100, .y = 10, .tag = GUI::Position::Tag::TOP_LEFT_CORNER };
+
+  GUI::Animator::AnimationDescription linearAnimationDescription =
+  {
+    .durationInMs = 1000u,
+    .easing       = GUI::Animator::Easing::LINEAR,
+    .repeat       = GUI::Animator::Repeat::ONCE
+  };
+
+  int16_t getRectangleX(void) const;
+
+  void SetUp() override;
+};
+
+int16_t AGUIAnimator::getRectangleX(void) const
+{
+  return guiRectangle.getPosition(GUI::Position::Tag::TOP_LEFT_CORNER).x;
+}
+
+void AGUIAnimator::SetUp()
+{
+  // one tick is one millisecond
+  ON_CALL(sysTickMock, getTicksPerSecond())
+    .WillByDefault(Return(1000u));
+  ON_CALL(sysTickMock, getTicks())
+    .WillByDefault([&](void)
+    {
+      return ticks;
+    });
+
+  guiRectangle.init(
+  {
+    .baseDescription =
+    {
+      .dimension = { .width = 10u, .height = 10u },
+      .position  = startPosition
+    },
+    .color = { .red = 0u, .green = 0u, .blue = 0u }
+  });
+}
+
+
+TEST_F(AGUIAnimator, UpdateMovesObjectAccordingToElapsedTimeRegardlessOfNumberOfUpdates)
+{
+  animator.animatePosition(guiRectangle, startPosition, endPosition, linearAnimationDescription);
+
+  ticks = 250u;
+  animator.update();
+  const int16_t xAfterQuarterOfDuration = getRectangleX();
+  ticks = 900u;
+  animator.update();
+
+  ASSERT_THAT(xAfterQuarterOfDuration, Eq(25));
+  ASSERT_THAT(getRectangleX(), Eq(90));
+}
+
+TEST_F(AGUIAnimator, AnimationRepeatedOnceEndsExactlyAtEndValueEvenIfDurationIsExceeded)
+{
+  animator.animatePosition(guiRectangle, startPosition, endPosition, linearAnimationDescription);
+
+  ticks = 1500u;
+  animator.update();
+
+  ASSERT_THAT(getRectangleX(), Eq(100));
+  ASSERT_THAT(animator.isAnimating(), Eq(false));
+}
+
+TEST_F(AGUIAnimator, LoopAnimationStartsFromStartValueInEachCycle)
+{
+  linearAnimationDescription.repeat = GUI::Animator::Repeat::LOOP;
+  animator.animatePosition(guiRectangle, startPosition, endPosition, linearAnimationDescription);
+
+  ticks = 1250u;
+  animator.update();
+
+  ASSERT_THAT(getRectangleX(), Eq(25));
+  ASSERT_THAT(animator.isAnimating(), Eq(true));
+}
+
+TEST_F(AGUIAnimator, PingPongAnimationRunsFromEndValueBackToStartValueInOddCycles)
+{
+  linearAnimationDescription.repeat = GUI::Animator::Repeat::PING_PONG;
+  animator.animatePosition(guiRectangle, startPosition, endPosition, linearAnimationDescription);
+
+  ticks = 1250u;
+  animator.update();
+
+  ASSERT_THAT(getRectangleX(), Eq(75));
+}
+
+TEST_F(AGUIAnimator, AnimationWithStartOffsetStartsFromValueReachedAfterOffset)
+{
+  linearAnimationDescription.startOffsetInMs = 400u;
+  animator.animatePosition(guiRectangle, startPosition, endPosition, linearAnimationDescription);
+
+  animator.update();
+  const int16_t xAtStart = getRectangleX();
+  ticks = 100u;
+  animator.update();
+
+  ASSERT_THAT(xAtStart, Eq(40));
+  ASSERT_THAT(getRectangleX(), Eq(50));
+}
+
+TEST_F(AGUIAnimator, PingPongAnimationWithStartOffsetRunsToEndValueAndThenBackToStartValue)
+{
+  linearAnimationDescription.repeat          = GUI::Animator::Repeat::PING_PONG;
+  linearAnimationDescription.startOffsetInMs = 500u;
+  animator.animatePosition(guiRectangle, startPosition, endPosition, linearAnimationDescription);
+
+  ticks = 500u;
+  animator.update();
+  const int16_t xAtEndOfFirstLeg = getRectangleX();
+  ticks = 1500u;
+  animator.update();
+
+  ASSERT_THAT(xAtEndOfFirstLeg, Eq(100));
+  ASSERT_THAT(getRectangleX(), Eq(0));
+}
+
+TEST_F(AGUIAnimator, EasingCurvesStartAtZeroAndEndAtOne)
+{
+  for (uint8_t easingIdx = 0u; easingIdx < static_cast<uint8_t>(GUI::Animator::Easing::COUNT); ++easingIdx)
+  {
+    const GUI::Animator::Easing easing = static_cast<GUI::Animator::Easing>(easingIdx);
+
+    ASSERT_THAT(GUI::Animator::ease(easing, 0u), Eq(0u));
+    ASSERT_THAT(GUI::Animator::ease(easing, GUI::Animator::PROGRESS_ONE), Eq(GUI::Animator::PROGRESS_ONE));
+  }
+}
+
+TEST_F(AGUIAnimator, EaseInIsSlowerAndEaseOutIsFasterThanLinearInTheMiddleOfAnimation)
+{
+  constexpr uint32_t HALF = GUI::Animator::PROGRESS_ONE / 2u;
+
+  ASSERT_THAT(GUI::Animator::ease(GUI::Animator::Easing::EASE_IN, HALF), Eq(HALF / 2u));
+  ASSERT_THAT(GUI::Animator::ease(GUI::Animator::Easing::EASE_OUT, HALF), Eq(HALF + HALF / 2u));
+  ASSERT_THAT(GUI::Animator::ease(GUI::Animator::Easing::EASE_IN_OUT, HALF), Eq(HALF));
+}
+
+TEST_F(AGUIAnimator, ColorSetterIsCalledOnlyIfInterpolatedColorIsChanged)
+{
+  uint32_t colorSetterCallCount = 0u;
+  animator.animateColor(
+  {
+    .functionPtr = [](void *argument, GUI::Color)
+    {
+      ++(*reinterpret_cast<uint32_t*>(argument));
+    },
+    .argument = &colorSetterCallCount
+  },
+  { .red = 0u, .green = 0u, .blue = 0u },
+  { .red = 200u, .green = 100u, .blue = 0u },
+  linearAnimationDescription);
+
+  ticks = 500u;
+  animator.update();
+  animator.update();
+
+  ASSERT_THAT(colorSetterCallCount, Eq(1u));
+}
+
+TEST_F(AGUIAnimator, OpacitySetterIsCalledWithInterpolatedOpacity)
+{
+  uint8_t opacity = 0u;
+  animator.animateOpacity(
+  {
+    .functionPtr = [](void *argument, uint8_t opacity)
+    {
+      *reinterpret_cast<uint8_t*>(argument) = opacity;
+    },
+    .argument = &opacity
+  },
+  0u, 200u, linearAnimationDescription);
+
+  ticks = 250u;
+  animator.update();
+
+  ASSERT_THAT(opacity, Eq(50u));
+}
+
+TEST_F(AGUIAnimator, TimeOfAnimationsDoesNotPassWhileAnimatorIsPaused)
+{
+  animator.animatePosition(guiRectangle, startPosition, endPosition, linearAnimationDescription);
+  ticks = 250u;
+  animator.pause();
+  ticks = 750u;
+  animator.update();
+  const int16_t xWhilePaused = getRectangleX();
+
+  animator.resume();
+  ticks = 1000u;
+  animator.update();
+
+  ASSERT_THAT(xWhilePaused, Eq(startPosition.x));
+  ASSERT_THAT(getRectangleX(), Eq(50));
+}
+
+TEST_F(AGUIAnimator, StopStopsAllAnimationsOfTheObject)
+{
+  animator.animatePosition(guiRectangle, startPosition, endPosition, linearAnimationDescription);
+
+  animator.stop(&guiRectangle);
+  ticks = 500u;
+  animator.update();
+
+  ASSERT_THAT(getRectangleX(), Eq(startPosition.x));
+  ASSERT_THAT(animator.isAnimating(), Eq(false));
+}
+
+TEST_F(AGUIAnimator, AnimateFailsIfMaximumNumberOfAnimationsIsRunning)
+{
+  for (uint32_t i = 0u; i < GUI::Animator::MAX_ANIMATION_COUNT; ++i)
+  {
+    animator.animatePosition(guiRectangle, startPosition, endPosition, linearAnimationDescription);
+  }
+
+  ASSERT_THAT(animator.animatePosition(guiRectangle, startPosition, endPosition, linearAnimationDescription),
+    Eq(GUI::ErrorCode::ANIMATOR_FULL_ERROR));
+}
\ No newline at end of file
@@ -0,0 +1,163 @@
+#include "GUIBlitter.h"
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <cstdint>
+#include <cstring>
+
+
+using namespace ::testing;
+
+
+class AGUIBlitter : public Test
+{
+public:
+
+  static constexpr uint32_t NUMBER_OF_PIXELS = 256u * 16u;
+
+  uint8_t m_sourceRow[4u * NUMBER_OF_PIXELS];
+  uint8_t m_destinationRow[3u * NUMBER_OF_PIXELS];
+  uint8_t m_expectedDestinationRow[3u * NUMBER_OF_PIXELS];
+
+  void initRowsWithPseudoRandomContent(void);
+  void blendRowWithReferenceImplementation(uint8_t *destinationPtr, const uint8_t *sourcePtr, uint32_t numberOfPixels);
+
+  void SetUp() override;
+};
+
+void AGUIBlitter::SetUp()
+{
+  initRowsWithPseudoRandomContent();
+}
+
+void AGUIBlitter::initRowsWithPseudoRandomContent(void)
+{
+  uint32_t state = 0x12345678u;
+  auto nextValue = [&state](void)
+  {
+    state = state * 1664525u + 1013904223u;
+    return static_cast<uint8_t>(state >> 24u);
+  };
+
+  for (uint32_t i = 0u; i < NUMBER_OF_PIXELS; ++i)
+  {
+    m_sourceRow[4u * i]      = nextValue();
+    m_sourceRow[4u * i + 1u] = nextValue();
+    m_sourceRow[4u * i + 2u] = nextValue();
+    // every alpha value is covered, including fully transparent and fully opaque pixels
+    m_sourceRow[4u * i + 3u] = static_cast<uint8_t>(i);
+
+    m_destinationRow[3u * i]      = nextValue();
+    m_destinationRow[3u * i + 1u] = nextValue();
+    m_destinationRow[3u * i + 2u] = nextValue();
+  }
+
+  std::memcpy(m_expectedDestinationRow, m_destinationRow, sizeof(m_destinationRow));
+}
+
+void AGUIBlitter::blendRowWithReferenceImplementation(
+  uint8_t *destinationPtr,
+  const uint8_t *sourcePtr,
+  uint32_t numberOfPixels)
+{
+  uint32_t sourceIdx = 0u;
+  for (uint32_t destinationIdx = 0u; destinationIdx < (3u * numberOfPixels);)
+  {
+    const uint32_t alpha = sourcePtr[sourceIdx + 3];
+
+    destinationPtr[destinationIdx] = (alpha * sourcePtr[sourceIdx++] + (255u - alpha) * destinationPtr[destinationIdx]) / 255u;
+    ++destinationIdx;
+    destinationPtr[destinationIdx] = (alpha * sourcePtr[sourceIdx++] + (255u - alpha) * destinationPtr[destinationIdx]) / 255u;
+    ++destinationIdx;
+    destinationPtr[destinationIdx] = (alpha * sourcePtr[sourceIdx++] + (255u - alpha) * destinationPtr[destinationIdx]) / 255u;
+    ++destinationIdx;
+
+    // skip alpha
+    ++sourceIdx;
+  }
+}
+
+
+TEST_F(AGUIBlitter, DivideBy255IsExactForEveryValueWhichCanBeResultOfBlending)
+{
+  for (uint32_t value = 0u; value <= (255u * 255u); ++value)
+  {
+    ASSERT_THAT(GUI::Blitter::divideBy255(value), Eq(value / 255u));
+  }
+}
+
+TEST_F(AGUIBlitter, BlendRowARGB8888ToRGB888IsBitExactToReferenceBlendLoop)
+{
+  blendRowWithReferenceImplementation(m_expectedDestinationRow, m_sourceRow, NUMBER_OF_PIXELS);
+
+  GUI::Blitter::blendRowARGB8888ToRGB888(m_destinationRow, m_sourceRow, NUMBER_OF_PIXELS);
+
+  ASSERT_THAT(std::memcmp(m_destinationRow, m_expectedDestinationRow, sizeof(m_destinationRow)), Eq(0));
+}
+
+TEST_F(AGUIBlitter, BlendRowARGB8888ToRGB888DoesNotChangePixelsBehindFullyTransparentPixels)
+{
+  m_sourceRow[3] = 0u;
+
+  GUI::Blitter::blendRowARGB8888ToRGB888(m_destinationRow, m_sourceRow, 1u);
+
+  ASSERT_THAT(std::memcmp(m_destinationRow, m_expectedDestinationRow, 3u), Eq(0));
+}
+
+TEST_F(AGUIBlitter, BlendRowARGB8888ToRGB888CopiesFullyOpaquePixels)
+{
+  m_sourceRow[3] = 255u;
+
+  GUI::Blitter::blendRowARGB8888ToRGB888(m_destinationRow, m_sourceRow, 1u);
+
+  ASSERT_THAT(std::memcmp(m_destinationRow, m_sourceRow, 3u), Eq(0));
+}
+
+TEST_F(AGUIBlitter, BlendRowARGB8888ToRGB888DoesNotTouchPixelsAfterTheLastOne)
+{
+  constexpr uint32_t NUMBER_OF_BLENDED_PIXELS = 7u;
+  for (uint32_t i = 0u; i < NUMBER_OF_BLENDED_PIXELS; ++i)
+  {
+    m_sourceRow[4u * i + 3u] = 255u;
+  }
+
+  GUI::Blitter::blendRowARGB8888ToRGB888(m_destinationRow, m_sourceRow, NUMBER_OF_BLENDED_PIXELS);
+
+  ASSERT_THAT(std::memcmp(&m_destinationRow[3u * NUMBER_OF_BLENDED_PIXELS],
+    &m_expectedDestinationRow[3u * NUMBER_OF_BLENDED_PIXELS],
+    sizeof(m_destinationRow) - 3u * NUMBER_OF_BLENDED_PIXELS), Eq(0));
+}
+
+TEST_F(AGUIBlitter, CopyRowRGB888CopiesOnlyGivenNumberOfPixels)
+{
+  constexpr uint32_t NUMBER_OF_COPIED_PIXELS = 13u;
+  const uint8_t *sourcePtr = &m_sourceRow[1];
+
+  GUI::Blitter::copyRowRGB888(m_destinationRow, sourcePtr, NUMBER_OF_COPIED_PIXELS);
+
+  ASSERT_THAT(std::memcmp(m_destinationRow, sourcePtr, 3u * NUMBER_OF_COPIED_PIXELS), Eq(0));
+  ASSERT_THAT(m_destinationRow[3u * NUMBER_OF_COPIED_PIXELS], Eq(m_expectedDestinationRow[3u * NUMBER_OF_COPIED_PIXELS]));
+}
+
+TEST_F(AGUIBlitter, FillRowRGB888FillsRowWithColorForEveryStartAlignmentAndRowLength)
+{
+  const GUI::Color COLOR = { .red = 0x11u, .green = 0x22u, .blue = 0x33u };
+
+  for (uint32_t startOffset = 0u; startOffset < 4u; ++startOffset)
+  {
+    for (uint32_t numberOfPixels = 0u; numberOfPixels < 20u; ++numberOfPixels)
+    {
+      initRowsWithPseudoRandomContent();
+      uint8_t *rowPtr = &m_destinationRow[startOffset];
+      for (uint32_t i = 0u; i < numberOfPixels; ++i)
+      {
+        m_expectedDestinationRow[startOffset + 3u * i]      = COLOR.blue;
+        m_expectedDestinationRow[startOffset + 3u * i + 1u] = COLOR.green;
+        m_expectedDestinationRow[startOffset + 3u * i + 2u] = COLOR.red;
+      }
+
+      GUI::Blitter::fillRowRGB888(rowPtr, COLOR, numberOfPixels);
+
+      ASSERT_THAT(std::memcmp(m_destinationRow, m_expectedDestinationRow, sizeof(m_destinationRow)), Eq(0));
+    }
+  }
+}
\ No newline at end of file
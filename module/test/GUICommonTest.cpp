@@ -281,4 +281,115 @@ TEST(GUIColor, IsNotEqualToAnotherGUIColorIfTheirBlueComponentsAreNotTheSame)
   ASSERT_THAT(color1.green, Eq(color2.green));
   ASSERT_THAT(color1.blue, Ne(color2.blue));
   ASSERT_THAT(color1, Ne(color2));
+}
+TEST(GUIColor, ToRGB565PacksUpperBitsOfEachColorComponentIntoSixteenBitPixel)
+{
+  const GUI::Color color =
+  {
+    .red   = 0b10101111u,
+    .green = 0b11001101u,
+    .blue  = 0b01010111u
+  };
+
+  ASSERT_THAT(color.toRGB565(), Eq(0b1010111001101010u));
+}
+
+TEST(GUIColor, FromRGB565ExpandsColorComponentsToEightBitsByReplicatingTheirUpperBits)
+{
+  ASSERT_THAT(GUI::Color::fromRGB565(0xFFFFu), Eq(GUI::Color{ .red = 255u, .green = 255u, .blue = 255u }));
+  ASSERT_THAT(GUI::Color::fromRGB565(0x0000u), Eq(GUI::Color{ .red = 0u, .green = 0u, .blue = 0u }));
+  ASSERT_THAT(GUI::Color::fromRGB565(0b1010111001101010u),
+    Eq(GUI::Color{ .red = 0b10101101u, .green = 0b11001111u, .blue = 0b01010010u }));
+}
+
+TEST(GUIColor, ConversionFromRGB565AndBackToRGB565IsLossless)
+{
+  for (uint32_t pixel = 0u; pixel <= UINT16_MAX; ++pixel)
+  {
+    ASSERT_THAT(GUI::Color::fromRGB565(static_cast<uint16_t>(pixel)).toRGB565(), Eq(pixel));
+  }
+}
+
+TEST(GUIRegion, IsEmptyIfEitherWidthOrHeightIsZero)
+{
+  const GUI::Region region1 = { .x = 10, .y = 10, .width = 0u,  .height = 20u };
+  const GUI::Region region2 = { .x = 10, .y = 10, .width = 20u, .height = 0u };
+  const GUI::Region region3 = { .x = 10, .y = 10, .width = 20u, .height = 20u };
+
+  ASSERT_THAT(region1.isEmpty(), Eq(true));
+  ASSERT_THAT(region2.isEmpty(), Eq(true));
+  ASSERT_THAT(region3.isEmpty(), Eq(false));
+}
+
+TEST(GUIRegion, GetIntersectionReturnsCommonPartOfTwoOverlappingRegions)
+{
+  const GUI::Region region1 = { .x = -10, .y = 5, .width = 30u, .height = 20u };
+  const GUI::Region region2 = { .x = 5,   .y = 0, .width = 50u, .height = 10u };
+  const GUI::Region EXPECTED_INTERSECTION = { .x = 5, .y = 5, .width = 15u, .height = 5u };
+
+  ASSERT_THAT(region1.getIntersection(region2), Eq(EXPECTED_INTERSECTION));
+  ASSERT_THAT(region2.getIntersection(region1), Eq(EXPECTED_INTERSECTION));
+}
+
+TEST(GUIRegion, GetIntersectionReturnsEmptyRegionIfRegionsOnlyTouchEachOther)
+{
+  const GUI::Region region1 = { .x = 0,  .y = 0, .width = 10u, .height = 10u };
+  const GUI::Region region2 = { .x = 10, .y = 0, .width = 10u, .height = 10u };
+
+  ASSERT_THAT(region1.getIntersection(region2).isEmpty(), Eq(true));
+  ASSERT_THAT(region1.doesOverlap(region2), Eq(false));
+}
+
+TEST(GUIRegion, GetUnionReturnsSmallestRegionWhichContainsBothRegions)
+{
+  const GUI::Region region1 = { .x = 0,  .y = 10, .width = 10u, .height = 10u };
+  const GUI::Region region2 = { .x = 30, .y = -5, .width = 5u,  .height = 5u };
+  const GUI::Region EXPECTED_UNION = { .x = 0, .y = -5, .width = 35u, .height = 25u };
+
+  ASSERT_THAT(region1.getUnion(region2), Eq(EXPECTED_UNION));
+  ASSERT_THAT(EXPECTED_UNION.doesContain(region1), Eq(true));
+  ASSERT_THAT(EXPECTED_UNION.doesContain(region2), Eq(true));
+}
+
+TEST(GUIRegion, GetUnionIgnoresEmptyRegion)
+{
+  const GUI::Region region1 = { .x = 0,   .y = 10,  .width = 10u, .height = 10u };
+  const GUI::Region region2 = { .x = 100, .y = 100, .width = 0u,  .height = 0u };
+
+  ASSERT_THAT(region1.getUnion(region2), Eq(region1));
+  ASSERT_THAT(region2.getUnion(region1), Eq(region1));
+}
+
+TEST(GUIRegion, GetDifferenceReturnsEmptyRegionIfRegionIsCompletelyCovered)
+{
+  const GUI::Region region1 = { .x = 10, .y = 10, .width = 10u, .height = 10u };
+  const GUI::Region region2 = { .x = 0,  .y = 0,  .width = 50u, .height = 50u };
+
+  ASSERT_THAT(region1.getDifference(region2).isEmpty(), Eq(true));
+}
+
+TEST(GUIRegion, GetDifferenceCropsRowsCoveredByRegionWhichSpansWholeWidth)
+{
+  const GUI::Region region1 = { .x = 10, .y = 10, .width = 10u, .height = 20u };
+  const GUI::Region region2 = { .x = 0,  .y = 0,  .width = 50u, .height = 15u };
+  const GUI::Region EXPECTED_DIFFERENCE = { .x = 10, .y = 15, .width = 10u, .height = 15u };
+
+  ASSERT_THAT(region1.getDifference(region2), Eq(EXPECTED_DIFFERENCE));
+}
+
+TEST(GUIRegion, GetDifferenceCropsColumnsCoveredByRegionWhichSpansWholeHeight)
+{
+  const GUI::Region region1 = { .x = 10, .y = 10, .width = 20u, .height = 10u };
+  const GUI::Region region2 = { .x = 25, .y = 0,  .width = 50u, .height = 50u };
+  const GUI::Region EXPECTED_DIFFERENCE = { .x = 10, .y = 10, .width = 15u, .height = 10u };
+
+  ASSERT_THAT(region1.getDifference(region2), Eq(EXPECTED_DIFFERENCE));
+}
+
+TEST(GUIRegion, GetDifferenceReturnsRegionUnchangedIfUncoveredPartIsNotRectangular)
+{
+  const GUI::Region region1 = { .x = 0,  .y = 0,  .width = 30u, .height = 30u };
+  const GUI::Region region2 = { .x = 10, .y = 10, .width = 10u, .height = 10u };
+
+  ASSERT_THAT(region1.getDifference(region2), Eq(region1));
 }
\ No newline at end of file
@@ -1,10 +1,15 @@
 #include "GUIContainer.h"
 #include "ArrayList.h"
 #include "FrameBuffer.h"
+#include "TileFrameBuffer.h"
+#include "GUIRectangle.h"
 #include "GUIObjectMock.h"
+#include "DMA2DMock.h"
+#include "SysTickMock.h"
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include <cstdint>
+#include <cstring>
 
 
 using namespace ::testing;
@@ -22,6 +27,13 @@ public:
     .x = 10,
     .y = 10
   };
+  const GUI::Region FRAME_BUFFER_REGION =
+  {
+    .x      = 0,
+    .y      = 0,
+    .width  = 50u,
+    .height = 50u
+  };
   const GUI::TouchEvent ONE_TOUCH_POINT_TOUCH_EVENT =
     GUI::TouchEvent(40u, GUI::TouchEvent::Type::TOUCH_MOVE);
   const GUI::TouchEvent NO_TOUCH_POINTS_TOUCH_EVENT =
@@ -36,6 +48,11 @@ public:
   ArrayList<GUI::Container::ObjectInfo,5u> guiContainerObjectInfoList;
   FrameBuffer<50u, 50u, IFrameBuffer::ColorFormat::RGB888> frameBuffer;
   GUI::Container guiContainer = GUI::Container(guiContainerObjectInfoList, frameBuffer);
+  NiceMock<DMA2DMock> dma2dMock;
+  ArrayList<GUI::Container::ObjectInfo,5u> guiContainerWithDMA2DObjectInfoList;
+  GUI::Container guiContainerWithDMA2D = GUI::Container(guiContainerWithDMA2DObjectInfoList, frameBuffer, dma2dMock);
+  DMA2D::CallbackDescription dma2dCommandQueueCompletedCallback;
+  TileFrameBuffer<50u, 50u, 20u, IFrameBuffer::ColorFormat::RGB888> tileFrameBuffer;
 
   GUI::Container::CallbackDescription callbackDescription;
   ArrayList<GUI::Point,2u> touchPoints;
@@ -70,11 +87,14 @@ public:
   void expectThatObjectWillBeNotified(GUIObjectMock &guiObjectMock, GUI::TouchEvent touchEvent);
   void expectThatObjectWillNotBeNotified(GUIObjectMock &guiObjectMock);
   void onCallOfDoesContainPointReturn(GUIObjectMock &guiObjectMock, bool returnValue);
+  void onCallOfGetRegionReturn(GUIObjectMock &guiObjectMock, GUI::Region region);
   void setupGetCPUDrawingTimeReadingForContainerObjects(GUI::Container &guiContainer);
   void setupGetDMA2DDrawingTimeReadingForContainerObjects(GUI::Container &guiContainer);
   void assertThatDrawingTimeIsEqualToExpectedOne(uint64_t drawingTimeInUs);
   void assertThatCallbackIsNotCalled(void);
   void assertThatCallbackIsCalled(void);
+  void captureDMA2DCommandQueueCompletedCallback(void);
+  void simulateDMA2DCommandQueueCompleted(void);
 
   void SetUp() override;
 };
@@ -99,6 +119,21 @@ void AGUIContainer::SetUp()
   const_cast<IArrayList<GUI::Point>&>(TWO_TOUCH_POINT_TOUCH_EVENT.getTouchPoints()).addElement(RANDOM_GUI_POINT);
 }
 
+void AGUIContainer::captureDMA2DCommandQueueCompletedCallback(void)
+{
+  ON_CALL(dma2dMock, executeCommandQueue(_))
+    .WillByDefault([&](const DMA2D::CallbackDescription &callbackDescription)
+    {
+      dma2dCommandQueueCompletedCallback = callbackDescription;
+      return DMA2D::ErrorCode::OK;
+    });
+}
+
+void AGUIContainer::simulateDMA2DCommandQueueCompleted(void)
+{
+  dma2dCommandQueueCompletedCallback.functionPtr(dma2dCommandQueueCompletedCallback.argument);
+}
+
 void AGUIContainer::addNRandomIGUIObjectsIntoIGUIContainer(GUI::Container &guiContainer, uint32_t numberOfIGUIObjects)
 {
   for (uint32_t i = 0u; i < numberOfIGUIObjects; ++i)
@@ -256,6 +291,12 @@ void AGUIContainer::onCallOfDoesContainPointReturn(GUIObjectMock &guiObjectMock,
     .WillByDefault(Return(returnValue));
 }
 
+void AGUIContainer::onCallOfGetRegionReturn(GUIObjectMock &guiObjectMock, GUI::Region region)
+{
+  ON_CALL(guiObjectMock, getRegion())
+    .WillByDefault(Return(region));
+}
+
 void AGUIContainer::setupGUIObjectGetDrawingTimeReadings(
   GUIObjectMock &guiObjectMock,
   GUI::DrawHardware drawHardware,
@@ -747,17 +788,18 @@ TEST_F(AGUIContainer, GetDrawingTimeWithDMA2DReturnsSumOfAllContainerObjectsDMA2
   ASSERT_THAT(errorCode, Eq(GUI::ErrorCode::OK));
 }
 
-TEST_F(AGUIContainer, GetDrawingTimeWithCPUFailsIfDrawingTimeOfAnyGUIContainerObjectsIsNotAvailable)
+TEST_F(AGUIContainer, GetDrawingTimeWithCPUFailsIfDrawingTimeOfNoneOfGUIContainerObjectsIsAvailable)
 {
   guiContainer.addObject(&guiObjectMock1, 30u);
   guiContainer.addObject(&guiObjectMock2, 1u);
-  setupGetCPUDrawingTimeReadingForContainerObjects(guiContainer);
-  guiContainer.addObject(&guiObjectMock3, 50u);
-  setupGUIObjectGetDrawingTimeReadings(
-    guiObjectMock3,
-    GUI::DrawHardware::CPU,
-    0u,
-    GUI::ErrorCode::MEASUREMENT_NOT_AVAILABLE);
+  for (GUIObjectMock *guiObjectMockPtr : { &guiObjectMock1, &guiObjectMock2 })
+  {
+    setupGUIObjectGetDrawingTimeReadings(
+      *guiObjectMockPtr,
+      GUI::DrawHardware::CPU,
+      0u,
+      GUI::ErrorCode::MEASUREMENT_NOT_AVAILABLE);
+  }
 
   uint64_t drawingTimeInUs;
   GUI::ErrorCode errorCode = guiContainer.getDrawingTime(GUI::DrawHardware::CPU, drawingTimeInUs);
@@ -765,17 +807,18 @@ TEST_F(AGUIContainer, GetDrawingTimeWithCPUFailsIfDrawingTimeOfAnyGUIContainerOb
   ASSERT_THAT(errorCode, Eq(GUI::ErrorCode::MEASUREMENT_NOT_AVAILABLE));
 }
 
-TEST_F(AGUIContainer, GetDrawingTimeWithDMA2DFailsIfDrawingTimeOfAnyGUIContainerObjectsIsNotAvailable)
+TEST_F(AGUIContainer, GetDrawingTimeWithDMA2DFailsIfDrawingTimeOfNoneOfGUIContainerObjectsIsAvailable)
 {
   guiContainer.addObject(&guiObjectMock1, 20u);
   guiContainer.addObject(&guiObjectMock2, 100u);
-  setupGetDMA2DDrawingTimeReadingForContainerObjects(guiContainer);
-  guiContainer.addObject(&guiObjectMock3, 70u);
-  setupGUIObjectGetDrawingTimeReadings(
-    guiObjectMock3,
-    GUI::DrawHardware::DMA2D,
-    0u,
-    GUI::ErrorCode::MEASUREMENT_NOT_AVAILABLE);
+  for (GUIObjectMock *guiObjectMockPtr : { &guiObjectMock1, &guiObjectMock2 })
+  {
+    setupGUIObjectGetDrawingTimeReadings(
+      *guiObjectMockPtr,
+      GUI::DrawHardware::DMA2D,
+      0u,
+      GUI::ErrorCode::MEASUREMENT_NOT_AVAILABLE);
+  }
 
   uint64_t drawingTimeInUs;
   GUI::ErrorCode errorCode = guiContainer.getDrawingTime(GUI::DrawHardware::DMA2D, drawingTimeInUs);
@@ -893,6 +936,9 @@ TEST_F(AGUIContainer, GetEventTargetReturnsNullPointerIfContainerIsEmpty)
 
 TEST_F(AGUIContainer, GetEventTargetReturnsPointerToObjectWithTheHighestZIndexInContainerForWhichDoesContainPointReturnsTrue)
 {
+  onCallOfGetRegionReturn(guiObjectMock1, FRAME_BUFFER_REGION);
+  onCallOfGetRegionReturn(guiObjectMock2, FRAME_BUFFER_REGION);
+  onCallOfGetRegionReturn(guiObjectMock3, FRAME_BUFFER_REGION);
   guiContainer.addObject(&guiObjectMock1, 20u);
   guiContainer.addObject(&guiObjectMock2, 10u);
   guiContainer.addObject(&guiObjectMock3, 5u);
@@ -935,6 +981,7 @@ TEST_F(AGUIContainer, GetEventTargetDoesNotCallDoesContainPointOnAnyObjectInCont
 
 TEST_F(AGUIContainer, GetEventTargetInTheCaseOfMultiTouchEventWillMatchGUIObjectEvenIfOnlyOneTouchPointIsContainedByIt)
 {
+  onCallOfGetRegionReturn(guiObjectMock, FRAME_BUFFER_REGION);
   guiContainer.addObject(&guiObjectMock, 10u);
   EXPECT_CALL(guiObjectMock, doesContainPoint(_))
     .Times(2u)
@@ -946,6 +993,48 @@ TEST_F(AGUIContainer, GetEventTargetInTheCaseOfMultiTouchEventWillMatchGUIObject
   ASSERT_THAT(eventTargetPtr, Eq(&guiObjectMock));
 }
 
+TEST_F(AGUIContainer, GetEventTargetDoesNotCallDoesContainPointOnObjectsWhoseRegionIsOutsideOfTouchedGridCell)
+{
+  onCallOfGetRegionReturn(guiObjectMock1, GUI::Region{ .x = 30, .y = 30, .width = 10u, .height = 10u });
+  onCallOfGetRegionReturn(guiObjectMock2, GUI::Region{ .x = 5, .y = 5, .width = 10u, .height = 10u });
+  guiContainer.addObject(&guiObjectMock1, 20u);
+  guiContainer.addObject(&guiObjectMock2, 10u);
+  expectThatDoesContainPointWillNeverBeCalled(guiObjectMock1);
+  expectThatDoesContainPointWillBeCalledOnceAndWillReturn(guiObjectMock2, true);
+
+  const GUI::IObject *eventTargetPtr = guiContainer.getEventTarget(ONE_TOUCH_POINT_TOUCH_EVENT);
+
+  ASSERT_THAT(eventTargetPtr, Eq(&guiObjectMock2));
+}
+
+TEST_F(AGUIContainer, GetEventTargetStopsHitTestingAtTheFirstObjectContainingTouchPointStartingFromTheHighestZIndex)
+{
+  onCallOfGetRegionReturn(guiObjectMock1, FRAME_BUFFER_REGION);
+  onCallOfGetRegionReturn(guiObjectMock2, FRAME_BUFFER_REGION);
+  guiContainer.addObject(&guiObjectMock1, 20u);
+  guiContainer.addObject(&guiObjectMock2, 10u);
+  expectThatDoesContainPointWillBeCalledOnceAndWillReturn(guiObjectMock1, true);
+  expectThatDoesContainPointWillNeverBeCalled(guiObjectMock2);
+
+  const GUI::IObject *eventTargetPtr = guiContainer.getEventTarget(ONE_TOUCH_POINT_TOUCH_EVENT);
+
+  ASSERT_THAT(eventTargetPtr, Eq(&guiObjectMock1));
+}
+
+TEST_F(AGUIContainer, GetEventTargetFindsObjectWhichHasBeenMovedIntoTouchedGridCellAfterThePreviousHitTest)
+{
+  onCallOfGetRegionReturn(guiObjectMock, GUI::Region{ .x = 30, .y = 30, .width = 10u, .height = 10u });
+  onCallOfDoesContainPointReturn(guiObjectMock, true);
+  guiContainer.addObject(&guiObjectMock, 10u);
+  guiContainer.getEventTarget(ONE_TOUCH_POINT_TOUCH_EVENT);
+  onCallOfGetRegionReturn(guiObjectMock, GUI::Region{ .x = 5, .y = 5, .width = 10u, .height = 10u });
+  guiObjectMock.reportDamagedRegion(GUI::Region{ .x = 5, .y = 5, .width = 10u, .height = 10u });
+
+  const GUI::IObject *eventTargetPtr = guiContainer.getEventTarget(ONE_TOUCH_POINT_TOUCH_EVENT);
+
+  ASSERT_THAT(eventTargetPtr, Eq(&guiObjectMock));
+}
+
 TEST_F(AGUIContainer, DispatchEventSucceedWithoutDoingAnythingIfContainerIsEmpty)
 {
   GUI::TouchEvent touchEvent(10u, GUI::TouchEvent::Type::TOUCH_START);
@@ -976,4 +1065,934 @@ TEST_F(AGUIContainer, DispatchEventDoesNotCallNotifyOnGUIObjectsFromContainerIfT
   expectThatObjectWillNotBeNotified(guiObjectMock3);
 
   guiContainer.dispatchEvent(touchEvent);
+}
+TEST_F(AGUIContainer, AddObjectRegistersDamagedRegionCallbackForGUIObject)
+{
+  EXPECT_CALL(guiObjectMock1, registerDamagedRegionCallback(_))
+    .Times(1u);
+
+  guiContainer.addObject(&guiObjectMock1, 5u);
+}
+
+TEST_F(AGUIContainer, DrawWithCPUDoesNotRedrawAnyGUIObjectIfNothingHasBeenDamagedSinceTheLastDraw)
+{
+  guiContainer.addObject(&guiObjectMock1, 5u);
+  guiContainer.addObject(&guiObjectMock2, 10u);
+  guiContainer.draw(GUI::DrawHardware::CPU);
+
+  EXPECT_CALL(guiObjectMock1, draw(_))
+    .Times(0u);
+  EXPECT_CALL(guiObjectMock2, draw(_))
+    .Times(0u);
+
+  guiContainer.draw(GUI::DrawHardware::CPU);
+}
+
+TEST_F(AGUIContainer, DrawWithDMA2DCallsRegisteredDrawCompletedCallbackDirectlyIfNothingHasBeenDamagedSinceTheLastDraw)
+{
+  guiContainer.addObject(&guiObjectMock1, 5u);
+  guiContainer.draw(GUI::DrawHardware::CPU);
+  guiContainer.registerDrawCompletedCallback(callbackDescription);
+
+  guiContainer.draw(GUI::DrawHardware::DMA2D);
+
+  assertThatCallbackIsCalled();
+  ASSERT_THAT(guiContainer.isDrawCompleted(), Eq(true));
+}
+
+TEST_F(AGUIContainer, DrawWithCPURedrawsOnlyGUIObjectsWhichOverlapWithDamagedRegion)
+{
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0,  .y = 0,  .width = 50u, .height = 50u }));
+  ON_CALL(guiObjectMock2, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 30, .y = 30, .width = 10u, .height = 10u }));
+  guiContainer.addObject(&guiObjectMock1, 5u);
+  guiContainer.addObject(&guiObjectMock2, 10u);
+  guiContainer.draw(GUI::DrawHardware::CPU);
+
+  guiContainer.invalidateRegion({ .x = 0, .y = 0, .width = 10u, .height = 10u });
+
+  EXPECT_CALL(guiObjectMock1, draw(GUI::DrawHardware::CPU))
+    .Times(1u);
+  EXPECT_CALL(guiObjectMock2, draw(_))
+    .Times(0u);
+
+  guiContainer.draw(GUI::DrawHardware::CPU);
+}
+
+TEST_F(AGUIContainer, DrawWithCPUClipsRedrawnGUIObjectToDamagedRegion)
+{
+  const GUI::Region DAMAGED_REGION = { .x = 5, .y = 10, .width = 10u, .height = 20u };
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0, .y = 0, .width = 50u, .height = 50u }));
+  guiContainer.addObject(&guiObjectMock1, 5u);
+  guiContainer.draw(GUI::DrawHardware::CPU);
+  guiContainer.invalidateRegion(DAMAGED_REGION);
+
+  InSequence sequence;
+  EXPECT_CALL(guiObjectMock1, setClipRegion(DAMAGED_REGION))
+    .Times(1u);
+  EXPECT_CALL(guiObjectMock1, draw(GUI::DrawHardware::CPU))
+    .Times(1u);
+  EXPECT_CALL(guiObjectMock1, resetClipRegion())
+    .Times(1u);
+
+  guiContainer.draw(GUI::DrawHardware::CPU);
+}
+
+TEST_F(AGUIContainer, DrawWithCPURedrawsGUIObjectsAtBothOldAndNewPositionAfterGUIObjectReportsDamage)
+{
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0,  .y = 0,  .width = 10u, .height = 10u }));
+  ON_CALL(guiObjectMock2, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 40, .y = 40, .width = 10u, .height = 10u }));
+  ON_CALL(guiObjectMock3, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 20, .y = 20, .width = 5u,  .height = 5u }));
+  guiContainer.addObject(&guiObjectMock1, 5u);
+  guiContainer.addObject(&guiObjectMock2, 10u);
+  guiContainer.addObject(&guiObjectMock3, 15u);
+  guiContainer.draw(GUI::DrawHardware::CPU);
+
+  guiObjectMock1.reportDamagedRegion({ .x = 0,  .y = 0,  .width = 10u, .height = 10u });
+  guiObjectMock1.reportDamagedRegion({ .x = 40, .y = 40, .width = 10u, .height = 10u });
+
+  EXPECT_CALL(guiObjectMock1, draw(GUI::DrawHardware::CPU))
+    .Times(1u);
+  EXPECT_CALL(guiObjectMock2, draw(GUI::DrawHardware::CPU))
+    .Times(1u);
+  EXPECT_CALL(guiObjectMock3, draw(_))
+    .Times(0u);
+
+  guiContainer.draw(GUI::DrawHardware::CPU);
+}
+
+TEST_F(AGUIContainer, DrawWithDMA2DRedrawsEachGUIObjectOncePerDamagedRegionItOverlapsWith)
+{
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0, .y = 0, .width = 50u, .height = 50u }));
+  guiContainer.addObject(&guiObjectMock1, 5u);
+  guiContainer.draw(GUI::DrawHardware::CPU);
+  guiContainer.registerDrawCompletedCallback(callbackDescription);
+  guiContainer.invalidateRegion({ .x = 0,  .y = 0,  .width = 10u, .height = 10u });
+  guiContainer.invalidateRegion({ .x = 30, .y = 30, .width = 10u, .height = 10u });
+
+  EXPECT_CALL(guiObjectMock1, draw(GUI::DrawHardware::DMA2D))
+    .Times(2u);
+
+  guiContainer.draw(GUI::DrawHardware::DMA2D);
+  guiObjectMock1.callbackDMA2DDrawCompleted();
+  assertThatCallbackIsNotCalled();
+  guiObjectMock1.callbackDMA2DDrawCompleted();
+  assertThatCallbackIsCalled();
+}
+
+TEST_F(AGUIContainer, GetLastDrawnRegionReturnsBoundingBoxOfAllRegionsRedrawnByLastDraw)
+{
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0, .y = 0, .width = 50u, .height = 50u }));
+  guiContainer.addObject(&guiObjectMock1, 5u);
+  guiContainer.draw(GUI::DrawHardware::CPU);
+  guiContainer.invalidateRegion({ .x = 2,  .y = 4,  .width = 10u, .height = 10u });
+  guiContainer.invalidateRegion({ .x = 30, .y = 30, .width = 10u, .height = 5u });
+
+  guiContainer.draw(GUI::DrawHardware::CPU);
+
+  ASSERT_THAT(guiContainer.getLastDrawnRegion(), Eq(GUI::Region{ .x = 2, .y = 4, .width = 38u, .height = 31u }));
+}
+
+TEST_F(AGUIContainer, GetLastDrawnRegionReturnsEmptyRegionIfNothingHasBeenDamagedSinceTheLastDraw)
+{
+  guiContainer.addObject(&guiObjectMock1, 5u);
+  guiContainer.draw(GUI::DrawHardware::CPU);
+
+  guiContainer.draw(GUI::DrawHardware::CPU);
+
+  ASSERT_THAT(guiContainer.getLastDrawnRegion().isEmpty(), Eq(true));
+}
+
+TEST_F(AGUIContainer, InvalidateRegionMergesOverlappingDamagedRegionsIntoOne)
+{
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0, .y = 0, .width = 50u, .height = 50u }));
+  guiContainer.addObject(&guiObjectMock1, 5u);
+  guiContainer.draw(GUI::DrawHardware::CPU);
+  guiContainer.invalidateRegion({ .x = 0, .y = 0, .width = 10u, .height = 10u });
+  guiContainer.invalidateRegion({ .x = 5, .y = 5, .width = 10u, .height = 10u });
+
+  EXPECT_CALL(guiObjectMock1, setClipRegion(GUI::Region{ .x = 0, .y = 0, .width = 15u, .height = 15u }))
+    .Times(1u);
+
+  guiContainer.draw(GUI::DrawHardware::CPU);
+}
+
+
+TEST_F(AGUIContainer, SetFrameBufferToPreviouslyUsedFrameBufferInvalidatesOnlyRegionsDrawnIntoOtherFrameBuffer)
+{
+  const GUI::Region DAMAGED_REGION = { .x = 5, .y = 10, .width = 10u, .height = 20u };
+  FrameBuffer<50u, 50u, IFrameBuffer::ColorFormat::RGB888> backFrameBuffer;
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0, .y = 0, .width = 50u, .height = 50u }));
+  guiContainer.addObject(&guiObjectMock1, 5u);
+  guiContainer.draw(GUI::DrawHardware::CPU);
+  guiContainer.setFrameBuffer(backFrameBuffer);
+  guiContainer.draw(GUI::DrawHardware::CPU);
+  guiContainer.invalidateRegion(DAMAGED_REGION);
+  guiContainer.draw(GUI::DrawHardware::CPU);
+
+  EXPECT_CALL(guiObjectMock1, setClipRegion(DAMAGED_REGION))
+    .Times(1u);
+
+  guiContainer.setFrameBuffer(frameBuffer);
+  guiContainer.draw(GUI::DrawHardware::CPU);
+}
+
+TEST_F(AGUIContainer, SetFrameBufferToNotPreviouslyUsedFrameBufferInvalidatesWholeFrameBuffer)
+{
+  FrameBuffer<50u, 50u, IFrameBuffer::ColorFormat::RGB888> newFrameBuffer;
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0, .y = 0, .width = 50u, .height = 50u }));
+  guiContainer.addObject(&guiObjectMock1, 5u);
+  guiContainer.draw(GUI::DrawHardware::CPU);
+
+  EXPECT_CALL(guiObjectMock1, setClipRegion(GUI::Region{ .x = 0, .y = 0, .width = 50u, .height = 50u }))
+    .Times(1u);
+
+  guiContainer.setFrameBuffer(newFrameBuffer);
+  guiContainer.draw(GUI::DrawHardware::CPU);
+}
+
+TEST_F(AGUIContainer, DrawWithDMA2DEnqueuesDrawCommandsOfDamagedObjectsAndExecutesThemAsOneDMA2DCommandQueueBatch)
+{
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.addObject(&guiObjectMock2, 10u);
+
+  EXPECT_CALL(guiObjectMock1, enqueueDMA2DDrawCommands())
+    .Times(1u);
+  EXPECT_CALL(guiObjectMock2, enqueueDMA2DDrawCommands())
+    .Times(1u);
+  EXPECT_CALL(guiObjectMock1, draw(_))
+    .Times(0u);
+  EXPECT_CALL(guiObjectMock2, draw(_))
+    .Times(0u);
+  EXPECT_CALL(dma2dMock, executeCommandQueue(_))
+    .Times(1u);
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::DMA2D);
+}
+
+TEST_F(AGUIContainer, DrawWithDMA2DClipsGUIObjectToDamagedRegionBeforeEnqueueingItsDrawCommands)
+{
+  const GUI::Region DAMAGED_REGION = { .x = 5, .y = 10, .width = 10u, .height = 20u };
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0, .y = 0, .width = 50u, .height = 50u }));
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::CPU);
+  guiContainerWithDMA2D.invalidateRegion(DAMAGED_REGION);
+
+  InSequence sequence;
+  EXPECT_CALL(guiObjectMock1, setClipRegion(DAMAGED_REGION))
+    .Times(1u);
+  EXPECT_CALL(guiObjectMock1, enqueueDMA2DDrawCommands())
+    .Times(1u);
+  EXPECT_CALL(dma2dMock, executeCommandQueue(_))
+    .Times(1u);
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::DMA2D);
+}
+
+TEST_F(AGUIContainer, DrawWithDMA2DCallsDrawCompletedCallbackOnlyWhenDMA2DCommandQueueIsExecuted)
+{
+  captureDMA2DCommandQueueCompletedCallback();
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.registerDrawCompletedCallback(callbackDescription);
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::DMA2D);
+  assertThatCallbackIsNotCalled();
+  ASSERT_THAT(guiContainerWithDMA2D.isDrawCompleted(), Eq(false));
+
+  simulateDMA2DCommandQueueCompleted();
+  guiContainerWithDMA2D.runtimeTask();
+  assertThatCallbackIsCalled();
+  ASSERT_THAT(guiContainerWithDMA2D.isDrawCompleted(), Eq(true));
+}
+
+TEST_F(AGUIContainer, DrawWithDMA2DEnqueuesRemainingDrawCommandsInTheNextBatchIfDMA2DCommandQueueGetsFull)
+{
+  captureDMA2DCommandQueueCompletedCallback();
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.addObject(&guiObjectMock2, 10u);
+  guiContainerWithDMA2D.registerDrawCompletedCallback(callbackDescription);
+  EXPECT_CALL(guiObjectMock1, enqueueDMA2DDrawCommands())
+    .Times(1u);
+  EXPECT_CALL(guiObjectMock2, enqueueDMA2DDrawCommands())
+    .WillOnce(Return(GUI::ErrorCode::DMA2D_COMMAND_QUEUE_FULL))
+    .WillOnce(Return(GUI::ErrorCode::OK));
+  EXPECT_CALL(dma2dMock, executeCommandQueue(_))
+    .Times(2u);
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::DMA2D);
+  simulateDMA2DCommandQueueCompleted();
+  guiContainerWithDMA2D.runtimeTask();
+  assertThatCallbackIsNotCalled();
+  simulateDMA2DCommandQueueCompleted();
+  guiContainerWithDMA2D.runtimeTask();
+  assertThatCallbackIsCalled();
+}
+
+TEST_F(AGUIContainer, DrawWithDMA2DDrawsGUIObjectUnsupportedByDMA2DFromRuntimeTaskAndNotFromDMA2DCommandQueueCompletedCallback)
+{
+  captureDMA2DCommandQueueCompletedCallback();
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.addObject(&guiObjectMock2, 10u);
+  ON_CALL(guiObjectMock2, enqueueDMA2DDrawCommands())
+    .WillByDefault(Return(GUI::ErrorCode::DMA2D_UNSUPPORTED_OPERATION));
+  EXPECT_CALL(dma2dMock, getNumberOfEnqueuedCommands())
+    .WillOnce(Return(1u))
+    .WillOnce(Return(0u));
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::DMA2D);
+
+  EXPECT_CALL(guiObjectMock2, enqueueDMA2DDrawCommands())
+    .Times(0u);
+  EXPECT_CALL(guiObjectMock2, draw(GUI::DrawHardware::CPU))
+    .Times(0u);
+  simulateDMA2DCommandQueueCompleted();
+  Mock::VerifyAndClearExpectations(&guiObjectMock2);
+
+  EXPECT_CALL(guiObjectMock2, draw(GUI::DrawHardware::CPU))
+    .Times(1u);
+  guiContainerWithDMA2D.runtimeTask();
+}
+
+TEST_F(AGUIContainer, DrawWithDMA2DExecutesDMA2DCommandQueueAgainFromRuntimeTaskIfDMA2DWasBusy)
+{
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.registerDrawCompletedCallback(callbackDescription);
+  EXPECT_CALL(guiObjectMock1, enqueueDMA2DDrawCommands())
+    .Times(1u);
+  EXPECT_CALL(dma2dMock, executeCommandQueue(_))
+    .WillOnce(Return(DMA2D::ErrorCode::BUSY))
+    .WillOnce([&](const DMA2D::CallbackDescription &callbackDescription)
+    {
+      dma2dCommandQueueCompletedCallback = callbackDescription;
+      return DMA2D::ErrorCode::OK;
+    });
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::DMA2D);
+  guiContainerWithDMA2D.runtimeTask();
+  assertThatCallbackIsNotCalled();
+
+  simulateDMA2DCommandQueueCompleted();
+  guiContainerWithDMA2D.runtimeTask();
+  assertThatCallbackIsCalled();
+}
+
+TEST_F(AGUIContainer, DrawWithDMA2DExecutesAlreadyEnqueuedCommandsBeforeGUIObjectUnsupportedByDMA2DIsDrawnWithCPU)
+{
+  captureDMA2DCommandQueueCompletedCallback();
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.addObject(&guiObjectMock2, 10u);
+  guiContainerWithDMA2D.registerDrawCompletedCallback(callbackDescription);
+  ON_CALL(guiObjectMock2, enqueueDMA2DDrawCommands())
+    .WillByDefault(Return(GUI::ErrorCode::DMA2D_UNSUPPORTED_OPERATION));
+  EXPECT_CALL(dma2dMock, getNumberOfEnqueuedCommands())
+    .WillOnce(Return(1u))
+    .WillOnce(Return(0u));
+  EXPECT_CALL(guiObjectMock2, draw(GUI::DrawHardware::CPU))
+    .Times(0u);
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::DMA2D);
+  Mock::VerifyAndClearExpectations(&guiObjectMock2);
+
+  EXPECT_CALL(guiObjectMock2, draw(GUI::DrawHardware::CPU))
+    .Times(1u);
+  simulateDMA2DCommandQueueCompleted();
+  guiContainerWithDMA2D.runtimeTask();
+  simulateDMA2DCommandQueueCompleted();
+  guiContainerWithDMA2D.runtimeTask();
+  assertThatCallbackIsCalled();
+}
+
+TEST_F(AGUIContainer, DrawHybridEnqueuesLargeGUIObjectIntoDMA2DQueueAndDrawsSmallNonOverlappingGUIObjectWithCPU)
+{
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0,  .y = 0,  .width = 50u, .height = 40u }));
+  ON_CALL(guiObjectMock2, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 45, .y = 45, .width = 2u,  .height = 2u }));
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.addObject(&guiObjectMock2, 10u);
+
+  EXPECT_CALL(guiObjectMock1, enqueueDMA2DDrawCommands())
+    .Times(1u);
+  EXPECT_CALL(guiObjectMock1, draw(_))
+    .Times(0u);
+  EXPECT_CALL(guiObjectMock2, enqueueDMA2DDrawCommands())
+    .Times(0u);
+  EXPECT_CALL(guiObjectMock2, draw(GUI::DrawHardware::CPU))
+    .Times(1u);
+  EXPECT_CALL(dma2dMock, executeCommandQueue(_))
+    .Times(1u);
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::HYBRID);
+}
+
+TEST_F(AGUIContainer, DrawHybridStartsDMA2DCommandQueueBeforeGUIObjectsAreDrawnWithCPU)
+{
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0,  .y = 0,  .width = 50u, .height = 40u }));
+  ON_CALL(guiObjectMock2, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 45, .y = 45, .width = 2u,  .height = 2u }));
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.addObject(&guiObjectMock2, 10u);
+
+  InSequence sequence;
+  EXPECT_CALL(dma2dMock, executeCommandQueue(_))
+    .Times(1u);
+  EXPECT_CALL(guiObjectMock2, draw(GUI::DrawHardware::CPU))
+    .Times(1u);
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::HYBRID);
+}
+
+TEST_F(AGUIContainer, DrawHybridCallsDrawCompletedCallbackOnlyWhenBothCPUAndDMA2DPartsAreCompleted)
+{
+  captureDMA2DCommandQueueCompletedCallback();
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0,  .y = 0,  .width = 50u, .height = 40u }));
+  ON_CALL(guiObjectMock2, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 45, .y = 45, .width = 2u,  .height = 2u }));
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.addObject(&guiObjectMock2, 10u);
+  guiContainerWithDMA2D.registerDrawCompletedCallback(callbackDescription);
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::HYBRID);
+  assertThatCallbackIsNotCalled();
+  ASSERT_THAT(guiContainerWithDMA2D.isDrawCompleted(), Eq(false));
+
+  simulateDMA2DCommandQueueCompleted();
+  guiContainerWithDMA2D.runtimeTask();
+  assertThatCallbackIsCalled();
+  ASSERT_THAT(guiContainerWithDMA2D.isDrawCompleted(), Eq(true));
+}
+
+TEST_F(AGUIContainer, DrawHybridDrawsSmallGUIObjectOverlappingLargerGUIObjectBelowItOnlyAfterDMA2DPartIsCompleted)
+{
+  captureDMA2DCommandQueueCompletedCallback();
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0,  .y = 0,  .width = 50u, .height = 40u }));
+  ON_CALL(guiObjectMock2, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 10, .y = 10, .width = 2u,  .height = 2u }));
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.addObject(&guiObjectMock2, 10u);
+  guiContainerWithDMA2D.registerDrawCompletedCallback(callbackDescription);
+  EXPECT_CALL(guiObjectMock2, draw(_))
+    .Times(0u);
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::HYBRID);
+  Mock::VerifyAndClearExpectations(&guiObjectMock2);
+
+  EXPECT_CALL(guiObjectMock2, draw(GUI::DrawHardware::CPU))
+    .Times(1u);
+  simulateDMA2DCommandQueueCompleted();
+  guiContainerWithDMA2D.runtimeTask();
+  assertThatCallbackIsNotCalled();
+  simulateDMA2DCommandQueueCompleted();
+  guiContainerWithDMA2D.runtimeTask();
+  assertThatCallbackIsCalled();
+}
+
+TEST_F(AGUIContainer, DrawHybridStartsNextBatchFromRuntimeTaskAndNotFromDMA2DCommandQueueCompletedCallback)
+{
+  captureDMA2DCommandQueueCompletedCallback();
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0,  .y = 0,  .width = 50u, .height = 40u }));
+  ON_CALL(guiObjectMock2, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 10, .y = 10, .width = 2u,  .height = 2u }));
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.addObject(&guiObjectMock2, 10u);
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::HYBRID);
+  EXPECT_CALL(guiObjectMock2, draw(_))
+    .Times(0u);
+
+  simulateDMA2DCommandQueueCompleted();
+  Mock::VerifyAndClearExpectations(&guiObjectMock2);
+
+  EXPECT_CALL(guiObjectMock2, draw(GUI::DrawHardware::CPU))
+    .Times(1u);
+  guiContainerWithDMA2D.runtimeTask();
+}
+
+TEST_F(AGUIContainer, DrawHybridDrawsAllBatchesWithinDrawCallIfDMA2DPartsCompleteImmediately)
+{
+  ON_CALL(dma2dMock, executeCommandQueue(_))
+    .WillByDefault([&](const DMA2D::CallbackDescription &callbackDescription)
+    {
+      callbackDescription.functionPtr(callbackDescription.argument);
+      return DMA2D::ErrorCode::OK;
+    });
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0,  .y = 0,  .width = 50u, .height = 40u }));
+  ON_CALL(guiObjectMock2, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 10, .y = 10, .width = 2u,  .height = 2u }));
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.addObject(&guiObjectMock2, 10u);
+  guiContainerWithDMA2D.registerDrawCompletedCallback(callbackDescription);
+  EXPECT_CALL(guiObjectMock2, draw(GUI::DrawHardware::CPU))
+    .Times(1u);
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::HYBRID);
+
+  assertThatCallbackIsCalled();
+  ASSERT_THAT(guiContainerWithDMA2D.isDrawCompleted(), Eq(true));
+}
+
+TEST_F(AGUIContainer, DrawHybridExecutesDMA2DPartAgainFromRuntimeTaskIfDMA2DWasBusy)
+{
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0,  .y = 0,  .width = 50u, .height = 40u }));
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.registerDrawCompletedCallback(callbackDescription);
+  EXPECT_CALL(dma2dMock, executeCommandQueue(_))
+    .WillOnce(Return(DMA2D::ErrorCode::BUSY))
+    .WillOnce([&](const DMA2D::CallbackDescription &callbackDescription)
+    {
+      dma2dCommandQueueCompletedCallback = callbackDescription;
+      return DMA2D::ErrorCode::OK;
+    });
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::HYBRID);
+  guiContainerWithDMA2D.runtimeTask();
+  assertThatCallbackIsNotCalled();
+
+  simulateDMA2DCommandQueueCompleted();
+  guiContainerWithDMA2D.runtimeTask();
+  assertThatCallbackIsCalled();
+}
+
+TEST_F(AGUIContainer, DrawHybridDrawsGUIObjectsWithDMA2DIfContainerHasNoDMA2DCommandQueue)
+{
+  guiContainer.addObject(&guiObjectMock1, 5u);
+
+  EXPECT_CALL(guiObjectMock1, draw(GUI::DrawHardware::DMA2D))
+    .Times(1u);
+
+  guiContainer.draw(GUI::DrawHardware::HYBRID);
+}
+
+TEST_F(AGUIContainer, DrawWithAutoDrawHardwareLetsEachGUIObjectChooseDrawHardwareAndDrawsThemOneByOne)
+{
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.addObject(&guiObjectMock2, 10u);
+  guiContainerWithDMA2D.registerDrawCompletedCallback(callbackDescription);
+  EXPECT_CALL(dma2dMock, executeCommandQueue(_))
+    .Times(0u);
+  EXPECT_CALL(guiObjectMock1, draw(GUI::DrawHardware::AUTO))
+    .Times(1u);
+  EXPECT_CALL(guiObjectMock2, draw(GUI::DrawHardware::AUTO))
+    .Times(0u);
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::AUTO);
+  Mock::VerifyAndClearExpectations(&guiObjectMock2);
+
+  EXPECT_CALL(guiObjectMock2, draw(GUI::DrawHardware::AUTO))
+    .Times(1u);
+  guiObjectMock1.callbackDMA2DDrawCompleted();
+  guiContainerWithDMA2D.runtimeTask();
+  assertThatCallbackIsNotCalled();
+  guiObjectMock2.callbackDMA2DDrawCompleted();
+  guiContainerWithDMA2D.runtimeTask();
+  assertThatCallbackIsCalled();
+}
+
+TEST_F(AGUIContainer, DrawWithAutoDrawHardwareDrawsGUIObjectsCompletedSynchronouslyWithinDrawCall)
+{
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.addObject(&guiObjectMock2, 10u);
+  guiContainerWithDMA2D.registerDrawCompletedCallback(callbackDescription);
+  EXPECT_CALL(guiObjectMock1, draw(GUI::DrawHardware::AUTO))
+    .WillOnce([&](GUI::DrawHardware drawHardware) { guiObjectMock1.callbackDMA2DDrawCompleted(); });
+  EXPECT_CALL(guiObjectMock2, draw(GUI::DrawHardware::AUTO))
+    .WillOnce([&](GUI::DrawHardware drawHardware) { guiObjectMock2.callbackDMA2DDrawCompleted(); });
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::AUTO);
+
+  assertThatCallbackIsCalled();
+  ASSERT_THAT(guiContainerWithDMA2D.isDrawCompleted(), Eq(true));
+}
+
+TEST_F(AGUIContainer, DrawWithAutoDrawHardwareDoesNotDrawTheNextGUIObjectFromDrawCompletedCallbackOfTheOngoingOne)
+{
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.addObject(&guiObjectMock2, 10u);
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::AUTO);
+  EXPECT_CALL(guiObjectMock2, draw(_))
+    .Times(0u);
+
+  guiObjectMock1.callbackDMA2DDrawCompleted();
+  Mock::VerifyAndClearExpectations(&guiObjectMock2);
+
+  EXPECT_CALL(guiObjectMock2, draw(GUI::DrawHardware::AUTO))
+    .Times(1u);
+  guiContainerWithDMA2D.runtimeTask();
+}
+
+TEST_F(AGUIContainer, GetDrawingTimeDoesNotAddDrawingTimeOfGUIObjectWhichHasNeverBeenDrawn)
+{
+  guiContainer.addObject(&guiObjectMock1, 5u);
+  guiContainer.addObject(&guiObjectMock2, 10u);
+  setupGUIObjectGetDrawingTimeReadings(guiObjectMock1, GUI::DrawHardware::CPU, 50u, GUI::ErrorCode::OK);
+  ON_CALL(guiObjectMock2, getDrawingTime(GUI::DrawHardware::CPU, _))
+    .WillByDefault([](GUI::DrawHardware drawHardware, uint64_t &drawingTimeInUs)
+    {
+      drawingTimeInUs = 123456u;
+      return GUI::ErrorCode::MEASUREMENT_NOT_AVAILABLE;
+    });
+
+  uint64_t drawingTimeInUs;
+  GUI::ErrorCode errorCode = guiContainer.getDrawingTime(GUI::DrawHardware::CPU, drawingTimeInUs);
+
+  ASSERT_THAT(errorCode, Eq(GUI::ErrorCode::OK));
+  ASSERT_THAT(drawingTimeInUs, Eq(50u));
+}
+
+TEST_F(AGUIContainer, GetDrawingTimeAddsDrawingTimesOfGUIObjectsAboveGUIObjectWhichHasNeverBeenDrawn)
+{
+  guiContainer.addObject(&guiObjectMock1, 1u);
+  guiContainer.addObject(&guiObjectMock2, 5u);
+  guiContainer.addObject(&guiObjectMock3, 10u);
+  setupGUIObjectGetDrawingTimeReadings(guiObjectMock1, GUI::DrawHardware::CPU, 0u, GUI::ErrorCode::MEASUREMENT_NOT_AVAILABLE);
+  setupGUIObjectGetDrawingTimeReadings(guiObjectMock2, GUI::DrawHardware::CPU, 50u, GUI::ErrorCode::OK);
+  setupGUIObjectGetDrawingTimeReadings(guiObjectMock3, GUI::DrawHardware::CPU, 70u, GUI::ErrorCode::OK);
+
+  uint64_t drawingTimeInUs;
+  GUI::ErrorCode errorCode = guiContainer.getDrawingTime(GUI::DrawHardware::CPU, drawingTimeInUs);
+
+  ASSERT_THAT(errorCode, Eq(GUI::ErrorCode::OK));
+  ASSERT_THAT(drawingTimeInUs, Eq(120u));
+}
+
+TEST_F(AGUIContainer, DrawWithCPURecordsFrameAndEachDrawnGUIObjectIntoAttachedFrameProfiler)
+{
+  NiceMock<SysTickMock> sysTickMock;
+  GUI::FrameProfiler frameProfiler(sysTickMock);
+  guiContainer.addObject(&guiObjectMock1, 5u);
+  guiContainer.addObject(&guiObjectMock2, 10u);
+  guiContainer.attachFrameProfiler(frameProfiler);
+
+  guiContainer.draw(GUI::DrawHardware::CPU);
+
+  ASSERT_THAT(frameProfiler.getStatistics(GUI::FrameProfiler::Metric::TOTAL_TIME).frameCount, Eq(1u));
+  ASSERT_THAT(frameProfiler.getLastFrameProfile().topObjectCount, Eq(2u));
+  ASSERT_THAT(frameProfiler.getLastFrameProfile().pixelCount, Eq(2u));
+}
+
+TEST_F(AGUIContainer, DrawWithDMA2DRecordsDMA2DCommandQueueExecutionTimeIntoAttachedFrameProfiler)
+{
+  static constexpr uint64_t DMA2D_BATCH_DURATION_IN_US = 700u;
+  NiceMock<SysTickMock> sysTickMock;
+  ON_CALL(sysTickMock, getElapsedTimeInUs(_))
+    .WillByDefault(Return(DMA2D_BATCH_DURATION_IN_US));
+  GUI::FrameProfiler frameProfiler(sysTickMock);
+  captureDMA2DCommandQueueCompletedCallback();
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.attachFrameProfiler(frameProfiler);
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::DMA2D);
+  ASSERT_THAT(frameProfiler.isFrameOngoing(), Eq(true));
+  simulateDMA2DCommandQueueCompleted();
+  guiContainerWithDMA2D.runtimeTask();
+
+  ASSERT_THAT(frameProfiler.isFrameOngoing(), Eq(false));
+  ASSERT_THAT(frameProfiler.getLastFrameProfile().dma2dTimeInUs, Eq(DMA2D_BATCH_DURATION_IN_US));
+  ASSERT_THAT(frameProfiler.getLastFrameProfile().topObjects[0].objectPtr, Eq(&guiObjectMock1));
+}
+
+TEST_F(AGUIContainer, DrawDoesNotDrawGUIObjectWhichIsCompletelyHiddenBehindOpaqueGUIObjectWithHigherZIndex)
+{
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 10, .y = 10, .width = 10u, .height = 10u }));
+  ON_CALL(guiObjectMock2, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0,  .y = 0,  .width = 50u, .height = 50u }));
+  ON_CALL(guiObjectMock2, isOpaque())
+    .WillByDefault(Return(true));
+  guiContainer.addObject(&guiObjectMock1, 5u);
+  guiContainer.addObject(&guiObjectMock2, 10u);
+
+  EXPECT_CALL(guiObjectMock1, draw(_))
+    .Times(0u);
+  EXPECT_CALL(guiObjectMock2, draw(GUI::DrawHardware::CPU))
+    .Times(1u);
+
+  guiContainer.draw(GUI::DrawHardware::CPU);
+}
+
+TEST_F(AGUIContainer, DrawDrawsGUIObjectHiddenBehindGUIObjectWithHigherZIndexIfThatObjectIsNotOpaque)
+{
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 10, .y = 10, .width = 10u, .height = 10u }));
+  ON_CALL(guiObjectMock2, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0,  .y = 0,  .width = 50u, .height = 50u }));
+  ON_CALL(guiObjectMock2, isOpaque())
+    .WillByDefault(Return(false));
+  guiContainer.addObject(&guiObjectMock1, 5u);
+  guiContainer.addObject(&guiObjectMock2, 10u);
+
+  EXPECT_CALL(guiObjectMock1, draw(GUI::DrawHardware::CPU))
+    .Times(1u);
+
+  guiContainer.draw(GUI::DrawHardware::CPU);
+}
+
+TEST_F(AGUIContainer, DrawClipsGUIObjectToPartWhichIsNotHiddenBehindOpaqueGUIObjectWithHigherZIndex)
+{
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0, .y = 0,  .width = 50u, .height = 50u }));
+  ON_CALL(guiObjectMock2, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0, .y = 20, .width = 50u, .height = 30u }));
+  ON_CALL(guiObjectMock2, isOpaque())
+    .WillByDefault(Return(true));
+  guiContainer.addObject(&guiObjectMock1, 5u);
+  guiContainer.addObject(&guiObjectMock2, 10u);
+
+  EXPECT_CALL(guiObjectMock1, setClipRegion(GUI::Region{ .x = 0, .y = 0, .width = 50u, .height = 20u }))
+    .Times(1u);
+
+  guiContainer.draw(GUI::DrawHardware::CPU);
+}
+
+TEST_F(AGUIContainer, DrawWithDMA2DDoesNotEnqueueDrawCommandsOfGUIObjectWhichIsCompletelyHiddenBehindOpaqueGUIObject)
+{
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 10, .y = 10, .width = 10u, .height = 10u }));
+  ON_CALL(guiObjectMock2, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0,  .y = 0,  .width = 50u, .height = 50u }));
+  ON_CALL(guiObjectMock2, isOpaque())
+    .WillByDefault(Return(true));
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.addObject(&guiObjectMock2, 10u);
+
+  EXPECT_CALL(guiObjectMock1, enqueueDMA2DDrawCommands())
+    .Times(0u);
+  EXPECT_CALL(guiObjectMock2, enqueueDMA2DDrawCommands())
+    .Times(1u);
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::DMA2D);
+}
+
+TEST_F(AGUIContainer, EnableTiledRenderingFailsIfTileFrameBufferDimensionDiffersFromContainerFrameBufferDimension)
+{
+  TileFrameBuffer<40u, 50u, 20u, IFrameBuffer::ColorFormat::RGB888> narrowerTileFrameBuffer;
+
+  const GUI::ErrorCode errorCode = guiContainer.enableTiledRendering(narrowerTileFrameBuffer);
+
+  ASSERT_THAT(errorCode, Eq(GUI::ErrorCode::INCOMPATIBLE_TILE_FBUFF));
+  ASSERT_THAT(guiContainer.isTiledRenderingEnabled(), Eq(false));
+}
+
+TEST_F(AGUIContainer, EnableTiledRenderingFailsIfTileFrameBufferColorFormatDiffersFromContainerFrameBufferColorFormat)
+{
+  TileFrameBuffer<50u, 50u, 20u, IFrameBuffer::ColorFormat::ARGB8888> argbTileFrameBuffer;
+
+  const GUI::ErrorCode errorCode = guiContainer.enableTiledRendering(argbTileFrameBuffer);
+
+  ASSERT_THAT(errorCode, Eq(GUI::ErrorCode::INCOMPATIBLE_TILE_FBUFF));
+  ASSERT_THAT(guiContainer.isTiledRenderingEnabled(), Eq(false));
+}
+
+TEST_F(AGUIContainer, DrawWithCPUInTiledModeDrawsGUIObjectOncePerTileClippedToThatTile)
+{
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0, .y = 0, .width = 50u, .height = 50u }));
+  guiContainer.addObject(&guiObjectMock1, 5u);
+  guiContainer.enableTiledRendering(tileFrameBuffer);
+
+  InSequence sequence;
+  EXPECT_CALL(guiObjectMock1, setClipRegion(GUI::Region{ .x = 0, .y = 0, .width = 50u, .height = 20u }))
+    .Times(1u);
+  EXPECT_CALL(guiObjectMock1, draw(GUI::DrawHardware::CPU))
+    .Times(1u);
+  EXPECT_CALL(guiObjectMock1, setClipRegion(GUI::Region{ .x = 0, .y = 20, .width = 50u, .height = 20u }))
+    .Times(1u);
+  EXPECT_CALL(guiObjectMock1, draw(GUI::DrawHardware::CPU))
+    .Times(1u);
+  EXPECT_CALL(guiObjectMock1, setClipRegion(GUI::Region{ .x = 0, .y = 40, .width = 50u, .height = 10u }))
+    .Times(1u);
+  EXPECT_CALL(guiObjectMock1, draw(GUI::DrawHardware::CPU))
+    .Times(1u);
+
+  guiContainer.draw(GUI::DrawHardware::CPU);
+}
+
+TEST_F(AGUIContainer, DrawWithCPUInTiledModeRestoresContainerFrameBufferOfGUIObjectsWhenDrawingIsCompleted)
+{
+  guiContainer.addObject(&guiObjectMock1, 5u);
+  guiContainer.enableTiledRendering(tileFrameBuffer);
+
+  InSequence sequence;
+  EXPECT_CALL(guiObjectMock1, setFrameBuffer(Ref(tileFrameBuffer)))
+    .Times(AtLeast(1u));
+  EXPECT_CALL(guiObjectMock1, setFrameBuffer(Ref(frameBuffer)))
+    .Times(1u);
+
+  guiContainer.draw(GUI::DrawHardware::CPU);
+}
+
+TEST_F(AGUIContainer, DrawWithCPUInTiledModeProducesTheSameFrameBufferContentAsDrawWithoutTiling)
+{
+  NiceMock<SysTickMock> sysTickMock;
+  FrameBuffer<50u, 50u, IFrameBuffer::ColorFormat::RGB888> tiledFrameBuffer;
+  ArrayList<GUI::Container::ObjectInfo,5u> tiledGUIContainerObjectInfoList;
+  GUI::Container tiledGUIContainer = GUI::Container(tiledGUIContainerObjectInfoList, tiledFrameBuffer);
+  GUI::Rectangle guiRectangles[2u] =
+  {
+    GUI::Rectangle(dma2dMock, sysTickMock, frameBuffer),
+    GUI::Rectangle(dma2dMock, sysTickMock, frameBuffer)
+  };
+  GUI::Rectangle tiledGUIRectangles[2u] =
+  {
+    GUI::Rectangle(dma2dMock, sysTickMock, tiledFrameBuffer),
+    GUI::Rectangle(dma2dMock, sysTickMock, tiledFrameBuffer)
+  };
+  const GUI::Rectangle::RectangleDescription rectangleDescriptions[2u] =
+  {
+    {
+      .baseDescription =
+      {
+        .dimension = { .width = 30u, .height = 45u },
+        .position  = { .x = 5, .y = 2, .tag = GUI::Position::Tag::TOP_LEFT_CORNER }
+      },
+      .color = { .red = 55u, .green = 210u, .blue = 145u }
+    },
+    {
+      .baseDescription =
+      {
+        .dimension = { .width = 25u, .height = 15u },
+        .position  = { .x = 20, .y = 15, .tag = GUI::Position::Tag::TOP_LEFT_CORNER }
+      },
+      .color = { .red = 10u, .green = 20u, .blue = 30u }
+    }
+  };
+  // parts of the frame buffer not covered by any object have to be preserved
+  memset(frameBuffer.getPointer(), 0x5A, frameBuffer.getSize());
+  memset(tiledFrameBuffer.getPointer(), 0x5A, tiledFrameBuffer.getSize());
+  for (uint32_t i = 0u; i < 2u; ++i)
+  {
+    guiRectangles[i].init(rectangleDescriptions[i]);
+    tiledGUIRectangles[i].init(rectangleDescriptions[i]);
+    guiContainer.addObject(&guiRectangles[i], i);
+    tiledGUIContainer.addObject(&tiledGUIRectangles[i], i);
+  }
+  tiledGUIContainer.enableTiledRendering(tileFrameBuffer);
+
+  guiContainer.draw(GUI::DrawHardware::CPU);
+  tiledGUIContainer.draw(GUI::DrawHardware::CPU);
+
+  ASSERT_THAT(memcmp(frameBuffer.getPointer(), tiledFrameBuffer.getPointer(), frameBuffer.getSize()), Eq(0));
+}
+
+TEST_F(AGUIContainer, DrawWithDMA2DInTiledModeExecutesOneDMA2DCommandQueueBatchPerTileEndingWithStoreOfTheTile)
+{
+  captureDMA2DCommandQueueCompletedCallback();
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0, .y = 0, .width = 50u, .height = 50u }));
+  ON_CALL(guiObjectMock1, isOpaque())
+    .WillByDefault(Return(true));
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.enableTiledRendering(tileFrameBuffer);
+  guiContainerWithDMA2D.registerDrawCompletedCallback(callbackDescription);
+
+  EXPECT_CALL(guiObjectMock1, enqueueDMA2DDrawCommands())
+    .Times(3u);
+  EXPECT_CALL(dma2dMock, enqueueCopyBitmap(_))
+    .Times(3u);
+  EXPECT_CALL(dma2dMock, executeCommandQueue(_))
+    .Times(3u);
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::DMA2D);
+  simulateDMA2DCommandQueueCompleted();
+  guiContainerWithDMA2D.runtimeTask();
+  simulateDMA2DCommandQueueCompleted();
+  guiContainerWithDMA2D.runtimeTask();
+  assertThatCallbackIsNotCalled();
+  simulateDMA2DCommandQueueCompleted();
+  guiContainerWithDMA2D.runtimeTask();
+  assertThatCallbackIsCalled();
+}
+
+TEST_F(AGUIContainer, DrawWithDMA2DInTiledModeStartsNextTileFromRuntimeTaskAndNotFromDMA2DCommandQueueCompletedCallback)
+{
+  captureDMA2DCommandQueueCompletedCallback();
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0, .y = 0, .width = 50u, .height = 50u }));
+  ON_CALL(guiObjectMock1, isOpaque())
+    .WillByDefault(Return(true));
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.enableTiledRendering(tileFrameBuffer);
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::DMA2D);
+
+  EXPECT_CALL(guiObjectMock1, enqueueDMA2DDrawCommands())
+    .Times(0u);
+  EXPECT_CALL(dma2dMock, executeCommandQueue(_))
+    .Times(0u);
+  simulateDMA2DCommandQueueCompleted();
+  Mock::VerifyAndClearExpectations(&guiObjectMock1);
+  Mock::VerifyAndClearExpectations(&dma2dMock);
+
+  EXPECT_CALL(guiObjectMock1, enqueueDMA2DDrawCommands())
+    .Times(1u);
+  EXPECT_CALL(dma2dMock, executeCommandQueue(_))
+    .Times(1u);
+  guiContainerWithDMA2D.runtimeTask();
+}
+
+TEST_F(AGUIContainer, DrawWithDMA2DInTiledModeExecutesDMA2DCommandQueueAgainFromRuntimeTaskIfDMA2DWasBusy)
+{
+  ON_CALL(guiObjectMock1, getRegion())
+    .WillByDefault(Return(GUI::Region{ .x = 0, .y = 0, .width = 50u, .height = 50u }));
+  ON_CALL(guiObjectMock1, isOpaque())
+    .WillByDefault(Return(true));
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.enableTiledRendering(tileFrameBuffer);
+  guiContainerWithDMA2D.registerDrawCompletedCallback(callbackDescription);
+  EXPECT_CALL(dma2dMock, executeCommandQueue(_))
+    .WillOnce(Return(DMA2D::ErrorCode::BUSY))
+    .WillRepeatedly([&](const DMA2D::CallbackDescription &callbackDescription)
+    {
+      dma2dCommandQueueCompletedCallback = callbackDescription;
+      return DMA2D::ErrorCode::OK;
+    });
+  EXPECT_CALL(guiObjectMock1, setFrameBuffer(Ref(tileFrameBuffer)))
+    .Times(AtLeast(1u));
+  EXPECT_CALL(guiObjectMock1, setFrameBuffer(Ref(frameBuffer)))
+    .Times(1u);
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::DMA2D);
+  guiContainerWithDMA2D.runtimeTask();
+  assertThatCallbackIsNotCalled();
+
+  for (uint32_t tile = 0u; tile < 3u; ++tile)
+  {
+    simulateDMA2DCommandQueueCompleted();
+    guiContainerWithDMA2D.runtimeTask();
+  }
+  assertThatCallbackIsCalled();
+}
+
+TEST_F(AGUIContainer, DrawWithDMA2DInTiledModeLoadsAndStoresOnlyDamagedPartOfTheTileIfItIsNotCoveredByOpaqueObject)
+{
+  const GUI::Region DAMAGED_REGION = { .x = 5, .y = 25, .width = 10u, .height = 10u };
+  guiContainerWithDMA2D.addObject(&guiObjectMock1, 5u);
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::CPU);
+  guiContainerWithDMA2D.enableTiledRendering(tileFrameBuffer);
+  guiContainerWithDMA2D.invalidateRegion(DAMAGED_REGION);
+
+  EXPECT_CALL(dma2dMock, enqueueCopyBitmap(AllOf(
+    Field(&DMA2D::CopyBitmapConfig::dimension, AllOf(
+      Field(&DMA2D::Dimension::width, Eq(DAMAGED_REGION.width)),
+      Field(&DMA2D::Dimension::height, Eq(DAMAGED_REGION.height)))),
+    Field(&DMA2D::CopyBitmapConfig::destinationRectanglePosition, AllOf(
+      Field(&DMA2D::Position::x, Eq(DAMAGED_REGION.x)),
+      Field(&DMA2D::Position::y, Eq(DAMAGED_REGION.y)))))))
+    .Times(2u);
+
+  guiContainerWithDMA2D.draw(GUI::DrawHardware::DMA2D);
 }
\ No newline at end of file
@@ -0,0 +1,196 @@
+#include "GUIContainer.h"
+#include "GUIRectangle.h"
+#include "GUIImage.h"
+#include "FrameBuffer.h"
+#include "DMA2DEmulator.h"
+#include "SysTickMock.h"
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <cstdint>
+#include <cstring>
+
+
+using namespace ::testing;
+
+
+//! Draws the same scene once with CPU and once with the emulated DMA2D, both frames have to be identical
+template <IFrameBuffer::ColorFormat t_colorFormat>
+class AGUIDMA2DEmulation : public Test
+{
+public:
+
+  static constexpr uint16_t FRAME_BUFFER_WIDTH  = 64u;
+  static constexpr uint16_t FRAME_BUFFER_HEIGHT = 48u;
+  static constexpr uint16_t BITMAP_WIDTH        = 24u;
+  static constexpr uint16_t BITMAP_HEIGHT       = 20u;
+  static constexpr uint32_t CONTAINER_CAPACITY  = 8u;
+
+  //! Scene objects drawn into one frame buffer
+  struct Scene
+  {
+    Scene(DMA2D &dma2d, SysTick &sysTick, IFrameBuffer &frameBuffer):
+      container(objectInfoList, frameBuffer, dma2d),
+      background(dma2d, sysTick, frameBuffer),
+      offScreenRectangle(dma2d, sysTick, frameBuffer),
+      argb8888Image(dma2d, sysTick, frameBuffer),
+      l8Image(dma2d, sysTick, frameBuffer)
+    {}
+
+    ArrayList<GUI::Container::ObjectInfo, CONTAINER_CAPACITY> objectInfoList;
+    GUI::Container container;
+    GUI::Rectangle background;
+    GUI::Rectangle offScreenRectangle;
+    GUI::Image argb8888Image;
+    GUI::Image l8Image;
+  };
+
+  NiceMock<SysTickMock> sysTickMock;
+  DMA2DEmulator dma2dEmulator;
+  FrameBuffer<FRAME_BUFFER_WIDTH, FRAME_BUFFER_HEIGHT, t_colorFormat> cpuFrameBuffer;
+  FrameBuffer<FRAME_BUFFER_WIDTH, FRAME_BUFFER_HEIGHT, t_colorFormat> dma2dFrameBuffer;
+  Scene cpuScene    = Scene(dma2dEmulator, sysTickMock, cpuFrameBuffer);
+  Scene dma2dScene  = Scene(dma2dEmulator, sysTickMock, dma2dFrameBuffer);
+
+  uint8_t argb8888Bitmap[BITMAP_WIDTH * BITMAP_HEIGHT * 4u];
+  uint8_t l8Bitmap[BITMAP_WIDTH * BITMAP_HEIGHT];
+  uint32_t clut[4];
+
+  void initScene(Scene &scene);
+  void completeDMA2DSceneDrawing(void);
+
+  void SetUp() override;
+};
+
+template <IFrameBuffer::ColorFormat t_colorFormat>
+void AGUIDMA2DEmulation<t_colorFormat>::SetUp()
+{
+  for (uint32_t i = 0u; i < sizeof(argb8888Bitmap); ++i)
+  {
+    argb8888Bitmap[i] = static_cast<uint8_t>(i * 37u + 11u);
+  }
+
+  for (uint32_t i = 0u; i < sizeof(l8Bitmap); ++i)
+  {
+    l8Bitmap[i] = static_cast<uint8_t>(i % 4u);
+  }
+
+  clut[0] = 0xFF1F2F3Fu;
+  clut[1] = 0x80FF0000u;
+  clut[2] = 0x00000000u;
+  clut[3] = 0xC000FF7Fu;
+
+  memset(cpuFrameBuffer.getPointer(), 0x5A, cpuFrameBuffer.getSize());
+  memset(dma2dFrameBuffer.getPointer(), 0x5A, dma2dFrameBuffer.getSize());
+
+  initScene(cpuScene);
+  initScene(dma2dScene);
+}
+
+template <IFrameBuffer::ColorFormat t_colorFormat>
+void AGUIDMA2DEmulation<t_colorFormat>::completeDMA2DSceneDrawing(void)
+{
+  // container enqueues the next batch from its runtime task, so transfers are completed until none is started
+  while (dma2dEmulator.completeAllTransfers() > 0u)
+  {
+    dma2dScene.container.runtimeTask();
+  }
+}
+
+template <IFrameBuffer::ColorFormat t_colorFormat>
+void AGUIDMA2DEmulation<t_colorFormat>::initScene(Scene &scene)
+{
+  scene.background.init(
+  {
+    .baseDescription =
+    {
+      .dimension = { .width = 40u, .height = 30u },
+      .position  = { .x = 4, .y = 6, .tag = GUI::Position::Tag::TOP_LEFT_CORNER }
+    },
+    .color = { .red = 200u, .green = 100u, .blue = 50u }
+  });
+
+  scene.offScreenRectangle.init(
+  {
+    .baseDescription =
+    {
+      .dimension = { .width = 30u, .height = 20u },
+      .position  = { .x = 50, .y = -8, .tag = GUI::Position::Tag::TOP_LEFT_CORNER }
+    },
+    .color = { .red = 10u, .green = 220u, .blue = 130u }
+  });
+
+  scene.argb8888Image.init(
+  {
+    .baseDescription =
+    {
+      .dimension = { .width = BITMAP_WIDTH, .height = BITMAP_HEIGHT },
+      .position  = { .x = 30, .y = 20, .tag = GUI::Position::Tag::TOP_LEFT_CORNER }
+    },
+    .bitmapDescription =
+    {
+      .colorFormat  = GUI::ColorFormat::ARGB8888,
+      .dimension    = { .width = BITMAP_WIDTH, .height = BITMAP_HEIGHT },
+      .copyPosition = { .x = 0, .y = 0, .tag = GUI::Position::Tag::TOP_LEFT_CORNER },
+      .bitmapPtr    = argb8888Bitmap,
+      .clutPtr      = nullptr,
+      .clutSize     = 0u
+    }
+  });
+
+  scene.l8Image.init(
+  {
+    .baseDescription =
+    {
+      .dimension = { .width = BITMAP_WIDTH, .height = BITMAP_HEIGHT },
+      .position  = { .x = -6, .y = 2, .tag = GUI::Position::Tag::TOP_LEFT_CORNER }
+    },
+    .bitmapDescription =
+    {
+      .colorFormat  = GUI::ColorFormat::L8,
+      .dimension    = { .width = BITMAP_WIDTH, .height = BITMAP_HEIGHT },
+      .copyPosition = { .x = 0, .y = 0, .tag = GUI::Position::Tag::TOP_LEFT_CORNER },
+      .bitmapPtr    = l8Bitmap,
+      .clutPtr      = clut,
+      .clutSize     = 4u
+    }
+  });
+
+  scene.container.addObject(&scene.background, 1u);
+  scene.container.addObject(&scene.offScreenRectangle, 2u);
+  scene.container.addObject(&scene.argb8888Image, 3u);
+  scene.container.addObject(&scene.l8Image, 4u);
+}
+
+using AGUIDMA2DEmulationRGB888 = AGUIDMA2DEmulation<IFrameBuffer::ColorFormat::RGB888>;
+using AGUIDMA2DEmulationRGB565 = AGUIDMA2DEmulation<IFrameBuffer::ColorFormat::RGB565>;
+
+
+TEST_F(AGUIDMA2DEmulationRGB888, DMA2DDrawnFrameIsPixelForPixelEqualToCPUDrawnFrame)
+{
+  cpuScene.container.draw(GUI::DrawHardware::CPU);
+  dma2dScene.container.draw(GUI::DrawHardware::DMA2D);
+  completeDMA2DSceneDrawing();
+
+  ASSERT_THAT(dma2dScene.container.isDrawCompleted(), Eq(true));
+  ASSERT_THAT(reinterpret_cast<uint8_t*>(cpuFrameBuffer.getPointer())[3u * (20u + 10u * FRAME_BUFFER_WIDTH)], Ne(0x5Au));
+  ASSERT_THAT(memcmp(cpuFrameBuffer.getPointer(), dma2dFrameBuffer.getPointer(), cpuFrameBuffer.getSize()), Eq(0));
+}
+
+TEST_F(AGUIDMA2DEmulationRGB565, DMA2DDrawnFrameIsPixelForPixelEqualToCPUDrawnFrame)
+{
+  cpuScene.container.draw(GUI::DrawHardware::CPU);
+  dma2dScene.container.draw(GUI::DrawHardware::DMA2D);
+  completeDMA2DSceneDrawing();
+
+  ASSERT_THAT(dma2dScene.container.isDrawCompleted(), Eq(true));
+  ASSERT_THAT(memcmp(cpuFrameBuffer.getPointer(), dma2dFrameBuffer.getPointer(), cpuFrameBuffer.getSize()), Eq(0));
+}
+
+TEST_F(AGUIDMA2DEmulationRGB888, DMA2DDrawingOfSceneIsNotCompletedUntilEmulatedTransfersAreCompleted)
+{
+  dma2dScene.container.draw(GUI::DrawHardware::DMA2D);
+
+  ASSERT_THAT(dma2dScene.container.isDrawCompleted(), Eq(false));
+  ASSERT_THAT(dma2dEmulator.completeAllTransfers(), Eq(4u));
+  ASSERT_THAT(dma2dEmulator.getEstimatedCycleCount(), Gt(0u));
+}
\ No newline at end of file
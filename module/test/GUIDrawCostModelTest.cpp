@@ -0,0 +1,106 @@
+#include "GUIDrawCostModel.h"
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <cstdint>
+
+
+using namespace ::testing;
+
+
+class AGUIDrawCostModel : public Test
+{
+public:
+
+  static constexpr float COST_TOLERANCE_IN_US = 0.01f;
+
+  GUI::DrawCostModel drawCostModel;
+
+  void feedLinearDrawingTimes(GUI::DrawHardware drawHardware, float setupCostInUs, float costPerPixelInUs);
+  void selectDrawHardwareNTimes(uint32_t n, uint64_t visiblePartArea);
+};
+
+void AGUIDrawCostModel::feedLinearDrawingTimes(
+  GUI::DrawHardware drawHardware,
+  float setupCostInUs,
+  float costPerPixelInUs)
+{
+  static constexpr uint64_t VISIBLE_PART_AREAS[] = { 100u, 2500u, 400u, 10000u, 900u, 6400u };
+
+  for (uint32_t i = 0u; i < 10u; ++i)
+  {
+    for (uint64_t visiblePartArea : VISIBLE_PART_AREAS)
+    {
+      const float drawingTimeInUs = setupCostInUs + costPerPixelInUs * static_cast<float>(visiblePartArea);
+      drawCostModel.update(drawHardware, visiblePartArea, static_cast<uint64_t>(drawingTimeInUs));
+    }
+  }
+}
+
+void AGUIDrawCostModel::selectDrawHardwareNTimes(uint32_t n, uint64_t visiblePartArea)
+{
+  for (uint32_t i = 0u; i < n; ++i)
+  {
+    drawCostModel.selectDrawHardware(visiblePartArea);
+  }
+}
+
+
+TEST_F(AGUIDrawCostModel, IsNotCalibratedForAnyDrawHardwareBeforeFirstMeasurement)
+{
+  ASSERT_THAT(drawCostModel.isCalibrated(GUI::DrawHardware::CPU), Eq(false));
+  ASSERT_THAT(drawCostModel.isCalibrated(GUI::DrawHardware::DMA2D), Eq(false));
+}
+
+TEST_F(AGUIDrawCostModel, SelectDrawHardwarePicksUncalibratedCPUFirstAndThenUncalibratedDMA2D)
+{
+  ASSERT_THAT(drawCostModel.selectDrawHardware(100u), Eq(GUI::DrawHardware::CPU));
+  drawCostModel.update(GUI::DrawHardware::CPU, 100u, 100u);
+
+  ASSERT_THAT(drawCostModel.selectDrawHardware(100u), Eq(GUI::DrawHardware::DMA2D));
+}
+
+TEST_F(AGUIDrawCostModel, FitsSetupCostAndCostPerPixelFromDrawsOfDifferentSizes)
+{
+  feedLinearDrawingTimes(GUI::DrawHardware::DMA2D, 40.0f, 0.25f);
+
+  ASSERT_THAT(drawCostModel.getSetupCostInUs(GUI::DrawHardware::DMA2D), FloatNear(40.0f, 10.0f * COST_TOLERANCE_IN_US));
+  ASSERT_THAT(drawCostModel.getCostPerPixelInUs(GUI::DrawHardware::DMA2D), FloatNear(0.25f, COST_TOLERANCE_IN_US));
+}
+
+TEST_F(AGUIDrawCostModel, AttributesWholeDrawingTimeToPixelsIfAllDrawsHaveTheSameSize)
+{
+  drawCostModel.update(GUI::DrawHardware::CPU, 400u, 200u);
+  drawCostModel.update(GUI::DrawHardware::CPU, 400u, 200u);
+
+  ASSERT_THAT(drawCostModel.getSetupCostInUs(GUI::DrawHardware::CPU), FloatEq(0.0f));
+  ASSERT_THAT(drawCostModel.getCostPerPixelInUs(GUI::DrawHardware::CPU), FloatEq(0.5f));
+}
+
+TEST_F(AGUIDrawCostModel, SelectDrawHardwarePicksCPUForSmallAreaAndDMA2DForLargeAreaIfDMA2DHasHigherSetupCost)
+{
+  feedLinearDrawingTimes(GUI::DrawHardware::CPU, 2.0f, 1.0f);
+  feedLinearDrawingTimes(GUI::DrawHardware::DMA2D, 60.0f, 0.125f);
+
+  ASSERT_THAT(drawCostModel.selectDrawHardware(16u), Eq(GUI::DrawHardware::CPU));
+  ASSERT_THAT(drawCostModel.selectDrawHardware(4096u), Eq(GUI::DrawHardware::DMA2D));
+}
+
+TEST_F(AGUIDrawCostModel, SelectDrawHardwarePicksMoreExpensiveDrawHardwareOncePerExplorationPeriod)
+{
+  feedLinearDrawingTimes(GUI::DrawHardware::CPU, 2.0f, 1.0f);
+  feedLinearDrawingTimes(GUI::DrawHardware::DMA2D, 60.0f, 0.125f);
+
+  selectDrawHardwareNTimes(GUI::DrawCostModel::EXPLORATION_PERIOD - 1u, 16u);
+
+  ASSERT_THAT(drawCostModel.selectDrawHardware(16u), Eq(GUI::DrawHardware::DMA2D));
+  ASSERT_THAT(drawCostModel.selectDrawHardware(16u), Eq(GUI::DrawHardware::CPU));
+}
+
+TEST_F(AGUIDrawCostModel, ResetForgetsAllMeasurements)
+{
+  drawCostModel.update(GUI::DrawHardware::CPU, 400u, 200u);
+
+  drawCostModel.reset();
+
+  ASSERT_THAT(drawCostModel.isCalibrated(GUI::DrawHardware::CPU), Eq(false));
+}
\ No newline at end of file
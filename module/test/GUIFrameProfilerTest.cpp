@@ -0,0 +1,230 @@
+#include "GUIFrameProfiler.h"
+#include "GUIObjectMock.h"
+#include "SysTickMock.h"
+#include "USARTMock.h"
+#include "StringBuilder.h"
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+using namespace ::testing;
+
+
+class AGUIFrameProfiler : public Test
+{
+public:
+
+  NiceMock<SysTickMock> sysTickMock;
+  GUI::FrameProfiler frameProfiler = GUI::FrameProfiler(sysTickMock);
+  NiceMock<GUIObjectMock> guiObjectMock1;
+  NiceMock<GUIObjectMock> guiObjectMock2;
+  NiceMock<GUIObjectMock> guiObjectMock3;
+  NiceMock<USARTMock> usartMock;
+  USARTLogger usartLogger = USARTLogger(usartMock);
+  StringBuilder<64u> stringBuilder;
+
+  //! SysTick is simulated with 1 us per tick
+  uint64_t m_currentTick;
+
+  void advanceTimeInUs(uint64_t timeInUs);
+  void profileFrameWithTotalTime(uint64_t totalTimeInUs);
+
+  void SetUp() override;
+};
+
+void AGUIFrameProfiler::SetUp()
+{
+  m_currentTick = 1000u;
+
+  ON_CALL(sysTickMock, getTicks())
+    .WillByDefault([&](void)
+    {
+      return m_currentTick;
+    });
+
+  ON_CALL(sysTickMock, getElapsedTimeInUs(_))
+    .WillByDefault([&](uint64_t timestamp)
+    {
+      return m_currentTick - timestamp;
+    });
+}
+
+void AGUIFrameProfiler::advanceTimeInUs(uint64_t timeInUs)
+{
+  m_currentTick += timeInUs;
+}
+
+void AGUIFrameProfiler::profileFrameWithTotalTime(uint64_t totalTimeInUs)
+{
+  frameProfiler.startFrame();
+  advanceTimeInUs(totalTimeInUs);
+  frameProfiler.endFrame();
+}
+
+
+TEST_F(AGUIFrameProfiler, GetStatisticsReturnsZeroFrameCountBeforeAnyFrameIsProfiled)
+{
+  const GUI::FrameProfiler::Statistics statistics = frameProfiler.getStatistics(GUI::FrameProfiler::Metric::TOTAL_TIME);
+
+  ASSERT_THAT(statistics.frameCount, Eq(0u));
+}
+
+TEST_F(AGUIFrameProfiler, EndFrameRecordsTimeElapsedSinceStartFrameAsFrameTotalTime)
+{
+  profileFrameWithTotalTime(1234u);
+
+  ASSERT_THAT(frameProfiler.getLastFrameProfile().totalTimeInUs, Eq(1234u));
+  ASSERT_THAT(frameProfiler.isFrameOngoing(), Eq(false));
+}
+
+TEST_F(AGUIFrameProfiler, AddCPUDrawingAddsDrawingTimeToCPUTimeAndPixelsToPixelCountOfFrame)
+{
+  frameProfiler.startFrame();
+  const uint64_t startTimestamp = frameProfiler.getTimestamp();
+  advanceTimeInUs(300u);
+  frameProfiler.addCPUDrawing(&guiObjectMock1, 5u, startTimestamp, 400u);
+  frameProfiler.endFrame();
+
+  ASSERT_THAT(frameProfiler.getLastFrameProfile().cpuTimeInUs, Eq(300u));
+  ASSERT_THAT(frameProfiler.getLastFrameProfile().dma2dTimeInUs, Eq(0u));
+  ASSERT_THAT(frameProfiler.getLastFrameProfile().pixelCount, Eq(400u));
+}
+
+TEST_F(AGUIFrameProfiler, ObjectDrawingCompletedAfterItsDrawCallReturnedIsSplitIntoCPUAndDMA2DTime)
+{
+  frameProfiler.startFrame();
+  const uint32_t objectDrawingId = frameProfiler.startObjectDrawing(&guiObjectMock1, 5u, 400u);
+  advanceTimeInUs(20u);
+  frameProfiler.returnFromObjectDrawing(objectDrawingId);
+  advanceTimeInUs(180u);
+  frameProfiler.endObjectDrawing();
+  frameProfiler.endFrame();
+
+  ASSERT_THAT(frameProfiler.getLastFrameProfile().cpuTimeInUs, Eq(20u));
+  ASSERT_THAT(frameProfiler.getLastFrameProfile().dma2dTimeInUs, Eq(180u));
+  ASSERT_THAT(frameProfiler.getLastFrameProfile().topObjects[0].drawingTimeInUs, Eq(200u));
+}
+
+TEST_F(AGUIFrameProfiler, ObjectDrawingCompletedBeforeItsDrawCallReturnedIsAccountedAsCPUTime)
+{
+  frameProfiler.startFrame();
+  const uint32_t objectDrawingId = frameProfiler.startObjectDrawing(&guiObjectMock1, 5u, 400u);
+  advanceTimeInUs(150u);
+  frameProfiler.endObjectDrawing();
+  frameProfiler.returnFromObjectDrawing(objectDrawingId);
+  frameProfiler.endFrame();
+
+  ASSERT_THAT(frameProfiler.getLastFrameProfile().cpuTimeInUs, Eq(150u));
+  ASSERT_THAT(frameProfiler.getLastFrameProfile().dma2dTimeInUs, Eq(0u));
+}
+
+TEST_F(AGUIFrameProfiler, DMA2DBatchTimeIsSplitAmongBatchObjectsInProportionToTheirPixelCounts)
+{
+  frameProfiler.startFrame();
+  frameProfiler.addDMA2DBatchObject(&guiObjectMock1, 5u, 300u);
+  frameProfiler.addDMA2DBatchObject(&guiObjectMock2, 10u, 100u);
+  frameProfiler.startDMA2DBatch();
+  advanceTimeInUs(400u);
+  frameProfiler.endDMA2DBatch();
+  frameProfiler.endFrame();
+
+  const GUI::FrameProfiler::FrameProfile &frameProfile = frameProfiler.getLastFrameProfile();
+  ASSERT_THAT(frameProfile.dma2dTimeInUs, Eq(400u));
+  ASSERT_THAT(frameProfile.pixelCount, Eq(400u));
+  ASSERT_THAT(frameProfile.topObjects[0].zIndex, Eq(5u));
+  ASSERT_THAT(frameProfile.topObjects[0].drawingTimeInUs, Eq(300u));
+  ASSERT_THAT(frameProfile.topObjects[1].zIndex, Eq(10u));
+  ASSERT_THAT(frameProfile.topObjects[1].drawingTimeInUs, Eq(100u));
+}
+
+TEST_F(AGUIFrameProfiler, TopObjectsAreSortedFromTheMostExpensiveOneAndLimitedToTopObjectCount)
+{
+  frameProfiler.startFrame();
+  for (uint32_t zIndex = 1u; zIndex <= (GUI::FrameProfiler::TOP_OBJECT_COUNT + 2u); ++zIndex)
+  {
+    const uint64_t startTimestamp = frameProfiler.getTimestamp();
+    advanceTimeInUs(10u * zIndex);
+    frameProfiler.addCPUDrawing(&guiObjectMock1, zIndex, startTimestamp, 1u);
+  }
+  frameProfiler.endFrame();
+
+  const GUI::FrameProfiler::FrameProfile &frameProfile = frameProfiler.getLastFrameProfile();
+  ASSERT_THAT(frameProfile.topObjectCount, Eq(GUI::FrameProfiler::TOP_OBJECT_COUNT));
+  for (uint32_t i = 0u; i < GUI::FrameProfiler::TOP_OBJECT_COUNT; ++i)
+  {
+    ASSERT_THAT(frameProfile.topObjects[i].zIndex, Eq(GUI::FrameProfiler::TOP_OBJECT_COUNT + 2u - i));
+  }
+}
+
+TEST_F(AGUIFrameProfiler, ObjectDrawnSeveralTimesInFrameIsAccountedAsOneTopObject)
+{
+  frameProfiler.startFrame();
+  for (uint32_t i = 0u; i < 2u; ++i)
+  {
+    const uint64_t startTimestamp = frameProfiler.getTimestamp();
+    advanceTimeInUs(50u);
+    frameProfiler.addCPUDrawing(&guiObjectMock1, 5u, startTimestamp, 10u);
+  }
+  frameProfiler.endFrame();
+
+  const GUI::FrameProfiler::FrameProfile &frameProfile = frameProfiler.getLastFrameProfile();
+  ASSERT_THAT(frameProfile.topObjectCount, Eq(1u));
+  ASSERT_THAT(frameProfile.topObjects[0].drawingTimeInUs, Eq(100u));
+  ASSERT_THAT(frameProfile.topObjects[0].pixelCount, Eq(20u));
+}
+
+TEST_F(AGUIFrameProfiler, GetStatisticsReturnsMinAverageMaxAndP99OfProfiledFrames)
+{
+  for (uint64_t totalTimeInUs = 100u; totalTimeInUs >= 1u; --totalTimeInUs)
+  {
+    profileFrameWithTotalTime(totalTimeInUs);
+  }
+
+  const GUI::FrameProfiler::Statistics statistics = frameProfiler.getStatistics(GUI::FrameProfiler::Metric::TOTAL_TIME);
+
+  ASSERT_THAT(statistics.frameCount, Eq(100u));
+  ASSERT_THAT(statistics.min, Eq(1u));
+  ASSERT_THAT(statistics.average, Eq(50u));
+  ASSERT_THAT(statistics.max, Eq(100u));
+  ASSERT_THAT(statistics.p99, Eq(99u));
+}
+
+TEST_F(AGUIFrameProfiler, GetStatisticsIsCalculatedOnlyOverTheLastFrameHistoryLengthFrames)
+{
+  profileFrameWithTotalTime(5000u);
+  for (uint32_t i = 0u; i < GUI::FrameProfiler::FRAME_HISTORY_LENGTH; ++i)
+  {
+    profileFrameWithTotalTime(10u);
+  }
+
+  const GUI::FrameProfiler::Statistics statistics = frameProfiler.getStatistics(GUI::FrameProfiler::Metric::TOTAL_TIME);
+
+  ASSERT_THAT(statistics.frameCount, Eq(GUI::FrameProfiler::FRAME_HISTORY_LENGTH));
+  ASSERT_THAT(statistics.max, Eq(10u));
+}
+
+TEST_F(AGUIFrameProfiler, DumpWritesStatisticsAndTopObjectsOfTheLastFrameLineByLineViaUSARTLogger)
+{
+  std::vector<std::string> writtenLines;
+  ON_CALL(usartMock, write(_, _))
+    .WillByDefault([&](const void *messagePtr, uint32_t messageLength)
+    {
+      writtenLines.emplace_back(reinterpret_cast<const char*>(messagePtr), messageLength);
+      return USART::ErrorCode::OK;
+    });
+  frameProfiler.startFrame();
+  const uint64_t startTimestamp = frameProfiler.getTimestamp();
+  advanceTimeInUs(40u);
+  frameProfiler.addCPUDrawing(&guiObjectMock1, 7u, startTimestamp, 25u);
+  frameProfiler.endFrame();
+
+  frameProfiler.dump(usartLogger, stringBuilder);
+
+  ASSERT_THAT(writtenLines.size(), Eq(6u));
+  ASSERT_THAT(writtenLines[0], Eq("frames: 1\r\n"));
+  ASSERT_THAT(writtenLines[1], Eq("total [us]: min 40 avg 40 max 40 p99 40\r\n"));
+  ASSERT_THAT(writtenLines[5], Eq("top 1: z 7 40 us 25 px\r\n"));
+}
\ No newline at end of file
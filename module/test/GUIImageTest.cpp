@@ -5,6 +5,7 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include <cstdint>
+#include <cstring>
 
 
 using namespace ::testing;
@@ -64,6 +65,9 @@ public:
   void assertThatDMA2DCopyBitmapDrawCompletedCallbackWasOk(void);
 
   void setDMA2DTransferOngoingStateToTrue(void);
+  void assertThatRGB565FrameBufferIsRGB565ConversionOfRGB888FrameBuffer(
+    const IFrameBuffer &rgb565FrameBuffer,
+    const IFrameBuffer &rgb888FrameBuffer);
 
   void SetUp() override;
 
@@ -213,6 +217,26 @@ void AGUIImage::initTestBitmaps(void)
   }
 }
 
+void AGUIImage::assertThatRGB565FrameBufferIsRGB565ConversionOfRGB888FrameBuffer(
+  const IFrameBuffer &rgb565FrameBuffer,
+  const IFrameBuffer &rgb888FrameBuffer)
+{
+  const uint16_t *rgb565FrameBufferPtr = reinterpret_cast<const uint16_t*>(rgb565FrameBuffer.getPointer());
+  const uint8_t *rgb888FrameBufferPtr  = reinterpret_cast<const uint8_t*>(rgb888FrameBuffer.getPointer());
+
+  for (uint32_t pixelIdx = 0u; pixelIdx < (rgb565FrameBuffer.getWidth() * rgb565FrameBuffer.getHeight()); ++pixelIdx)
+  {
+    const GUI::Color rgb888Color =
+    {
+      .red   = rgb888FrameBufferPtr[3u * pixelIdx + 2u],
+      .green = rgb888FrameBufferPtr[3u * pixelIdx + 1u],
+      .blue  = rgb888FrameBufferPtr[3u * pixelIdx]
+    };
+
+    ASSERT_THAT(rgb565FrameBufferPtr[pixelIdx], Eq(rgb888Color.toRGB565()));
+  }
+}
+
 void AGUIImage::setDefaultFrameBufferColor(IFrameBuffer &frameBuffer)
 {
   uint8_t *frameBufferPtr = reinterpret_cast<uint8_t*>(frameBuffer.getPointer());
@@ -571,6 +595,16 @@ TEST_F(AGUIImage, InitFailsIfGivenFrameBufferColorFormatIsNotSupported)
   ASSERT_THAT(errorCode, Eq(GUI::ErrorCode::UNSUPPORTED_FBUFF_COLOR_FORMAT));
 }
 
+TEST_F(AGUIImage, InitSucceedsIfGivenFrameBufferColorFormatIsRGB565)
+{
+  FrameBuffer<1u, 1u, IFrameBuffer::ColorFormat::RGB565> rgb565FrameBuffer;
+  GUI::Image guiImage = GUI::Image(dma2dMock, sysTickMock, rgb565FrameBuffer);
+
+  const GUI::ErrorCode errorCode = guiImage.init(guiImageDescription);
+
+  ASSERT_THAT(errorCode, Eq(GUI::ErrorCode::OK));
+}
+
 TEST_F(AGUIImage, GetBitmapReturnsPointerToAssociatedBitmap)
 {
   guiImageDescription.bitmapDescription.bitmapPtr = reinterpret_cast<const void*>(&m_testRGB888Bitmap);
@@ -751,6 +785,52 @@ TEST_F(AGUIImage, DrawWithCPUDrawsARGB8888BitmapOntoAssociatedRGB888FrameBufferC
   assertThatGUIImageWithARGB8888BitmapIsDrawnCorrectlyOntoFrameBufferWithRGB888ColorFormat(guiImage);
 }
 
+TEST_F(AGUIImage, DrawWithCPUDrawsRGB888BitmapOntoRGB565FrameBufferTheSameAsOntoRGB888FrameBufferOnlyWithReducedPrecision)
+{
+  FrameBuffer<50u, 50u, IFrameBuffer::ColorFormat::RGB565> rgb565FrameBuffer;
+  GUI::Image rgb565GUIImage = GUI::Image(dma2dMock, sysTickMock, rgb565FrameBuffer);
+  memset(guiImageFrameBuffer.getPointer(), 0u, guiImageFrameBuffer.getSize());
+  memset(rgb565FrameBuffer.getPointer(), 0u, rgb565FrameBuffer.getSize());
+  guiImage.init(guiImageRGB888Description);
+  rgb565GUIImage.init(guiImageRGB888Description);
+
+  guiImage.draw(GUI::DrawHardware::CPU);
+  rgb565GUIImage.draw(GUI::DrawHardware::CPU);
+
+  assertThatRGB565FrameBufferIsRGB565ConversionOfRGB888FrameBuffer(rgb565FrameBuffer, guiImageFrameBuffer);
+}
+
+TEST_F(AGUIImage, DrawWithCPUBlendsARGB8888BitmapOntoRGB565FrameBufferTheSameAsOntoRGB888FrameBufferOnlyWithReducedPrecision)
+{
+  FrameBuffer<50u, 50u, IFrameBuffer::ColorFormat::RGB565> rgb565FrameBuffer;
+  GUI::Image rgb565GUIImage = GUI::Image(dma2dMock, sysTickMock, rgb565FrameBuffer);
+  memset(guiImageFrameBuffer.getPointer(), 0u, guiImageFrameBuffer.getSize());
+  memset(rgb565FrameBuffer.getPointer(), 0u, rgb565FrameBuffer.getSize());
+  guiImage.init(guiImageARGB8888Description);
+  rgb565GUIImage.init(guiImageARGB8888Description);
+
+  guiImage.draw(GUI::DrawHardware::CPU);
+  rgb565GUIImage.draw(GUI::DrawHardware::CPU);
+
+  assertThatRGB565FrameBufferIsRGB565ConversionOfRGB888FrameBuffer(rgb565FrameBuffer, guiImageFrameBuffer);
+}
+
+TEST_F(AGUIImage, DrawWithDMA2DCalledOnImageWithARGB8888BitmapBlendsItWithRGB565FrameBufferIfFrameBufferIsRGB565)
+{
+  FrameBuffer<50u, 50u, IFrameBuffer::ColorFormat::RGB565> rgb565FrameBuffer;
+  GUI::Image rgb565GUIImage = GUI::Image(dma2dMock, sysTickMock, rgb565FrameBuffer);
+  rgb565GUIImage.init(guiImageARGB8888Description);
+
+  EXPECT_CALL(dma2dMock, blendBitmap(AllOf(
+    Field(&DMA2D::BlendBitmapConfig::backgroundBufferConfig,
+      Field(&DMA2D::InputBufferConfiguration::colorFormat, Eq(DMA2D::InputColorFormat::RGB565))),
+    Field(&DMA2D::BlendBitmapConfig::destinationBufferConfig,
+      Field(&DMA2D::OutputBufferConfiguration::colorFormat, Eq(DMA2D::OutputColorFormat::RGB565))))))
+    .Times(1u);
+
+  rgb565GUIImage.draw(GUI::DrawHardware::DMA2D);
+}
+
 TEST_F(AGUIImage, DrawWithDMA2DCalledOnImageWithRGB888BitmapTriggersDMA2DCopyBitmapOperationWithAppropriateConfigParams)
 {
   guiImage.init(guiImageRGB888Description);
@@ -941,4 +1021,461 @@ TEST_F(AGUIImage, DrawARGB8888WithDMA2DSetsFunctionCallbackDMA2DDrawCompletedToB
   guiImage.draw(GUI::DrawHardware::DMA2D);
 
   assertThatDMA2DBlendBitmapDrawCompletedCallbackWasOk();
+}
+TEST_F(AGUIImage, GetBitmapVisiblePartCopyPositionIsShiftedByTheSameAmountAsVisiblePartIsShiftedByClipRegion)
+{
+  const GUI::Region CLIP_REGION = { .x = 12, .y = 9, .width = 20u, .height = 20u };
+  guiImageRGB888Description.baseDescription.position =
+  {
+    .x   = 5,
+    .y   = 5,
+    .tag = GUI::Position::Tag::TOP_LEFT_CORNER
+  };
+  guiImage.init(guiImageRGB888Description);
+  const GUI::Position bitmapCopyPosition = guiImage.getBitmapCopyPosition();
+
+  guiImage.setClipRegion(CLIP_REGION);
+
+  ASSERT_THAT(guiImage.getBitmapVisiblePartCopyPosition().x, Eq(bitmapCopyPosition.x + 7));
+  ASSERT_THAT(guiImage.getBitmapVisiblePartCopyPosition().y, Eq(bitmapCopyPosition.y + 4));
+}
+
+TEST_F(AGUIImage, DrawWithCPUCalledOnImageWithRGB888BitmapDrawsOnlyPixelsWhichLieInsideClipRegion)
+{
+  const GUI::Region CLIP_REGION = { .x = 12, .y = 9, .width = 6u, .height = 30u };
+  guiImageRGB888Description.baseDescription.position =
+  {
+    .x   = 5,
+    .y   = 5,
+    .tag = GUI::Position::Tag::TOP_LEFT_CORNER
+  };
+  guiImage.init(guiImageRGB888Description);
+  guiImage.setClipRegion(CLIP_REGION);
+
+  guiImage.draw(GUI::DrawHardware::CPU);
+
+  assertThatGUIImageWithRGB888BitmapIsDrawnCorrectlyOntoFrameBufferWithRGB888ColorFormat(guiImage);
+}
+
+TEST_F(AGUIImage, DrawWithDMA2DCalledOnImageWithARGB8888BitmapDisplaysOnlyPartOfImageWhichLiesInsideClipRegion)
+{
+  const GUI::Region CLIP_REGION = { .x = 8, .y = 9, .width = 2u, .height = 30u };
+  guiImageARGB8888Description.baseDescription.position =
+  {
+    .x   = 5,
+    .y   = 5,
+    .tag = GUI::Position::Tag::TOP_LEFT_CORNER
+  };
+  guiImage.init(guiImageARGB8888Description);
+  guiImage.setClipRegion(CLIP_REGION);
+  expectThatDMA2DBlendBitmapWillDisplayOnlyVisiblePartOfGUIImage(guiImage);
+
+  guiImage.draw(GUI::DrawHardware::DMA2D);
+
+  assertThatDMA2DBlendBitmapConfigParamsWereOk();
+}
+
+TEST_F(AGUIImage, SetBitmapReportsWholeImageAsDamaged)
+{
+  GUI::Region damagedRegion = { .x = 0, .y = 0, .width = 0u, .height = 0u };
+  guiImage.init(guiImageRGB888Description);
+  guiImage.registerDamagedRegionCallback(
+  {
+    .functionPtr = [](void *argument, const GUI::Region &region)
+    {
+      *reinterpret_cast<GUI::Region*>(argument) = region;
+    },
+    .argument = &damagedRegion
+  });
+
+  guiImage.setBitmap(guiImageARGB8888Description.bitmapDescription);
+
+  ASSERT_THAT(guiImage.getBitmapPtr(), Eq(guiImageARGB8888Description.bitmapDescription.bitmapPtr));
+  ASSERT_THAT(damagedRegion, Eq(guiImage.getRegion()));
+}
+
+TEST_F(AGUIImage, EnqueueDMA2DDrawCommandsCalledOnImageWithRGB888BitmapEnqueuesCopyBitmapCommand)
+{
+  guiImage.init(guiImageRGB888Description);
+  EXPECT_CALL(dma2dMock, enqueueCopyBitmap(_))
+    .Times(1u);
+  EXPECT_CALL(dma2dMock, copyBitmap(_))
+    .Times(0u);
+
+  const GUI::ErrorCode errorCode = guiImage.enqueueDMA2DDrawCommands();
+
+  ASSERT_THAT(errorCode, Eq(GUI::ErrorCode::OK));
+}
+
+TEST_F(AGUIImage, EnqueueDMA2DDrawCommandsCalledOnImageWithARGB8888BitmapEnqueuesBlendBitmapCommand)
+{
+  guiImage.init(guiImageARGB8888Description);
+  EXPECT_CALL(dma2dMock, enqueueBlendBitmap(_))
+    .Times(1u);
+  EXPECT_CALL(dma2dMock, blendBitmap(_))
+    .Times(0u);
+
+  const GUI::ErrorCode errorCode = guiImage.enqueueDMA2DDrawCommands();
+
+  ASSERT_THAT(errorCode, Eq(GUI::ErrorCode::OK));
+}
+
+TEST_F(AGUIImage, IsOpaqueIfBitmapColorFormatIsRGB888)
+{
+  guiImage.init(guiImageRGB888Description);
+
+  ASSERT_THAT(guiImage.isOpaque(), Eq(true));
+}
+
+TEST_F(AGUIImage, IsNotOpaqueIfBitmapColorFormatIsARGB8888)
+{
+  guiImage.init(guiImageARGB8888Description);
+
+  ASSERT_THAT(guiImage.isOpaque(), Eq(false));
+}
+
+TEST_F(AGUIImage, IsOpaqueIfBitmapColorFormatIsIndexedAndAllCLUTEntriesAreOpaque)
+{
+  const uint32_t clut[] = { 0xFF102030, 0xFFA0B0C0 };
+  guiImageDescription.bitmapDescription.colorFormat = GUI::ColorFormat::L8;
+  guiImageDescription.bitmapDescription.clutPtr     = clut;
+  guiImageDescription.bitmapDescription.clutSize    = 2u;
+  guiImage.init(guiImageDescription);
+
+  ASSERT_THAT(guiImage.isOpaque(), Eq(true));
+}
+
+TEST_F(AGUIImage, IsNotOpaqueIfBitmapColorFormatIsIndexedAndAnyCLUTEntryIsNotOpaque)
+{
+  const uint32_t clut[] = { 0xFF102030, 0x80A0B0C0 };
+  guiImageDescription.bitmapDescription.colorFormat = GUI::ColorFormat::L4;
+  guiImageDescription.bitmapDescription.clutPtr     = clut;
+  guiImageDescription.bitmapDescription.clutSize    = 2u;
+  guiImage.init(guiImageDescription);
+
+  ASSERT_THAT(guiImage.isOpaque(), Eq(false));
+}
+
+TEST_F(AGUIImage, DrawWithDMA2DCalledOnImageWithOpaqueL8BitmapTriggersDMA2DCopyBitmapOperationWithCLUTConfig)
+{
+  const uint32_t clut[] = { 0xFF102030, 0xFFA0B0C0 };
+  guiImageDescription.bitmapDescription.colorFormat = GUI::ColorFormat::L8;
+  guiImageDescription.bitmapDescription.clutPtr     = clut;
+  guiImageDescription.bitmapDescription.clutSize    = 2u;
+  guiImage.init(guiImageDescription);
+  DMA2D::CopyBitmapConfig copyBitmapConfig;
+  EXPECT_CALL(dma2dMock, copyBitmap(_))
+    .WillOnce(DoAll(SaveArg<0>(&copyBitmapConfig), Return(DMA2D::ErrorCode::OK)));
+
+  guiImage.draw(GUI::DrawHardware::DMA2D);
+
+  ASSERT_THAT(copyBitmapConfig.sourceBufferConfig.colorFormat, Eq(DMA2D::InputColorFormat::L8));
+  ASSERT_THAT(copyBitmapConfig.sourceBufferConfig.clutConfig.colorFormat, Eq(DMA2D::CLUTColorFormat::ARGB8888));
+  ASSERT_THAT(copyBitmapConfig.sourceBufferConfig.clutConfig.size, Eq(2u));
+  ASSERT_THAT(copyBitmapConfig.sourceBufferConfig.clutConfig.clutPtr, Eq(clut));
+}
+
+TEST_F(AGUIImage, DrawWithDMA2DCalledOnImageWithNotOpaqueL4BitmapTriggersDMA2DBlendBitmapOperationWithCLUTConfig)
+{
+  const uint32_t clut[] = { 0x00000000, 0xFFA0B0C0 };
+  guiImageDescription.baseDescription.position.tag  = GUI::Position::Tag::TOP_LEFT_CORNER;
+  guiImageDescription.bitmapDescription.colorFormat = GUI::ColorFormat::L4;
+  guiImageDescription.bitmapDescription.clutPtr     = clut;
+  guiImageDescription.bitmapDescription.clutSize    = 2u;
+  guiImage.init(guiImageDescription);
+  DMA2D::BlendBitmapConfig blendBitmapConfig;
+  EXPECT_CALL(dma2dMock, blendBitmap(_))
+    .WillOnce(DoAll(SaveArg<0>(&blendBitmapConfig), Return(DMA2D::ErrorCode::OK)));
+
+  guiImage.draw(GUI::DrawHardware::DMA2D);
+
+  ASSERT_THAT(blendBitmapConfig.foregroundBufferConfig.colorFormat, Eq(DMA2D::InputColorFormat::L4));
+  ASSERT_THAT(blendBitmapConfig.foregroundBufferConfig.clutConfig.size, Eq(2u));
+  ASSERT_THAT(blendBitmapConfig.foregroundBufferConfig.clutConfig.clutPtr, Eq(clut));
+}
+
+TEST_F(AGUIImage, DrawWithCPUCalledOnImageWithL8BitmapProducesSameResultAsImageWithEquivalentARGB8888Bitmap)
+{
+  constexpr uint16_t BITMAP_SIZE = 10u;
+  const uint32_t clut[] = { 0xFF102030, 0x80A0B0C0, 0x00FFFFFF, 0xFF00FF00 };
+  uint8_t l8Bitmap[BITMAP_SIZE * BITMAP_SIZE];
+  uint32_t argb8888Bitmap[BITMAP_SIZE * BITMAP_SIZE];
+  for (uint32_t i = 0u; i < BITMAP_SIZE * BITMAP_SIZE; ++i)
+  {
+    l8Bitmap[i]       = (i + i / BITMAP_SIZE) % 4u;
+    argb8888Bitmap[i] = clut[l8Bitmap[i]];
+  }
+  FrameBuffer<50u, 50u, IFrameBuffer::ColorFormat::RGB888> argb8888FrameBuffer;
+  setDefaultFrameBufferColor(guiImageFrameBuffer);
+  setDefaultFrameBufferColor(argb8888FrameBuffer);
+  GUI::Image argb8888GUIImage(dma2dMock, sysTickMock, argb8888FrameBuffer);
+  guiImageDescription.baseDescription.dimension   = { .width = BITMAP_SIZE, .height = BITMAP_SIZE };
+  guiImageDescription.bitmapDescription.dimension = { .width = BITMAP_SIZE, .height = BITMAP_SIZE };
+  guiImageDescription.bitmapDescription.colorFormat = GUI::ColorFormat::ARGB8888;
+  guiImageDescription.bitmapDescription.bitmapPtr   = argb8888Bitmap;
+  argb8888GUIImage.init(guiImageDescription);
+  guiImageDescription.bitmapDescription.colorFormat = GUI::ColorFormat::L8;
+  guiImageDescription.bitmapDescription.bitmapPtr   = l8Bitmap;
+  guiImageDescription.bitmapDescription.clutPtr     = clut;
+  guiImageDescription.bitmapDescription.clutSize    = 4u;
+  guiImage.init(guiImageDescription);
+
+  guiImage.draw(GUI::DrawHardware::CPU);
+  argb8888GUIImage.draw(GUI::DrawHardware::CPU);
+
+  ASSERT_THAT(std::memcmp(guiImageFrameBuffer.getPointer(), argb8888FrameBuffer.getPointer(), guiImageFrameBuffer.getSize()), Eq(0));
+}
+
+TEST_F(AGUIImage, DrawWithCPUCalledOnImageWithL4BitmapReadsFirstPixelFromLowNibble)
+{
+  const uint32_t clut[] = { 0xFF000000, 0xFF102030, 0xFFA0B0C0 };
+  const uint8_t l4Bitmap[] = { 0x21, 0x12 };
+  guiImageDescription.baseDescription.dimension   = { .width = 4u, .height = 1u };
+  guiImageDescription.baseDescription.position    = { .x = 5, .y = 5, .tag = GUI::Position::Tag::TOP_LEFT_CORNER };
+  guiImageDescription.bitmapDescription.dimension = { .width = 4u, .height = 1u };
+  guiImageDescription.bitmapDescription.colorFormat = GUI::ColorFormat::L4;
+  guiImageDescription.bitmapDescription.bitmapPtr   = l4Bitmap;
+  guiImageDescription.bitmapDescription.clutPtr     = clut;
+  guiImageDescription.bitmapDescription.clutSize    = 3u;
+  guiImage.init(guiImageDescription);
+  const uint8_t expectedPixels[] =
+  {
+    0x30, 0x20, 0x10,
+    0xC0, 0xB0, 0xA0,
+    0xC0, 0xB0, 0xA0,
+    0x30, 0x20, 0x10
+  };
+  const uint8_t *firstPixelPtr = reinterpret_cast<const uint8_t*>(guiImageFrameBuffer.getPointer()) +
+    3u * (5u * guiImageFrameBuffer.getWidth() + 5u);
+
+  guiImage.draw(GUI::DrawHardware::CPU);
+
+  ASSERT_THAT(std::memcmp(firstPixelPtr, expectedPixels, sizeof(expectedPixels)), Eq(0));
+}
+
+static uint32_t encodeARGB8888BitmapToRLE(const uint8_t *bitmapPtr, uint16_t width, uint16_t height, uint8_t *rleBitmapPtr)
+{
+  auto getRunType = [](uint8_t alpha)
+  {
+    return (0u == alpha) ? GUI::Image::RLERunType::TRANSPARENT :
+      ((255u == alpha) ? GUI::Image::RLERunType::OPAQUE : GUI::Image::RLERunType::BLENDED);
+  };
+  uint8_t *rlePtr = rleBitmapPtr;
+
+  for (uint32_t rowIdx = 0u; rowIdx < height; ++rowIdx)
+  {
+    const uint8_t *rowPtr = &bitmapPtr[4u * rowIdx * width];
+    uint32_t columnIdx = 0u;
+    while (columnIdx < width)
+    {
+      const GUI::Image::RLERunType runType = getRunType(rowPtr[4u * columnIdx + 3u]);
+      uint32_t runLength = 1u;
+      while (((columnIdx + runLength) < width) && (runLength < GUI::Image::RLE_MAX_RUN_LENGTH) &&
+             (runType == getRunType(rowPtr[4u * (columnIdx + runLength) + 3u])))
+      {
+        ++runLength;
+      }
+
+      *rlePtr++ = static_cast<uint8_t>((static_cast<uint8_t>(runType) << 6u) | (runLength - 1u));
+      for (uint32_t i = columnIdx; i < (columnIdx + runLength); ++i)
+      {
+        if (GUI::Image::RLERunType::TRANSPARENT != runType)
+        {
+          *rlePtr++ = rowPtr[4u * i];
+          *rlePtr++ = rowPtr[4u * i + 1u];
+          *rlePtr++ = rowPtr[4u * i + 2u];
+        }
+        if (GUI::Image::RLERunType::BLENDED == runType)
+        {
+          *rlePtr++ = rowPtr[4u * i + 3u];
+        }
+      }
+
+      columnIdx += runLength;
+    }
+  }
+
+  return static_cast<uint32_t>(rlePtr - rleBitmapPtr);
+}
+
+static void initSparseARGB8888Bitmap(uint8_t *bitmapPtr, uint16_t width, uint16_t height)
+{
+  for (uint32_t rowIdx = 0u; rowIdx < height; ++rowIdx)
+  {
+    for (uint32_t columnIdx = 0u; columnIdx < width; ++columnIdx)
+    {
+      uint8_t *pixelPtr = &bitmapPtr[4u * (rowIdx * width + columnIdx)];
+      pixelPtr[0] = static_cast<uint8_t>(rowIdx * 7u + columnIdx);
+      pixelPtr[1] = static_cast<uint8_t>(rowIdx * 3u + columnIdx * 5u);
+      pixelPtr[2] = static_cast<uint8_t>(rowIdx + columnIdx * 11u);
+      pixelPtr[3] = (columnIdx < (70u - rowIdx)) ? 0u :
+        (((columnIdx % 8u) < 5u) ? 255u : static_cast<uint8_t>(columnIdx * 37u + rowIdx));
+    }
+  }
+}
+
+TEST_F(AGUIImage, DrawWithCPUCalledOnImageWithRLEBitmapProducesSameResultAsImageWithEquivalentARGB8888Bitmap)
+{
+  constexpr uint16_t BITMAP_WIDTH  = 90u;
+  constexpr uint16_t BITMAP_HEIGHT = 30u;
+  static uint8_t argb8888Bitmap[BITMAP_HEIGHT * BITMAP_WIDTH * 4u];
+  static uint8_t rleBitmap[BITMAP_HEIGHT * (BITMAP_WIDTH * 4u + BITMAP_WIDTH)];
+  initSparseARGB8888Bitmap(argb8888Bitmap, BITMAP_WIDTH, BITMAP_HEIGHT);
+  const uint32_t rleBitmapSize = encodeARGB8888BitmapToRLE(argb8888Bitmap, BITMAP_WIDTH, BITMAP_HEIGHT, rleBitmap);
+  FrameBuffer<50u, 50u, IFrameBuffer::ColorFormat::RGB888> argb8888FrameBuffer;
+  setDefaultFrameBufferColor(guiImageFrameBuffer);
+  setDefaultFrameBufferColor(argb8888FrameBuffer);
+  GUI::Image argb8888GUIImage(dma2dMock, sysTickMock, argb8888FrameBuffer);
+  guiImageDescription.baseDescription.dimension   = { .width = 70u, .height = 25u };
+  guiImageDescription.baseDescription.position    = { .x = -30, .y = 10, .tag = GUI::Position::Tag::TOP_LEFT_CORNER };
+  guiImageDescription.bitmapDescription.dimension = { .width = BITMAP_WIDTH, .height = BITMAP_HEIGHT };
+  guiImageDescription.bitmapDescription.copyPosition = { .x = 10, .y = 3, .tag = GUI::Position::Tag::TOP_LEFT_CORNER };
+  guiImageDescription.bitmapDescription.colorFormat  = GUI::ColorFormat::ARGB8888;
+  guiImageDescription.bitmapDescription.bitmapPtr    = argb8888Bitmap;
+  argb8888GUIImage.init(guiImageDescription);
+  guiImageDescription.bitmapDescription.colorFormat  = GUI::ColorFormat::RLE;
+  guiImageDescription.bitmapDescription.bitmapPtr    = rleBitmap;
+  guiImage.init(guiImageDescription);
+
+  guiImage.draw(GUI::DrawHardware::CPU);
+  argb8888GUIImage.draw(GUI::DrawHardware::CPU);
+
+  ASSERT_THAT(rleBitmapSize, Lt(sizeof(argb8888Bitmap)));
+  ASSERT_THAT(std::memcmp(guiImageFrameBuffer.getPointer(), argb8888FrameBuffer.getPointer(), guiImageFrameBuffer.getSize()), Eq(0));
+}
+
+TEST_F(AGUIImage, DrawWithCPUCalledOnImageWithRLEBitmapDrawsOnlyPixelsWhichLieInsideClipRegionOfRGB565FrameBuffer)
+{
+  constexpr uint16_t BITMAP_WIDTH  = 90u;
+  constexpr uint16_t BITMAP_HEIGHT = 30u;
+  const GUI::Region CLIP_REGION = { .x = 12, .y = 14, .width = 20u, .height = 10u };
+  static uint8_t argb8888Bitmap[BITMAP_HEIGHT * BITMAP_WIDTH * 4u];
+  static uint8_t rleBitmap[BITMAP_HEIGHT * (BITMAP_WIDTH * 4u + BITMAP_WIDTH)];
+  initSparseARGB8888Bitmap(argb8888Bitmap, BITMAP_WIDTH, BITMAP_HEIGHT);
+  encodeARGB8888BitmapToRLE(argb8888Bitmap, BITMAP_WIDTH, BITMAP_HEIGHT, rleBitmap);
+  FrameBuffer<50u, 50u, IFrameBuffer::ColorFormat::RGB565> rleFrameBuffer;
+  FrameBuffer<50u, 50u, IFrameBuffer::ColorFormat::RGB565> argb8888FrameBuffer;
+  std::memset(rleFrameBuffer.getPointer(), 0x5A, rleFrameBuffer.getSize());
+  std::memset(argb8888FrameBuffer.getPointer(), 0x5A, argb8888FrameBuffer.getSize());
+  GUI::Image rleGUIImage(dma2dMock, sysTickMock, rleFrameBuffer);
+  GUI::Image argb8888GUIImage(dma2dMock, sysTickMock, argb8888FrameBuffer);
+  guiImageDescription.baseDescription.dimension   = { .width = BITMAP_WIDTH, .height = BITMAP_HEIGHT };
+  guiImageDescription.baseDescription.position    = { .x = -45, .y = 0, .tag = GUI::Position::Tag::TOP_LEFT_CORNER };
+  guiImageDescription.bitmapDescription.dimension = { .width = BITMAP_WIDTH, .height = BITMAP_HEIGHT };
+  guiImageDescription.bitmapDescription.colorFormat = GUI::ColorFormat::ARGB8888;
+  guiImageDescription.bitmapDescription.bitmapPtr   = argb8888Bitmap;
+  argb8888GUIImage.init(guiImageDescription);
+  argb8888GUIImage.setClipRegion(CLIP_REGION);
+  guiImageDescription.bitmapDescription.colorFormat = GUI::ColorFormat::RLE;
+  guiImageDescription.bitmapDescription.bitmapPtr   = rleBitmap;
+  rleGUIImage.init(guiImageDescription);
+  rleGUIImage.setClipRegion(CLIP_REGION);
+
+  rleGUIImage.draw(GUI::DrawHardware::CPU);
+  argb8888GUIImage.draw(GUI::DrawHardware::CPU);
+
+  ASSERT_THAT(std::memcmp(rleFrameBuffer.getPointer(), argb8888FrameBuffer.getPointer(), rleFrameBuffer.getSize()), Eq(0));
+}
+
+TEST_F(AGUIImage, DrawWithDMA2DCalledOnImageWithRLEBitmapDecodesBitmapWithCPUAndCompletesDrawingImmediately)
+{
+  const uint8_t rleBitmap[] = { 0x40u, 0x10u, 0x20u, 0x30u };
+  guiImageDescription.baseDescription.dimension   = { .width = 1u, .height = 1u };
+  guiImageDescription.baseDescription.position    = { .x = 0, .y = 0, .tag = GUI::Position::Tag::TOP_LEFT_CORNER };
+  guiImageDescription.bitmapDescription.dimension = { .width = 1u, .height = 1u };
+  guiImageDescription.bitmapDescription.colorFormat = GUI::ColorFormat::RLE;
+  guiImageDescription.bitmapDescription.bitmapPtr   = rleBitmap;
+  guiImage.init(guiImageDescription);
+  expectThatNoDMA2DOperationWillBeCalled();
+
+  guiImage.draw(GUI::DrawHardware::DMA2D);
+
+  ASSERT_THAT(guiImage.isDrawCompleted(), Eq(true));
+  ASSERT_THAT(std::memcmp(guiImageFrameBuffer.getPointer(), &rleBitmap[1], 3u), Eq(0));
+}
+
+TEST_F(AGUIImage, DrawWithDMA2DCalledOnImageWithRLEBitmapIsMeasuredAsCPUDrawing)
+{
+  const uint8_t rleBitmap[] = { 0x40u, 0x10u, 0x20u, 0x30u };
+  guiImageDescription.baseDescription.dimension   = { .width = 1u, .height = 1u };
+  guiImageDescription.baseDescription.position    = { .x = 0, .y = 0, .tag = GUI::Position::Tag::TOP_LEFT_CORNER };
+  guiImageDescription.bitmapDescription.dimension = { .width = 1u, .height = 1u };
+  guiImageDescription.bitmapDescription.colorFormat = GUI::ColorFormat::RLE;
+  guiImageDescription.bitmapDescription.bitmapPtr   = rleBitmap;
+  guiImage.init(guiImageDescription);
+  uint64_t drawingTimeInUs;
+
+  guiImage.draw(GUI::DrawHardware::DMA2D);
+
+  ASSERT_THAT(guiImage.getDrawingTime(GUI::DrawHardware::CPU, drawingTimeInUs), Eq(GUI::ErrorCode::OK));
+  ASSERT_THAT(guiImage.getDrawingTime(GUI::DrawHardware::DMA2D, drawingTimeInUs),
+    Eq(GUI::ErrorCode::MEASUREMENT_NOT_AVAILABLE));
+}
+
+TEST_F(AGUIImage, EnqueueDMA2DDrawCommandsCalledOnImageWithRLEBitmapFailsBecauseDMA2DCanNotDecodeIt)
+{
+  const uint8_t rleBitmap[] = { 0x00u };
+  guiImageDescription.bitmapDescription.dimension   = { .width = 1u, .height = 1u };
+  guiImageDescription.bitmapDescription.colorFormat = GUI::ColorFormat::RLE;
+  guiImageDescription.bitmapDescription.bitmapPtr   = rleBitmap;
+  guiImage.init(guiImageDescription);
+  EXPECT_CALL(dma2dMock, enqueueCopyBitmap(_))
+    .Times(0u);
+  EXPECT_CALL(dma2dMock, enqueueBlendBitmap(_))
+    .Times(0u);
+
+  const GUI::ErrorCode errorCode = guiImage.enqueueDMA2DDrawCommands();
+
+  ASSERT_THAT(errorCode, Eq(GUI::ErrorCode::DMA2D_UNSUPPORTED_OPERATION));
+}
+
+TEST_F(AGUIImage, DrawWithDMA2DCalledOnImageWithL4BitmapClippedAtOddColumnDrawsItWithCPUAndCompletesDrawingImmediately)
+{
+  const uint32_t clut[] = { 0xFF000000, 0xFF102030, 0xFFA0B0C0 };
+  const uint8_t l4Bitmap[] = { 0x21, 0x12 };
+  guiImageDescription.baseDescription.dimension   = { .width = 4u, .height = 1u };
+  guiImageDescription.baseDescription.position    = { .x = 5, .y = 5, .tag = GUI::Position::Tag::TOP_LEFT_CORNER };
+  guiImageDescription.bitmapDescription.dimension = { .width = 4u, .height = 1u };
+  guiImageDescription.bitmapDescription.colorFormat = GUI::ColorFormat::L4;
+  guiImageDescription.bitmapDescription.bitmapPtr   = l4Bitmap;
+  guiImageDescription.bitmapDescription.clutPtr     = clut;
+  guiImageDescription.bitmapDescription.clutSize    = 3u;
+  guiImage.init(guiImageDescription);
+  guiImage.setClipRegion({ .x = 6, .y = 5, .width = 2u, .height = 1u });
+  const uint8_t expectedPixels[] =
+  {
+    0xC0, 0xB0, 0xA0,
+    0xC0, 0xB0, 0xA0
+  };
+  const uint8_t *firstVisiblePixelPtr = reinterpret_cast<const uint8_t*>(guiImageFrameBuffer.getPointer()) +
+    3u * (5u * guiImageFrameBuffer.getWidth() + 6u);
+  expectThatNoDMA2DOperationWillBeCalled();
+
+  guiImage.draw(GUI::DrawHardware::DMA2D);
+
+  ASSERT_THAT(guiImage.isDrawCompleted(), Eq(true));
+  ASSERT_THAT(std::memcmp(firstVisiblePixelPtr, expectedPixels, sizeof(expectedPixels)), Eq(0));
+}
+
+TEST_F(AGUIImage, EnqueueDMA2DDrawCommandsCalledOnImageWithL4BitmapClippedAtOddColumnFailsBecauseDMA2DCanNotReadHalfOfByte)
+{
+  const uint32_t clut[] = { 0xFF000000, 0xFF102030 };
+  const uint8_t l4Bitmap[] = { 0x10, 0x01 };
+  guiImageDescription.baseDescription.dimension   = { .width = 4u, .height = 1u };
+  guiImageDescription.baseDescription.position    = { .x = 5, .y = 5, .tag = GUI::Position::Tag::TOP_LEFT_CORNER };
+  guiImageDescription.bitmapDescription.dimension = { .width = 4u, .height = 1u };
+  guiImageDescription.bitmapDescription.colorFormat = GUI::ColorFormat::L4;
+  guiImageDescription.bitmapDescription.bitmapPtr   = l4Bitmap;
+  guiImageDescription.bitmapDescription.clutPtr     = clut;
+  guiImageDescription.bitmapDescription.clutSize    = 2u;
+  guiImage.init(guiImageDescription);
+  guiImage.setClipRegion({ .x = 6, .y = 5, .width = 2u, .height = 1u });
+  EXPECT_CALL(dma2dMock, enqueueCopyBitmap(_))
+    .Times(0u);
+  EXPECT_CALL(dma2dMock, enqueueBlendBitmap(_))
+    .Times(0u);
+
+  const GUI::ErrorCode errorCode = guiImage.enqueueDMA2DDrawCommands();
+
+  ASSERT_THAT(errorCode, Eq(GUI::ErrorCode::DMA2D_UNSUPPORTED_OPERATION));
 }
\ No newline at end of file
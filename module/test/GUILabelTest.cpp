@@ -0,0 +1,238 @@
+#include "GUILabel.h"
+#include "FrameBuffer.h"
+#include "DMA2DMock.h"
+#include "DMA2DEmulator.h"
+#include "SysTickMock.h"
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+
+using namespace ::testing;
+
+
+class AGUILabel : public Test
+{
+public:
+
+  static constexpr uint16_t ATLAS_WIDTH  = 10u;
+  static constexpr uint16_t ATLAS_HEIGHT = 4u;
+
+  NiceMock<DMA2DMock> dma2dMock;
+  NiceMock<SysTickMock> sysTickMock;
+  FrameBuffer<50u, 50u, IFrameBuffer::ColorFormat::RGB888> guiLabelFrameBuffer;
+  GUI::Label guiLabel = GUI::Label(dma2dMock, sysTickMock, guiLabelFrameBuffer);
+  GUI::Label::LabelDescription guiLabelDescription;
+
+  uint8_t a8Atlas[ATLAS_WIDTH * ATLAS_HEIGHT];
+  uint8_t a4Atlas[ATLAS_WIDTH * ATLAS_HEIGHT / 2u];
+
+  const GUI::Label::Glyph a8Glyphs[3] =
+  {
+    { .x = 0u, .width = 3u, .advance = 4u },
+    { .x = 3u, .width = 2u, .advance = 3u },
+    { .x = 5u, .width = 3u, .advance = 4u }
+  };
+
+  const GUI::Label::Glyph a4Glyphs[3] =
+  {
+    { .x = 0u, .width = 2u, .advance = 3u },
+    { .x = 2u, .width = 2u, .advance = 3u },
+    { .x = 4u, .width = 4u, .advance = 5u }
+  };
+
+  GUI::Label::FontDescription a8Font;
+  GUI::Label::FontDescription a4Font;
+
+  uint32_t getFrameBufferPixel(const IFrameBuffer &frameBuffer, uint16_t x, uint16_t y) const;
+
+  void SetUp() override;
+};
+
+uint32_t AGUILabel::getFrameBufferPixel(const IFrameBuffer &frameBuffer, uint16_t x, uint16_t y) const
+{
+  const uint8_t *pixelPtr = reinterpret_cast<const uint8_t*>(frameBuffer.getPointer()) + 3u * (x + y * frameBuffer.getWidth());
+  return (pixelPtr[2] << 16u) | (pixelPtr[1] << 8u) | pixelPtr[0];
+}
+
+void AGUILabel::SetUp()
+{
+  memset(a8Atlas, 0xFF, sizeof(a8Atlas));
+  memset(a4Atlas, 0xFF, sizeof(a4Atlas));
+  memset(guiLabelFrameBuffer.getPointer(), 0x10, guiLabelFrameBuffer.getSize());
+
+  a8Font =
+  {
+    .glyphFormat    = GUI::Label::GlyphFormat::A8,
+    .atlasDimension = { .width = ATLAS_WIDTH, .height = ATLAS_HEIGHT },
+    .atlasPtr       = a8Atlas,
+    .glyphPtr       = a8Glyphs,
+    .firstCharacter = '0',
+    .glyphCount     = 3u
+  };
+
+  a4Font = a8Font;
+  a4Font.glyphFormat = GUI::Label::GlyphFormat::A4;
+  a4Font.atlasPtr    = a4Atlas;
+  a4Font.glyphPtr    = a4Glyphs;
+
+  guiLabelDescription =
+  {
+    .baseDescription =
+    {
+      .dimension = { .width = 30u, .height = 8u },
+      .position  = { .x = 10, .y = 10, .tag = GUI::Position::Tag::TOP_LEFT_CORNER }
+    },
+    .fontPtr = &a8Font,
+    .text    = "012",
+    .color   = { .red = 0xA0u, .green = 0xB0u, .blue = 0xC0u }
+  };
+}
+
+
+TEST_F(AGUILabel, InitFailsIfFontIsNotGiven)
+{
+  guiLabelDescription.fontPtr = nullptr;
+
+  ASSERT_THAT(guiLabel.init(guiLabelDescription), Eq(GUI::ErrorCode::ARGUMENT_NULL_POINTER));
+}
+
+TEST_F(AGUILabel, GetTextWidthReturnsSumOfGlyphAdvancesSkippingCharactersWithoutGlyph)
+{
+  guiLabelDescription.text = "0 12x";
+  guiLabel.init(guiLabelDescription);
+
+  ASSERT_THAT(guiLabel.getTextWidth(), Eq(4u + 3u + 4u));
+}
+
+TEST_F(AGUILabel, SetTextTruncatesTextLongerThanMaximumTextLength)
+{
+  char longText[GUI::Label::MAX_TEXT_LENGTH + 5u];
+  memset(longText, '1', sizeof(longText) - 1u);
+  longText[sizeof(longText) - 1u] = '\0';
+  guiLabel.init(guiLabelDescription);
+
+  guiLabel.setText(longText);
+
+  ASSERT_THAT(strlen(guiLabel.getText()), Eq(GUI::Label::MAX_TEXT_LENGTH));
+}
+
+TEST_F(AGUILabel, SetTextReportsDamagedRegionOnlyIfTextIsChanged)
+{
+  uint32_t damagedRegionReportCount = 0u;
+  guiLabel.init(guiLabelDescription);
+  guiLabel.registerDamagedRegionCallback(
+  {
+    .functionPtr = [](void *argument, const GUI::Region&)
+    {
+      ++(*reinterpret_cast<uint32_t*>(argument));
+    },
+    .argument = &damagedRegionReportCount
+  });
+
+  guiLabel.setText("012");
+  guiLabel.setText("01");
+
+  ASSERT_THAT(damagedRegionReportCount, Eq(1u));
+}
+
+TEST_F(AGUILabel, DrawCPUBlendsTextColorOverBackgroundWithAlphaOfGlyphPixels)
+{
+  a8Atlas[0] = 0x40u;
+  guiLabel.init(guiLabelDescription);
+
+  guiLabel.draw(GUI::DrawHardware::CPU);
+
+  const uint32_t expectedRed   = (0x40u * 0xA0u + (255u - 0x40u) * 0x10u) / 255u;
+  const uint32_t expectedGreen = (0x40u * 0xB0u + (255u - 0x40u) * 0x10u) / 255u;
+  const uint32_t expectedBlue  = (0x40u * 0xC0u + (255u - 0x40u) * 0x10u) / 255u;
+  ASSERT_THAT(getFrameBufferPixel(guiLabelFrameBuffer, 10u, 10u),
+    Eq((expectedRed << 16u) | (expectedGreen << 8u) | expectedBlue));
+  ASSERT_THAT(getFrameBufferPixel(guiLabelFrameBuffer, 12u, 13u), Eq(0xA0B0C0u));
+  ASSERT_THAT(getFrameBufferPixel(guiLabelFrameBuffer, 13u, 10u), Eq(0x101010u));
+  ASSERT_THAT(getFrameBufferPixel(guiLabelFrameBuffer, 10u, 14u), Eq(0x101010u));
+}
+
+TEST_F(AGUILabel, DrawCPUClipsTextToLabelDimension)
+{
+  guiLabelDescription.baseDescription.dimension = { .width = 5u, .height = 2u };
+  guiLabel.init(guiLabelDescription);
+
+  guiLabel.draw(GUI::DrawHardware::CPU);
+
+  ASSERT_THAT(getFrameBufferPixel(guiLabelFrameBuffer, 14u, 11u), Eq(0xA0B0C0u));
+  ASSERT_THAT(getFrameBufferPixel(guiLabelFrameBuffer, 15u, 11u), Eq(0x101010u));
+  ASSERT_THAT(getFrameBufferPixel(guiLabelFrameBuffer, 10u, 12u), Eq(0x101010u));
+}
+
+TEST_F(AGUILabel, EnqueueDMA2DDrawCommandsEnqueuesOneBlendWithAlphaOnlyForegroundPerVisibleGlyph)
+{
+  std::vector<DMA2D::BlendBitmapConfig> blendBitmapConfigs;
+  guiLabel.init(guiLabelDescription);
+  EXPECT_CALL(dma2dMock, enqueueBlendBitmap(_))
+    .Times(3u)
+    .WillRepeatedly([&](const DMA2D::BlendBitmapConfig &blendBitmapConfig)
+    {
+      blendBitmapConfigs.push_back(blendBitmapConfig);
+      return DMA2D::ErrorCode::OK;
+    });
+
+  ASSERT_THAT(guiLabel.enqueueDMA2DDrawCommands(), Eq(GUI::ErrorCode::OK));
+  ASSERT_THAT(blendBitmapConfigs[1].foregroundBufferConfig.colorFormat, Eq(DMA2D::InputColorFormat::A8));
+  ASSERT_THAT(blendBitmapConfigs[1].foregroundBufferConfig.color.red, Eq(0xA0u));
+  ASSERT_THAT(blendBitmapConfigs[1].foregroundRectanglePosition.x, Eq(3u));
+  ASSERT_THAT(blendBitmapConfigs[1].destinationRectanglePosition.x, Eq(14u));
+  ASSERT_THAT(blendBitmapConfigs[1].dimension.width, Eq(2u));
+  ASSERT_THAT(blendBitmapConfigs[1].dimension.height, Eq(ATLAS_HEIGHT));
+}
+
+TEST_F(AGUILabel, EnqueueDMA2DDrawCommandsEnqueuesNothingIfCommandQueueCanNotHoldAllGlyphs)
+{
+  guiLabel.init(guiLabelDescription);
+  ON_CALL(dma2dMock, getNumberOfEnqueuedCommands())
+    .WillByDefault(Return(DMA2D::COMMAND_QUEUE_CAPACITY - 2u));
+  EXPECT_CALL(dma2dMock, enqueueBlendBitmap(_))
+    .Times(0u);
+
+  ASSERT_THAT(guiLabel.enqueueDMA2DDrawCommands(), Eq(GUI::ErrorCode::DMA2D_COMMAND_QUEUE_FULL));
+}
+
+TEST_F(AGUILabel, DrawDMA2DFallsBackToCPUIfA4GlyphIsClippedToOddColumn)
+{
+  guiLabelDescription.fontPtr = &a4Font;
+  guiLabelDescription.baseDescription.position.x = -1;
+  guiLabel.init(guiLabelDescription);
+  EXPECT_CALL(dma2dMock, executeCommandQueue(_))
+    .Times(0u);
+
+  guiLabel.draw(GUI::DrawHardware::DMA2D);
+
+  ASSERT_THAT(guiLabel.isDrawCompleted(), Eq(true));
+  ASSERT_THAT(getFrameBufferPixel(guiLabelFrameBuffer, 0u, 10u), Eq(0xA0B0C0u));
+}
+
+TEST_F(AGUILabel, DrawDMA2DDrawsPixelForPixelTheSameTextAsDrawCPU)
+{
+  DMA2DEmulator dma2dEmulator;
+  FrameBuffer<50u, 50u, IFrameBuffer::ColorFormat::RGB565> cpuFrameBuffer;
+  FrameBuffer<50u, 50u, IFrameBuffer::ColorFormat::RGB565> dma2dFrameBuffer;
+  GUI::Label cpuLabel(dma2dEmulator, sysTickMock, cpuFrameBuffer);
+  GUI::Label dma2dLabel(dma2dEmulator, sysTickMock, dma2dFrameBuffer);
+  for (uint32_t i = 0u; i < sizeof(a8Atlas); ++i)
+  {
+    a8Atlas[i] = static_cast<uint8_t>(i * 29u);
+  }
+  memset(cpuFrameBuffer.getPointer(), 0x5A, cpuFrameBuffer.getSize());
+  memset(dma2dFrameBuffer.getPointer(), 0x5A, dma2dFrameBuffer.getSize());
+  cpuLabel.init(guiLabelDescription);
+  dma2dLabel.init(guiLabelDescription);
+
+  cpuLabel.draw(GUI::DrawHardware::CPU);
+  dma2dLabel.draw(GUI::DrawHardware::DMA2D);
+
+  ASSERT_THAT(dma2dEmulator.completeAllTransfers(), Eq(3u));
+  ASSERT_THAT(dma2dLabel.isDrawCompleted(), Eq(true));
+  ASSERT_THAT(memcmp(cpuFrameBuffer.getPointer(), dma2dFrameBuffer.getPointer(), cpuFrameBuffer.getSize()), Eq(0));
+}
\ No newline at end of file
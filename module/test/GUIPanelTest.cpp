@@ -0,0 +1,224 @@
+#include "GUIPanel.h"
+#include "GUIRectangle.h"
+#include "ArrayList.h"
+#include "FrameBuffer.h"
+#include "GUIObjectMock.h"
+#include "DMA2DMock.h"
+#include "SysTickMock.h"
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+
+using namespace ::testing;
+
+
+class AGUIPanel : public Test
+{
+public:
+
+  NiceMock<DMA2DMock> dma2dMock;
+  NiceMock<SysTickMock> sysTickMock;
+  NiceMock<GUIObjectMock> guiObjectMock1;
+  NiceMock<GUIObjectMock> guiObjectMock2;
+  FrameBuffer<50u, 50u, IFrameBuffer::ColorFormat::RGB888> frameBuffer;
+  ArrayList<GUI::Panel::ObjectInfo, 5u> objectInfoList;
+  GUI::Panel guiPanel = GUI::Panel(objectInfoList, sysTickMock, frameBuffer);
+  GUI::Rectangle guiRectangle = GUI::Rectangle(dma2dMock, sysTickMock, frameBuffer);
+
+  std::vector<GUI::Region> damagedRegions;
+
+  const GUI::Color rectangleColor = { .red = 55u, .green = 210u, .blue = 145u };
+
+  void initRectangle(int16_t x, int16_t y, uint16_t width, uint16_t height);
+  void recordDamagedRegionsOfPanel(void);
+  bool isPixelOfRectangleColor(int16_t x, int16_t y) const;
+
+  void SetUp() override;
+};
+
+void AGUIPanel::SetUp()
+{
+  guiPanel.init(
+  {
+    .dimension = { .width = 20u, .height = 20u },
+    .position  = { .x = 10, .y = 10, .tag = GUI::Position::Tag::TOP_LEFT_CORNER }
+  });
+
+  memset(frameBuffer.getPointer(), 0, frameBuffer.getSize());
+}
+
+void AGUIPanel::initRectangle(int16_t x, int16_t y, uint16_t width, uint16_t height)
+{
+  guiRectangle.init(
+  {
+    .baseDescription =
+    {
+      .dimension = { .width = width, .height = height },
+      .position  = { .x = x, .y = y, .tag = GUI::Position::Tag::TOP_LEFT_CORNER }
+    },
+    .color = rectangleColor
+  });
+}
+
+void AGUIPanel::recordDamagedRegionsOfPanel(void)
+{
+  guiPanel.registerDamagedRegionCallback(
+  {
+    .functionPtr = [](void *argument, const GUI::Region &region)
+    {
+      reinterpret_cast<std::vector<GUI::Region>*>(argument)->push_back(region);
+    },
+    .argument = &damagedRegions
+  });
+}
+
+bool AGUIPanel::isPixelOfRectangleColor(int16_t x, int16_t y) const
+{
+  const uint8_t *pixelPtr = reinterpret_cast<const uint8_t*>(frameBuffer.getPointer()) +
+    (static_cast<uint32_t>(y) * frameBuffer.getWidth() + x) * 3u;
+
+  return (rectangleColor.blue == pixelPtr[0]) && (rectangleColor.green == pixelPtr[1]) &&
+         (rectangleColor.red == pixelPtr[2]);
+}
+
+
+TEST_F(AGUIPanel, AddObjectPlacesObjectRelativeToTopLeftCornerOfPanel)
+{
+  initRectangle(5, 3, 4u, 4u);
+
+  guiPanel.addObject(&guiRectangle, 0u);
+
+  ASSERT_THAT(guiRectangle.getPosition(GUI::Position::Tag::TOP_LEFT_CORNER).x, Eq(15));
+  ASSERT_THAT(guiRectangle.getPosition(GUI::Position::Tag::TOP_LEFT_CORNER).y, Eq(13));
+}
+
+TEST_F(AGUIPanel, AddObjectFailsIfZIndexIsAlreadyInUsage)
+{
+  guiPanel.addObject(&guiObjectMock1, 1u);
+
+  ASSERT_THAT(guiPanel.addObject(&guiObjectMock2, 1u), Eq(GUI::ErrorCode::Z_INDEX_ALREADY_IN_USAGE));
+}
+
+TEST_F(AGUIPanel, MoveToPositionMovesAllObjectsByTheSameOffsetAndReportsOnlyOldAndNewPanelRegion)
+{
+  initRectangle(5, 5, 4u, 4u);
+  guiPanel.addObject(&guiRectangle, 0u);
+  recordDamagedRegionsOfPanel();
+
+  guiPanel.moveToPosition({ .x = 20, .y = 25, .tag = GUI::Position::Tag::TOP_LEFT_CORNER });
+
+  ASSERT_THAT(guiRectangle.getPosition(GUI::Position::Tag::TOP_LEFT_CORNER).x, Eq(25));
+  ASSERT_THAT(guiRectangle.getPosition(GUI::Position::Tag::TOP_LEFT_CORNER).y, Eq(30));
+  ASSERT_THAT(damagedRegions.size(), Eq(2u));
+  ASSERT_THAT(damagedRegions[0], Eq(GUI::Region{ .x = 10, .y = 10, .width = 20u, .height = 20u }));
+  ASSERT_THAT(damagedRegions[1], Eq(GUI::Region{ .x = 20, .y = 25, .width = 20u, .height = 20u }));
+}
+
+TEST_F(AGUIPanel, DamagedRegionOfObjectIsReportedClippedToPanelRegion)
+{
+  guiPanel.addObject(&guiObjectMock1, 0u);
+  recordDamagedRegionsOfPanel();
+
+  guiObjectMock1.reportDamagedRegion({ .x = 0, .y = 0, .width = 15u, .height = 15u });
+
+  ASSERT_THAT(damagedRegions.size(), Eq(1u));
+  ASSERT_THAT(damagedRegions[0], Eq(GUI::Region{ .x = 10, .y = 10, .width = 5u, .height = 5u }));
+}
+
+TEST_F(AGUIPanel, DrawCPUDrawsObjectsClippedToPanelRegion)
+{
+  initRectangle(5, 5, 30u, 30u);
+  guiPanel.addObject(&guiRectangle, 0u);
+
+  guiPanel.draw(GUI::DrawHardware::CPU);
+
+  ASSERT_THAT(isPixelOfRectangleColor(15, 15), Eq(true));
+  ASSERT_THAT(isPixelOfRectangleColor(29, 29), Eq(true));
+  ASSERT_THAT(isPixelOfRectangleColor(30, 30), Eq(false));
+  ASSERT_THAT(isPixelOfRectangleColor(40, 40), Eq(false));
+}
+
+TEST_F(AGUIPanel, DrawSkipsAllObjectsIfPanelIsNotVisibleOnTheScreen)
+{
+  guiPanel.addObject(&guiObjectMock1, 0u);
+  guiPanel.moveToPosition({ .x = 100, .y = 100, .tag = GUI::Position::Tag::TOP_LEFT_CORNER });
+
+  EXPECT_CALL(guiObjectMock1, draw(_))
+    .Times(0u);
+  EXPECT_CALL(guiObjectMock1, enqueueDMA2DDrawCommands())
+    .Times(0u);
+
+  guiPanel.draw(GUI::DrawHardware::CPU);
+  guiPanel.enqueueDMA2DDrawCommands();
+}
+
+TEST_F(AGUIPanel, DrawDMA2DDrawsNextObjectWhenPreviousObjectIsDrawn)
+{
+  guiPanel.addObject(&guiObjectMock1, 0u);
+  guiPanel.addObject(&guiObjectMock2, 1u);
+
+  EXPECT_CALL(guiObjectMock2, draw(GUI::DrawHardware::DMA2D))
+    .Times(0u);
+  guiPanel.draw(GUI::DrawHardware::DMA2D);
+  Mock::VerifyAndClearExpectations(&guiObjectMock2);
+
+  EXPECT_CALL(guiObjectMock2, draw(GUI::DrawHardware::DMA2D))
+    .Times(1u);
+  guiObjectMock1.callbackDMA2DDrawCompleted();
+  guiObjectMock2.callbackDMA2DDrawCompleted();
+
+  ASSERT_THAT(guiPanel.isDrawCompleted(), Eq(true));
+}
+
+TEST_F(AGUIPanel, EnqueueContinuesFromObjectWhichDidNotFitIntoFullDMA2DCommandQueue)
+{
+  guiPanel.addObject(&guiObjectMock1, 0u);
+  guiPanel.addObject(&guiObjectMock2, 1u);
+
+  EXPECT_CALL(guiObjectMock1, enqueueDMA2DDrawCommands())
+    .WillOnce(Return(GUI::ErrorCode::OK));
+  EXPECT_CALL(guiObjectMock2, enqueueDMA2DDrawCommands())
+    .WillOnce(Return(GUI::ErrorCode::DMA2D_COMMAND_QUEUE_FULL))
+    .WillOnce(Return(GUI::ErrorCode::OK));
+
+  ASSERT_THAT(guiPanel.enqueueDMA2DDrawCommands(), Eq(GUI::ErrorCode::DMA2D_COMMAND_QUEUE_FULL));
+  ASSERT_THAT(guiPanel.enqueueDMA2DDrawCommands(), Eq(GUI::ErrorCode::OK));
+}
+
+TEST_F(AGUIPanel, EnqueueReportsFullQueueIfUnsupportedObjectFollowsAlreadyEnqueuedObjects)
+{
+  guiPanel.addObject(&guiObjectMock1, 0u);
+  guiPanel.addObject(&guiObjectMock2, 1u);
+
+  ON_CALL(guiObjectMock1, enqueueDMA2DDrawCommands())
+    .WillByDefault(Return(GUI::ErrorCode::OK));
+  ON_CALL(guiObjectMock2, enqueueDMA2DDrawCommands())
+    .WillByDefault(Return(GUI::ErrorCode::DMA2D_UNSUPPORTED_OPERATION));
+
+  ASSERT_THAT(guiPanel.enqueueDMA2DDrawCommands(), Eq(GUI::ErrorCode::DMA2D_COMMAND_QUEUE_FULL));
+  ASSERT_THAT(guiPanel.enqueueDMA2DDrawCommands(), Eq(GUI::ErrorCode::DMA2D_UNSUPPORTED_OPERATION));
+}
+
+TEST_F(AGUIPanel, NotifyForwardsTouchEventToTopMostObjectContainingTouchPoint)
+{
+  ArrayList<GUI::Point, 2u> touchPoints;
+  touchPoints.addElement({ .x = 12, .y = 12 });
+  const GUI::TouchEvent touchEvent(0u, GUI::TouchEvent::Type::TOUCH_START, touchPoints);
+  guiPanel.addObject(&guiObjectMock1, 0u);
+  guiPanel.addObject(&guiObjectMock2, 1u);
+
+  ON_CALL(guiObjectMock1, doesContainPoint(_))
+    .WillByDefault(Return(true));
+  ON_CALL(guiObjectMock2, doesContainPoint(_))
+    .WillByDefault(Return(true));
+
+  EXPECT_CALL(guiObjectMock1, notify(_))
+    .Times(0u);
+  EXPECT_CALL(guiObjectMock2, notify(_))
+    .Times(1u);
+
+  guiPanel.notify(touchEvent);
+}
\ No newline at end of file
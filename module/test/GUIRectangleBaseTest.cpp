@@ -5,6 +5,7 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include <cstdint>
+#include <vector>
 
 
 using namespace ::testing;
@@ -58,6 +59,9 @@ void AGUIRectangleBase::SetUp()
   m_isCallbackCalled           = false;
   m_sysTickFunctionCallCounter = 0u;
 
+  // cost model is shared by all objects of the same type
+  guiRectangleBase.getDrawCostModel().reset();
+
   guiRectangleBaseDescription.dimension =
   {
     .width  = 10u,
@@ -822,6 +826,63 @@ TEST_F(AGUIRectangleBase, DrawWithDMA2DDrawHardwarDoesNotCallDrawDMA2DMethodIfRe
   guiRectangleBase.draw(GUI::DrawHardware::DMA2D);
 }
 
+TEST_F(AGUIRectangleBase, DrawWithAutoDrawHardwareCallsDrawCPUMethodWhileCostModelIsNotCalibrated)
+{
+  guiRectangleBase.init(guiRectangleBaseDescription);
+  EXPECT_CALL(guiRectangleBase, drawCPU())
+    .Times(1u);
+  EXPECT_CALL(guiRectangleBase, drawDMA2D())
+    .Times(0u);
+
+  guiRectangleBase.draw(GUI::DrawHardware::AUTO);
+}
+
+TEST_F(AGUIRectangleBase, DrawWithAutoDrawHardwareCallsDrawDMA2DMethodIfDMA2DIsEstimatedToBeCheaper)
+{
+  guiRectangleBase.init(guiRectangleBaseDescription);
+  guiRectangleBase.getDrawCostModel().update(GUI::DrawHardware::CPU, 100u, 500u);
+  guiRectangleBase.getDrawCostModel().update(GUI::DrawHardware::DMA2D, 100u, 50u);
+  EXPECT_CALL(guiRectangleBase, drawDMA2D())
+    .Times(1u);
+  EXPECT_CALL(guiRectangleBase, drawCPU())
+    .Times(0u);
+
+  guiRectangleBase.draw(GUI::DrawHardware::AUTO);
+}
+
+TEST_F(AGUIRectangleBase, DrawUpdatesCostModelWithMeasuredDrawingTime)
+{
+  setupSysTickReadings(DRAW_OPERATION_DURATION_IN_US);
+  guiRectangleBase.init(guiRectangleBaseDescription);
+
+  guiRectangleBase.draw(GUI::DrawHardware::CPU);
+
+  ASSERT_THAT(guiRectangleBase.getDrawCostModel().isCalibrated(GUI::DrawHardware::CPU), Eq(true));
+  ASSERT_THAT(guiRectangleBase.getDrawCostModel().estimateDrawingTimeInUs(GUI::DrawHardware::CPU, 100u),
+    FloatEq(static_cast<float>(DRAW_OPERATION_DURATION_IN_US)));
+}
+
+TEST_F(AGUIRectangleBase, EnqueueDMA2DDrawCommandsCallsEnqueueDMA2DCommandsMethod)
+{
+  guiRectangleBase.init(guiRectangleBaseDescription);
+  EXPECT_CALL(guiRectangleBase, enqueueDMA2DCommands())
+    .Times(1u);
+
+  guiRectangleBase.enqueueDMA2DDrawCommands();
+}
+
+TEST_F(AGUIRectangleBase, EnqueueDMA2DDrawCommandsDoesNotCallEnqueueDMA2DCommandsMethodIfRectangleIsCompletelyOutOfTheScreen)
+{
+  guiRectangleBaseDescription.position = GUI_RECTANGLE_COMPLETELY_OUT_OF_SCREEN_POSITION;
+  guiRectangleBase.init(guiRectangleBaseDescription);
+  EXPECT_CALL(guiRectangleBase, enqueueDMA2DCommands())
+    .Times(0u);
+
+  const GUI::ErrorCode errorCode = guiRectangleBase.enqueueDMA2DDrawCommands();
+
+  ASSERT_THAT(errorCode, Eq(GUI::ErrorCode::OK));
+}
+
 TEST_F(AGUIRectangleBase, DrawWithCPUDrawHardwareCallsSysTickGetTicksBeforeDrawCPUMethodIsCalled)
 {
   guiRectangleBase.init(guiRectangleBaseDescription);
@@ -1126,4 +1187,140 @@ TEST_F(AGUIRectangleBase, TouchEventNotifyDoesNotCallPreviouslyRegisteredTouchEv
   guiRectangleBase.notify(RANDOM_TOUCH_EVENT);
 
   assertThatCallbackIsNotCalled();
-}
\ No newline at end of file
+}
+TEST_F(AGUIRectangleBase, GetRegionReturnsTopLeftCornerAndDimensionOfGUIRectangleBase)
+{
+  const GUI::Region EXPECTED_REGION = { .x = -5, .y = 7, .width = 10u, .height = 10u };
+  guiRectangleBaseDescription.position = { .x = -5, .y = 7, .tag = GUI::Position::Tag::TOP_LEFT_CORNER };
+  guiRectangleBase.init(guiRectangleBaseDescription);
+
+  ASSERT_THAT(guiRectangleBase.getRegion(), Eq(EXPECTED_REGION));
+}
+
+TEST_F(AGUIRectangleBase, GetClipRegionReturnsWholeFrameBufferIfClipRegionIsNotSet)
+{
+  const GUI::Region EXPECTED_CLIP_REGION = { .x = 0, .y = 0, .width = 50u, .height = 50u };
+
+  ASSERT_THAT(guiRectangleBase.getClipRegion(), Eq(EXPECTED_CLIP_REGION));
+}
+
+TEST_F(AGUIRectangleBase, GetClipRegionReturnsPartOfClipRegionWhichLiesInsideFrameBuffer)
+{
+  const GUI::Region CLIP_REGION          = { .x = 40, .y = -10, .width = 30u, .height = 20u };
+  const GUI::Region EXPECTED_CLIP_REGION = { .x = 40, .y = 0,   .width = 10u, .height = 10u };
+
+  guiRectangleBase.setClipRegion(CLIP_REGION);
+
+  ASSERT_THAT(guiRectangleBase.getClipRegion(), Eq(EXPECTED_CLIP_REGION));
+}
+
+TEST_F(AGUIRectangleBase, GetVisiblePartDimensionReturnsOnlyPartOfGUIRectangleBaseWhichLiesInsideClipRegion)
+{
+  const GUI::Region CLIP_REGION = { .x = 5, .y = 8, .width = 20u, .height = 20u };
+  const GUI::Dimension EXPECTED_VISIBLE_PART_DIMENSION = { .width = 5u, .height = 2u };
+  guiRectangleBase.init(guiRectangleBaseDescription);
+
+  guiRectangleBase.setClipRegion(CLIP_REGION);
+
+  ASSERT_THAT(guiRectangleBase.getVisiblePartDimension(), Eq(EXPECTED_VISIBLE_PART_DIMENSION));
+}
+
+TEST_F(AGUIRectangleBase, GetVisiblePartPositionWithAnyTagReturnsPositionSaturatedIntoClipRegion)
+{
+  const GUI::Region CLIP_REGION = { .x = 5, .y = 8, .width = 20u, .height = 20u };
+  const GUI::Position EXPECTED_TOP_LEFT_CORNER_POSITION =
+  {
+    .x   = 5,
+    .y   = 8,
+    .tag = GUI::Position::Tag::TOP_LEFT_CORNER
+  };
+  guiRectangleBase.init(guiRectangleBaseDescription);
+
+  guiRectangleBase.setClipRegion(CLIP_REGION);
+
+  ASSERT_THAT(guiRectangleBase.getVisiblePartPosition(GUI::Position::Tag::TOP_LEFT_CORNER),
+    Eq(EXPECTED_TOP_LEFT_CORNER_POSITION));
+}
+
+TEST_F(AGUIRectangleBase, GetVisiblePartRegionReturnsIntersectionOfGUIRectangleBaseRegionAndClipRegion)
+{
+  const GUI::Region CLIP_REGION = { .x = 3, .y = -4, .width = 20u, .height = 10u };
+  const GUI::Region EXPECTED_VISIBLE_PART_REGION = { .x = 3, .y = 0, .width = 7u, .height = 6u };
+  guiRectangleBase.init(guiRectangleBaseDescription);
+
+  guiRectangleBase.setClipRegion(CLIP_REGION);
+
+  ASSERT_THAT(guiRectangleBase.getVisiblePartRegion(), Eq(EXPECTED_VISIBLE_PART_REGION));
+}
+
+TEST_F(AGUIRectangleBase, ResetClipRegionMakesWholeGUIRectangleBaseVisibleAgain)
+{
+  const GUI::Region CLIP_REGION = { .x = 5, .y = 8, .width = 20u, .height = 20u };
+  guiRectangleBase.init(guiRectangleBaseDescription);
+  guiRectangleBase.setClipRegion(CLIP_REGION);
+
+  guiRectangleBase.resetClipRegion();
+
+  ASSERT_THAT(guiRectangleBase.getVisiblePartDimension(), Eq(guiRectangleBaseDescription.dimension));
+}
+
+TEST_F(AGUIRectangleBase, DrawWithCPUDoesNotCallDrawCPUMethodIfRectangleIsCompletelyOutOfTheClipRegion)
+{
+  const GUI::Region CLIP_REGION = { .x = 20, .y = 20, .width = 20u, .height = 20u };
+  guiRectangleBase.init(guiRectangleBaseDescription);
+  guiRectangleBase.setClipRegion(CLIP_REGION);
+
+  EXPECT_CALL(guiRectangleBase, drawCPU())
+    .Times(0u);
+
+  guiRectangleBase.draw(GUI::DrawHardware::CPU);
+}
+
+TEST_F(AGUIRectangleBase, MoveToPositionReportsBothOldAndNewRegionAsDamagedToRegisteredCallback)
+{
+  std::vector<GUI::Region> damagedRegions;
+  const GUI::Region EXPECTED_OLD_REGION = { .x = 0,  .y = 0,  .width = 10u, .height = 10u };
+  const GUI::Region EXPECTED_NEW_REGION = { .x = 20, .y = 30, .width = 10u, .height = 10u };
+  guiRectangleBase.init(guiRectangleBaseDescription);
+  guiRectangleBase.registerDamagedRegionCallback(
+  {
+    .functionPtr = [](void *argument, const GUI::Region &region)
+    {
+      reinterpret_cast<std::vector<GUI::Region>*>(argument)->push_back(region);
+    },
+    .argument = &damagedRegions
+  });
+
+  guiRectangleBase.moveToPosition({ .x = 20, .y = 30, .tag = GUI::Position::Tag::TOP_LEFT_CORNER });
+
+  ASSERT_THAT(damagedRegions, ElementsAre(EXPECTED_OLD_REGION, EXPECTED_NEW_REGION));
+}
+
+TEST_F(AGUIRectangleBase, MoveToPositionDoesNotReportAnyDamageIfPositionIsNotChanged)
+{
+  guiRectangleBase.init(guiRectangleBaseDescription);
+  guiRectangleBase.registerDamagedRegionCallback(
+  {
+    .functionPtr = [](void *argument, const GUI::Region&) { *reinterpret_cast<bool*>(argument) = true; },
+    .argument = &m_isCallbackCalled
+  });
+
+  guiRectangleBase.moveToPosition(guiRectangleBaseDescription.position);
+
+  assertThatCallbackIsNotCalled();
+}
+
+TEST_F(AGUIRectangleBase, MoveToPositionDoesNotCallPreviouslyRegisteredDamagedRegionCallbackIfLaterItIsUnregistered)
+{
+  guiRectangleBase.init(guiRectangleBaseDescription);
+  guiRectangleBase.registerDamagedRegionCallback(
+  {
+    .functionPtr = [](void *argument, const GUI::Region&) { *reinterpret_cast<bool*>(argument) = true; },
+    .argument = &m_isCallbackCalled
+  });
+  guiRectangleBase.unregisterDamagedRegionCallback();
+
+  guiRectangleBase.moveToPosition(GUI_RECTANGLE_PARTIALLY_OUT_OF_SCREEN_POSITION);
+
+  assertThatCallbackIsNotCalled();
+}
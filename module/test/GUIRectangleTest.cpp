@@ -5,6 +5,7 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include <cstdint>
+#include <cstring>
 
 
 using namespace ::testing;
@@ -318,6 +319,45 @@ TEST_F(AGUIRectangle, DrawWithCPUDrawsRectangleCorrectlyOntoAssociatedFrameBuffe
   assertThatGUIRectangleIsDrawnCorrectlyOntoFrameBuffer(guiRectangle);
 }
 
+TEST_F(AGUIRectangle, DrawWithCPUDrawsRectangleWithRGB565PixelsOntoAssociatedRGB565FrameBuffer)
+{
+  FrameBuffer<50u, 50u, IFrameBuffer::ColorFormat::RGB565> rgb565FrameBuffer;
+  GUI::Rectangle guiRectangle = GUI::Rectangle(dma2dMock, sysTickMock, rgb565FrameBuffer);
+  const uint16_t *frameBufferPtr = reinterpret_cast<const uint16_t*>(rgb565FrameBuffer.getPointer());
+  memset(rgb565FrameBuffer.getPointer(), 0u, rgb565FrameBuffer.getSize());
+  guiRectangle.init(guiRectangleDescription);
+
+  guiRectangle.draw(GUI::DrawHardware::CPU);
+
+  for (int16_t y = 0; y < 50; ++y)
+  {
+    for (int16_t x = 0; x < 50; ++x)
+    {
+      const bool isInsideRectangle = guiRectangle.doesContainPoint(GUI::Point{ .x = x, .y = y });
+      const uint16_t expectedPixel = isInsideRectangle ? guiRectangleDescription.color.toRGB565() : 0u;
+      ASSERT_THAT(frameBufferPtr[y * 50 + x], Eq(expectedPixel));
+    }
+  }
+}
+
+TEST_F(AGUIRectangle, DrawWithDMA2DOntoRGB565FrameBufferFillsRectangleWithColorComponentsReducedToRGB565BitSizes)
+{
+  FrameBuffer<50u, 50u, IFrameBuffer::ColorFormat::RGB565> rgb565FrameBuffer;
+  GUI::Rectangle guiRectangle = GUI::Rectangle(dma2dMock, sysTickMock, rgb565FrameBuffer);
+  guiRectangle.init(guiRectangleDescription);
+
+  EXPECT_CALL(dma2dMock, fillRectangle(AllOf(
+    Field(&DMA2D::FillRectangleConfig::color, AllOf(
+      Field(&DMA2D::Color::red, Eq(guiRectangleDescription.color.red >> 3u)),
+      Field(&DMA2D::Color::green, Eq(guiRectangleDescription.color.green >> 2u)),
+      Field(&DMA2D::Color::blue, Eq(guiRectangleDescription.color.blue >> 3u)))),
+    Field(&DMA2D::FillRectangleConfig::destinationBufferConfig,
+      Field(&DMA2D::OutputBufferConfiguration::colorFormat, Eq(DMA2D::OutputColorFormat::RGB565))))))
+    .Times(1u);
+
+  guiRectangle.draw(GUI::DrawHardware::DMA2D);
+}
+
 TEST_F(AGUIRectangle, DrawWithDMA2DTriggersDMA2DFillRectangleOperationWithAppropriateConfigParams)
 {
   guiRectangleDescription.baseDescription.position =
@@ -441,4 +481,109 @@ TEST_F(AGUIRectangle, DrawWithDMA2DSetsFunctionCallbackDMA2DDrawCompletedToBeFil
   guiRectangle.draw(GUI::DrawHardware::DMA2D);
 
   assertThatDMA2DFillRectangleDrawCompletedCallbackWasOk();
+}
+
+TEST_F(AGUIRectangle, DrawWithCPUDrawsOnlyPixelsWhichLieInsideClipRegion)
+{
+  const GUI::Region CLIP_REGION = { .x = 20, .y = 0, .width = 10u, .height = 15u };
+  guiRectangle.init(guiRectangleDescription);
+  guiRectangle.setClipRegion(CLIP_REGION);
+
+  guiRectangle.draw(GUI::DrawHardware::CPU);
+
+  assertThatGUIRectangleIsDrawnCorrectlyOntoFrameBuffer(guiRectangle);
+}
+
+TEST_F(AGUIRectangle, DrawWithDMA2DDrawsOnlyPixelsWhichLieInsideClipRegion)
+{
+  const GUI::Region CLIP_REGION = { .x = 20, .y = 0, .width = 10u, .height = 15u };
+  guiRectangle.init(guiRectangleDescription);
+  guiRectangle.setClipRegion(CLIP_REGION);
+  expectThatDMA2DFillRectangleWillDisplayOnlyVisiblePartOfGUIRectangle(guiRectangle);
+
+  guiRectangle.draw(GUI::DrawHardware::DMA2D);
+
+  assertThatDMA2DFillRectangleConfigParamsWereOk();
+}
+
+TEST_F(AGUIRectangle, SetColorChangesColorWhichIsUsedForDrawing)
+{
+  constexpr GUI::Color NEW_COLOR = { .red = 1u, .green = 2u, .blue = 3u };
+  guiRectangle.init(guiRectangleDescription);
+
+  guiRectangle.setColor(NEW_COLOR);
+  guiRectangle.draw(GUI::DrawHardware::CPU);
+
+  ASSERT_THAT(guiRectangle.getColor(), Eq(NEW_COLOR));
+  assertThatGUIRectangleIsDrawnCorrectlyOntoFrameBuffer(guiRectangle);
+}
+
+TEST_F(AGUIRectangle, SetColorReportsWholeRectangleAsDamagedIfColorIsChanged)
+{
+  GUI::Region damagedRegion = { .x = 0, .y = 0, .width = 0u, .height = 0u };
+  guiRectangle.init(guiRectangleDescription);
+  guiRectangle.registerDamagedRegionCallback(
+  {
+    .functionPtr = [](void *argument, const GUI::Region &region)
+    {
+      *reinterpret_cast<GUI::Region*>(argument) = region;
+    },
+    .argument = &damagedRegion
+  });
+
+  guiRectangle.setColor({ .red = 1u, .green = 2u, .blue = 3u });
+
+  ASSERT_THAT(damagedRegion, Eq(guiRectangle.getRegion()));
+}
+
+TEST_F(AGUIRectangle, EnqueueDMA2DDrawCommandsEnqueuesFillRectangleCommandWithoutStartingDMA2DTransfer)
+{
+  guiRectangle.init(guiRectangleDescription);
+  EXPECT_CALL(dma2dMock, enqueueFillRectangle(_))
+    .Times(1u);
+  EXPECT_CALL(dma2dMock, fillRectangle(_))
+    .Times(0u);
+
+  const GUI::ErrorCode errorCode = guiRectangle.enqueueDMA2DDrawCommands();
+
+  ASSERT_THAT(errorCode, Eq(GUI::ErrorCode::OK));
+}
+
+TEST_F(AGUIRectangle, EnqueueDMA2DDrawCommandsFailsIfDMA2DCommandQueueIsFull)
+{
+  guiRectangle.init(guiRectangleDescription);
+  ON_CALL(dma2dMock, enqueueFillRectangle(_))
+    .WillByDefault(Return(DMA2D::ErrorCode::COMMAND_QUEUE_FULL));
+
+  const GUI::ErrorCode errorCode = guiRectangle.enqueueDMA2DDrawCommands();
+
+  ASSERT_THAT(errorCode, Eq(GUI::ErrorCode::DMA2D_COMMAND_QUEUE_FULL));
+}
+
+TEST_F(AGUIRectangle, EnqueueDMA2DDrawCommandsFillsOnlyIntersectionOfRectangleAndClipRegion)
+{
+  const GUI::Region CLIP_REGION = { .x = 30, .y = -5, .width = 30u, .height = 20u };
+  DMA2D::FillRectangleConfig enqueuedFillRectangleConfig = {};
+  guiRectangle.init(guiRectangleDescription);
+  guiRectangle.setClipRegion(CLIP_REGION);
+  EXPECT_CALL(dma2dMock, enqueueFillRectangle(_))
+    .WillOnce([&](const DMA2D::FillRectangleConfig &fillRectangleConfig)
+    {
+      enqueuedFillRectangleConfig = fillRectangleConfig;
+      return DMA2D::ErrorCode::OK;
+    });
+
+  guiRectangle.enqueueDMA2DDrawCommands();
+
+  ASSERT_THAT(enqueuedFillRectangleConfig.position.x, Eq(30u));
+  ASSERT_THAT(enqueuedFillRectangleConfig.position.y, Eq(5u));
+  ASSERT_THAT(enqueuedFillRectangleConfig.dimension.width, Eq(15u));
+  ASSERT_THAT(enqueuedFillRectangleConfig.dimension.height, Eq(10u));
+}
+
+TEST_F(AGUIRectangle, IsAlwaysOpaque)
+{
+  guiRectangle.init(guiRectangleDescription);
+
+  ASSERT_THAT(guiRectangle.isOpaque(), Eq(true));
 }
\ No newline at end of file
@@ -11,6 +11,7 @@ TEST(IFrameBuffer, GetColorFormatPixelSizeReturnsSizeOfAPixelInBytesForTheForwar
 {
   ASSERT_THAT(IFrameBuffer::getColorFormatPixelSize(IFrameBuffer::ColorFormat::ARGB8888), Eq(4u));
   ASSERT_THAT(IFrameBuffer::getColorFormatPixelSize(IFrameBuffer::ColorFormat::RGB888), Eq(3u));
+  ASSERT_THAT(IFrameBuffer::getColorFormatPixelSize(IFrameBuffer::ColorFormat::RGB565), Eq(2u));
 }
 
 TEST(IFrameBufferDimension, IsEqualToAnotherIFrameBufferDimensionOnlyIfTheirWidthAndHeightAreTheSame)
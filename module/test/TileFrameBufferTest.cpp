@@ -0,0 +1,59 @@
+#include "TileFrameBuffer.h"
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include <cstdint>
+
+
+using namespace ::testing;
+
+
+TEST(ATileFrameBuffer, GetDimensionReturnsDimensionOfTheWholeFrameBufferAndNotOfTheTile)
+{
+  constexpr IFrameBuffer::Dimension EXPECTED_FRAME_BUFFER_DIMENSION =
+  {
+    .width  = 50u,
+    .height = 40u,
+  };
+  TileFrameBuffer<EXPECTED_FRAME_BUFFER_DIMENSION.width,
+    EXPECTED_FRAME_BUFFER_DIMENSION.height,
+    8u,
+    IFrameBuffer::ColorFormat::RGB888> tileFrameBuffer;
+
+  ASSERT_THAT(tileFrameBuffer.getDimension(), Eq(EXPECTED_FRAME_BUFFER_DIMENSION));
+}
+
+TEST(ATileFrameBuffer, GetSizeReturnsSizeOfTheWholeFrameBuffer)
+{
+  constexpr uint32_t EXPECTED_FRAME_BUFFER_SIZE = 50u * 40u * 3u;
+  TileFrameBuffer<50u, 40u, 8u, IFrameBuffer::ColorFormat::RGB888> tileFrameBuffer;
+
+  ASSERT_THAT(tileFrameBuffer.getSize(), Eq(EXPECTED_FRAME_BUFFER_SIZE));
+}
+
+TEST(ATileFrameBuffer, GetTileHeightReturnsTileHeightSpecifiedAsTemplateArgument)
+{
+  constexpr uint16_t EXPECTED_TILE_HEIGHT = 16u;
+  TileFrameBuffer<50u, 40u, EXPECTED_TILE_HEIGHT, IFrameBuffer::ColorFormat::RGB888> tileFrameBuffer;
+
+  ASSERT_THAT(tileFrameBuffer.getTileHeight(), Eq(EXPECTED_TILE_HEIGHT));
+}
+
+TEST(ATileFrameBuffer, GetPointerPointsToTileMemoryIfTileStartsAtTheFirstRow)
+{
+  TileFrameBuffer<50u, 40u, 8u, IFrameBuffer::ColorFormat::RGB888> tileFrameBuffer;
+
+  ASSERT_THAT(tileFrameBuffer.getPointer(), Eq(tileFrameBuffer.getTilePointer()));
+}
+
+TEST(ATileFrameBuffer, GetPointerIsShiftedSoThatFirstRowOfTheTileMapsToTheStartOfTileMemory)
+{
+  constexpr uint16_t TILE_FIRST_ROW = 16u;
+  constexpr uint32_t ROW_SIZE = 50u * 4u;
+  TileFrameBuffer<50u, 40u, 8u, IFrameBuffer::ColorFormat::ARGB8888> tileFrameBuffer;
+
+  tileFrameBuffer.setTileFirstRow(TILE_FIRST_ROW);
+
+  ASSERT_THAT(tileFrameBuffer.getTileFirstRow(), Eq(TILE_FIRST_ROW));
+  ASSERT_THAT(reinterpret_cast<uintptr_t>(tileFrameBuffer.getPointer()) + TILE_FIRST_ROW * ROW_SIZE,
+    Eq(reinterpret_cast<uintptr_t>(tileFrameBuffer.getTilePointer())));
+}
\ No newline at end of file